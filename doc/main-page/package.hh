@@ -59,6 +59,11 @@
     space as a graph called a roadmap. Nodes are configurations (or states) and
     edges are collision-free admissible paths (or trajectories).
 
+    \defgroup parallelism Parallel computation
+
+    Independent computations of planners, validations and optimizers are
+    distributed among the worker threads of a hpp::core::TaskScheduler.
+
     \defgroup constraints Constraints
 
     Some robots can be subject to constraints.
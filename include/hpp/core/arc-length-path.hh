@@ -0,0 +1,137 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_ARC_LENGTH_PATH_HH
+#define HPP_CORE_ARC_LENGTH_PATH_HH
+
+#include <hpp/core/config.hh>
+#include <hpp/core/fwd.hh>
+#include <hpp/core/path.hh>
+
+namespace hpp {
+namespace core {
+/// \addtogroup path
+/// \{
+
+/// Path parameterized by its length
+///
+/// The configuration at parameter \f$ s \f$ is the configuration of the
+/// original path at the time where the length of the original path
+/// reaches \f$ s \f$, as tabulated by timeParameterization::ArcLength.
+/// Algorithms that step uniformly along the parameter of this path, like
+/// pathValidation::Discretized, thus step uniformly in configuration space,
+/// whatever the speed of the original path.
+///
+/// \note Decorator design pattern
+class HPP_CORE_DLLAPI ArcLengthPath : public Path {
+ public:
+  typedef Path parent_t;
+
+  virtual ~ArcLengthPath() {}
+
+  /// Return a shared pointer to a copy of this
+  virtual PathPtr_t copy() const { return createCopy(weak_.lock()); }
+
+  /// Return a shared pointer to a copy of this and set constraints
+  ///
+  /// \param constraints constraints to apply to the copy
+  /// \precond *this should not have constraints.
+  virtual PathPtr_t copy(const ConstraintSetPtr_t& constraints) const {
+    return createCopy(weak_.lock(), constraints);
+  }
+
+  /// Create instance and return shared pointer
+  /// \param original path to reparameterize,
+  /// \param distance distance that measures the length,
+  /// \param tolerance see timeParameterization::ArcLength::create.
+  /// \return NULL if the length of the original path cannot be tabulated.
+  static ArcLengthPathPtr_t create(const PathPtr_t& original,
+                                   const DistancePtr_t& distance,
+                                   const value_type& tolerance = 1e-2);
+
+  /// Create copy and return shared pointer
+  static ArcLengthPathPtr_t createCopy(const ArcLengthPathPtr_t& path);
+
+  /// Create copy with constraints and return shared pointer
+  static ArcLengthPathPtr_t createCopy(const ArcLengthPathPtr_t& path,
+                                       const ConstraintSetPtr_t& constraints);
+
+  /// Get the path that is reparameterized
+  const PathPtr_t& original() const { return original_; }
+
+  /// Get the table that maps lengths to times of the original path
+  const timeParameterization::ArcLengthPtr_t& arcLength() const {
+    return arcLength_;
+  }
+
+  /// Get the initial configuration
+  Configuration_t initial() const { return original_->initial(); }
+
+  /// Get the final configuration
+  Configuration_t end() const { return original_->end(); }
+
+ protected:
+  /// Print path in a stream
+  virtual std::ostream& print(std::ostream& os) const;
+
+  /// Constructor
+  /// \param original path to reparameterize,
+  /// \param arcLength table of the length of the original path.
+  ArcLengthPath(const PathPtr_t& original,
+                const timeParameterization::ArcLengthPtr_t& arcLength);
+
+  /// Copy constructor
+  ArcLengthPath(const ArcLengthPath& path);
+
+  /// Copy constructor with constraints
+  ArcLengthPath(const ArcLengthPath& path,
+                const ConstraintSetPtr_t& constraints);
+
+  void init(ArcLengthPathPtr_t self);
+
+  virtual bool impl_compute(ConfigurationOut_t result,
+                            value_type param) const;
+
+  /// The derivative of the time of the original path with respect to the
+  /// length is constant between samples of the table. Derivatives of
+  /// order n are thus those of the original path scaled by its n-th power.
+  virtual void impl_derivative(vectorOut_t result, const value_type& param,
+                               size_type order) const;
+
+  virtual void impl_velocityBound(vectorOut_t result,
+                                  const value_type& param0,
+                                  const value_type& param1) const;
+
+ private:
+  PathPtr_t original_;
+  timeParameterization::ArcLengthPtr_t arcLength_;
+  ArcLengthPathWkPtr_t weak_;
+};  // class ArcLengthPath
+/// \}
+}  //   namespace core
+}  // namespace hpp
+#endif  // HPP_CORE_ARC_LENGTH_PATH_HH
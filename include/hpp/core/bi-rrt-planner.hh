@@ -40,6 +40,15 @@ namespace core {
 /// Implementation of directional bi-RRT algorithm
 /// maintaining only two connected components for
 /// respectively the start and goal configurations
+///
+/// If parameter "BiRRTPlanner/Atlas" is set and the steering method has a
+/// config projector, extension toward a random configuration is done in
+/// the tangent space of the constraints at the nearest node (a chart). The
+/// random configuration is projected onto the chart, the step is bounded by
+/// the chart radius and only this short step is projected back onto the
+/// constraints. Charts are created the first time a node is extended and
+/// their radius is halved each time projection fails or deviates too much
+/// from the chart.
 class HPP_CORE_DLLAPI BiRRTPlanner : public PathPlanner {
  public:
   /// Return shared pointer to new object.
@@ -62,13 +71,35 @@ class HPP_CORE_DLLAPI BiRRTPlanner : public PathPlanner {
   PathPtr_t extendInternal(const SteeringMethodPtr_t& sm,
                            Configuration_t& qProj_, const NodePtr_t& near,
                            const Configuration_t& target, bool reverse = false);
+  /// Extension in the chart of node near
+  /// \sa extendInternal
+  PathPtr_t extendInAtlas(const SteeringMethodPtr_t& sm,
+                          Configuration_t& qProj_, const NodePtr_t& near,
+                          const Configuration_t& target, bool reverse);
 
   ConfigurationShooterPtr_t configurationShooter_;
   ConnectedComponentPtr_t startComponent_;
   std::vector<ConnectedComponentPtr_t> endComponents_;
 
  private:
+  /// Local parameterization of the constraint manifold at a node
+  struct Chart {
+    /// Orthonormal basis of the kernel of the reduced Jacobian of the
+    /// constraints
+    matrix_t basis;
+    value_type radius;
+  };
+  typedef std::map<NodePtr_t, Chart> Charts_t;
+
+  /// Get the chart of a node, creating it if needed
+  Chart& chart(ConfigProjector& configProjector, const NodePtr_t& node);
+
   mutable Configuration_t qProj_;
+  /// Whether to extend in the tangent space of the constraints
+  bool atlas_;
+  Charts_t charts_;
+  vector_t dq_, dqSmall_;
+  Configuration_t qTangent_;
   BiRRTPlannerWkPtr_t weakPtr_;
 };
 /// \}
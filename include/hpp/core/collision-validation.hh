@@ -34,7 +34,11 @@
 
 #include <hpp/core/collision-validation-report.hh>
 #include <hpp/core/config-validation.hh>
+#include <hpp/core/distance-field.hh>
 #include <hpp/core/obstacle-user.hh>
+#include <map>
+#include <set>
+#include <vector>
 
 namespace hpp {
 namespace core {
@@ -66,6 +70,18 @@ class HPP_CORE_DLLAPI CollisionValidation : public ConfigValidation,
 
   bool checkParameterized() const { return checkParameterized_; }
 
+  /// Set a distance field of static obstacles
+  ///
+  /// Pairs between a robot body and an obstacle of the field are checked
+  /// exactly only if the field does not prove that the body is farther
+  /// than the security margin of the pair.
+  /// \param field distance field, NULL to check all pairs exactly.
+  /// \note the robot geometry must be set before calling this method.
+  void distanceField(const DistanceFieldPtr_t& field);
+
+  /// Get the distance field of static obstacles
+  const DistanceFieldPtr_t& distanceField() const { return distanceField_; }
+
  protected:
   CollisionValidation(const DevicePtr_t& robot);
   DevicePtr_t robot_;
@@ -74,6 +90,17 @@ class HPP_CORE_DLLAPI CollisionValidation : public ConfigValidation,
   bool checkParameterized_;
   bool computeAllContacts_;
 
+  /// Same as ObstacleUser::collide, skipping pairs certified by the
+  /// distance field.
+  bool collideWithField(fcl::CollisionResult& result, std::size_t& iPair,
+                        pinocchio::DeviceData& data);
+  DistanceFieldPtr_t distanceField_;
+  /// Rank of the robot objects in spheres_
+  std::map<CollisionObjectConstPtr_t, std::size_t> fieldObjects_;
+  /// Sphere decomposition of the robot objects
+  std::vector<DistanceField::Spheres_t> spheres_;
+  /// Obstacles of the distance field
+  std::set<CollisionObjectConstPtr_t> fieldObstacles_;
 };  // class ConfigValidation
 /// \}
 }  // namespace core
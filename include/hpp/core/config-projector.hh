@@ -65,7 +65,32 @@ typedef constraints::solver::BySubstitution BySubstitution;
 */
 class HPP_CORE_DLLAPI ConfigProjector : public Constraint {
  public:
-  enum LineSearchType { Backtracking, ErrorNormBased, FixedSequence, Constant };
+  /// Line search used by the Newton-like resolution.
+  ///
+  /// With \c Adaptive, the line search is chosen among the other ones
+  /// according to statistics of previous resolutions by this object.
+  /// \sa ConfigProjector::selectLineSearch
+  enum LineSearchType {
+    Backtracking,
+    ErrorNormBased,
+    FixedSequence,
+    Constant,
+    Adaptive
+  };
+
+  /// Number of line search types that are not \c Adaptive.
+  static const std::size_t NbLineSearchTypes = 4;
+
+  /// Statistics of the resolutions using one line search type.
+  struct LineSearchStatistics {
+    LineSearchStatistics() : nbCalls(0), nbSuccesses(0), nbIterations(0) {}
+    /// Number of resolutions.
+    size_type nbCalls;
+    /// Number of successful resolutions.
+    size_type nbSuccesses;
+    /// Total number of iterations, including the ones of failures.
+    size_type nbIterations;
+  };
 
   /// Return shared pointer to new object
   /// \param robot robot the constraint applies to.
@@ -294,6 +319,50 @@ class HPP_CORE_DLLAPI ConfigProjector : public Constraint {
 
   static void defaultLineSearch(LineSearchType ls);
 
+  /// Line search used by the next resolution.
+  ///
+  /// If the line search type is not \c Adaptive, it is returned. Otherwise,
+  /// \li each line search is first used a minimal number of times,
+  /// \li then the line search with the smallest number of iterations per
+  ///     success is selected,
+  /// \li periodically, the least used line search is selected again so
+  ///     that the statistics follow changes of the constraints.
+  ///
+  /// The choice only depends on the history of resolutions so that it is
+  /// deterministic.
+  LineSearchType selectLineSearch() const;
+
+  /// Get the statistics of the resolutions with a line search type.
+  /// \param ls a line search type different from \c Adaptive.
+  const LineSearchStatistics& lineSearchStatistics(LineSearchType ls) const {
+    assert(ls != Adaptive);
+    return lineSearchStatistics_[ls];
+  }
+
+  /// Forget statistics of previous resolutions.
+  void resetLineSearchStatistics();
+
+  /// \name Analytical inverse kinematics
+  /// \{
+
+  /// Add an inverse kinematics solver
+  ///
+  /// Before the Newton-like resolution, the solvers are called on the
+  /// numerical constraints they can solve. Among the solutions that
+  /// satisfy all the constraints, the closest one to the input
+  /// configuration is returned. If there is none, the Newton-like
+  /// resolution is performed.
+  void addInverseKinematics(const InverseKinematicsPtr_t& solver) {
+    inverseKinematics_.push_back(solver);
+  }
+
+  /// Get the inverse kinematics solvers
+  const InverseKinematicsVector_t& inverseKinematics() const {
+    return inverseKinematics_;
+  }
+
+  /// \}
+
  protected:
   /// Constructor
   /// \param robot robot the constraint applies to.
@@ -323,10 +392,21 @@ class HPP_CORE_DLLAPI ConfigProjector : public Constraint {
   BySubstitution* solver_;
 
   bool solverOneStep(ConfigurationOut_t config) const;
-  int solverSolve(ConfigurationOut_t config) const;
+  /// Solve with a line search different from \c Adaptive.
+  /// \retval nbIterations number of iterations performed.
+  int solverSolve(ConfigurationOut_t config, LineSearchType ls,
+                  size_type& nbIterations) const;
+  /// Update statistics of line search ls.
+  void addLineSearchStatistics(LineSearchType ls, bool success,
+                               size_type nbIterations);
+  /// Try the solutions of the inverse kinematics solvers
+  /// \return true if one of them satisfies the constraints.
+  bool solveInverseKinematics(ConfigurationOut_t config) const;
 
   ConfigProjectorWkPtr_t weak_;
   ::hpp::statistics::SuccessStatistics statistics_;
+  LineSearchStatistics lineSearchStatistics_[NbLineSearchTypes];
+  InverseKinematicsVector_t inverseKinematics_;
 
   ConfigProjector() {}
   HPP_SERIALIZABLE();
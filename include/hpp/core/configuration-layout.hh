@@ -0,0 +1,147 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_CONFIGURATION_LAYOUT_HH
+#define HPP_CORE_CONFIGURATION_LAYOUT_HH
+
+#include <hpp/core/config.hh>
+#include <hpp/core/fwd.hh>
+#include <vector>
+
+namespace hpp {
+namespace core {
+/// \addtogroup path
+/// \{
+
+/// Precompiled layout of the configuration space of a robot
+///
+/// Provides the operations of hpp::pinocchio::RnxSOnLieGroupMap
+/// (interpolate, difference, integrate) without dispatching through the
+/// joint visitors of pinocchio. The configuration vector is split into
+/// segments:
+/// \li contiguous vector space joints (including the translation part of
+///     free-flyer and planar joints and the extra configuration space) are
+///     merged into a single vector space segment,
+/// \li unbounded revolute joints and the rotation part of planar joints are
+///     SO(2) segments,
+/// \li spherical joints and the rotation part of free-flyer joints are
+///     SO(3) segments.
+///
+/// In hpp::pinocchio::RnxSOnLieGroupMap, SE(2) and SE(3) joints are
+/// represented as \f$R^n\times SO(n)\f$, which is what the segments above
+/// implement.
+///
+/// If the robot contains a joint that is not supported, the layout falls
+/// back to the generic functions of hpp::pinocchio.
+///
+/// Methods are allocation free and thread safe.
+class HPP_CORE_DLLAPI ConfigurationLayout {
+ public:
+  /// Type of a segment of the configuration vector
+  enum SegmentType { VECTOR_SPACE, SO2, SO3 };
+  /// Segment of the configuration vector
+  struct Segment {
+    SegmentType type;
+    /// Index in the configuration vector
+    size_type iq;
+    /// Index in the velocity vector
+    size_type iv;
+    /// Size in the configuration vector
+    size_type nq;
+    /// Size in the velocity vector
+    size_type nv;
+  };
+  typedef std::vector<Segment> Segments_t;
+
+  /// Build the layout of a robot
+  static ConfigurationLayoutPtr_t create(const DevicePtr_t& robot);
+
+  /// Get the layout of a robot
+  ///
+  /// Layouts are built once per robot and cached. The layout is rebuilt if
+  /// the configuration space of the robot has changed since it was built.
+  static ConfigurationLayoutPtr_t get(const DevicePtr_t& robot);
+
+  /// Whether all joints of the robot are handled by the segments
+  /// If false, the methods call the generic functions of hpp::pinocchio.
+  bool supported() const { return supported_; }
+
+  /// Size of configuration vectors
+  size_type nq() const { return nq_; }
+  /// Size of velocity vectors
+  size_type nv() const { return nv_; }
+
+  /// Get the segments
+  const Segments_t& segments() const { return segments_; }
+
+  /// Interpolate between two configurations
+  /// \param q0, q1 configurations,
+  /// \param u interpolation parameter in [0,1],
+  /// \retval result configuration at parameter \c u.
+  void interpolate(ConfigurationIn_t q0, ConfigurationIn_t q1,
+                   const value_type& u, ConfigurationOut_t result) const;
+
+  /// Interpolate between two configurations for several parameters
+  /// \param q0, q1 configurations,
+  /// \param u interpolation parameters,
+  /// \retval result matrix with as many columns as \c u, column \c i
+  ///         contains the configuration at parameter \c u[i].
+  ///
+  /// The difference between q0 and q1 is computed once for all parameters.
+  void interpolate(ConfigurationIn_t q0, ConfigurationIn_t q1, vectorIn_t u,
+                   matrixOut_t result) const;
+
+  /// Difference between two configurations
+  /// \retval result vector v such that \c q1 is the integration of \c v
+  ///         from \c q0, as hpp::pinocchio::difference(robot, q1, q0, v).
+  void difference(ConfigurationIn_t q1, ConfigurationIn_t q0,
+                  vectorOut_t result) const;
+
+  /// Integrate a velocity from a configuration
+  /// \retval result configuration reached from \c q with velocity \c v
+  ///         during a unit of time. \c result may alias \c q.
+  void integrate(ConfigurationIn_t q, vectorIn_t v,
+                 ConfigurationOut_t result) const;
+
+ protected:
+  ConfigurationLayout(const DevicePtr_t& robot);
+
+ private:
+  void addSegment(SegmentType type, size_type iq, size_type iv, size_type nq,
+                  size_type nv);
+
+  DeviceWkPtr_t robot_;
+  size_type nq_, nv_;
+  /// Number of joints of the model when the layout was built
+  size_type nJoints_;
+  bool supported_;
+  Segments_t segments_;
+};  // class ConfigurationLayout
+/// \}
+}  // namespace core
+}  // namespace hpp
+#endif  // HPP_CORE_CONFIGURATION_LAYOUT_HH
@@ -0,0 +1,128 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_CONFIGURATION_SHOOTER_BRIDGE_HH
+#define HPP_CORE_CONFIGURATION_SHOOTER_BRIDGE_HH
+
+#include <hpp/core/configuration-shooter.hh>
+#include <hpp/pinocchio/device.hh>
+
+namespace hpp {
+namespace core {
+namespace configurationShooter {
+/// \addtogroup configuration_sampling
+/// \{
+
+/// Sample configurations in narrow passages using the bridge test
+///
+/// A pair of invalid configurations is sampled: the first one uniformly and
+/// the second one with a gaussian distribution around the first one. If the
+/// middle of the pair is valid, it is returned. Such configurations lie in
+/// between obstacles, where a uniform sampling has a low probability to
+/// generate configurations.
+///
+/// To keep sampling the open regions of the configuration space, a ratio of
+/// the configurations is sampled uniformly. If no bridge is found after
+/// a maximal number of trials, a uniform sample is returned.
+class HPP_CORE_DLLAPI Bridge : public ConfigurationShooter {
+ public:
+  /// Create an instance
+  /// \param robot the robot,
+  /// \param configValidation validation used to test the configurations,
+  ///        usually the ConfigValidations of the problem.
+  static BridgePtr_t create(const DevicePtr_t& robot,
+                            const ConfigValidationPtr_t& configValidation);
+
+  /// Set the standard deviation of the second configuration of the bridge
+  /// \param factor ratio of the default standard deviation of
+  ///        configurationShooter::Gaussian.
+  /// \sa Gaussian::sigma
+  void sigma(const value_type& factor);
+
+  /// Set the ratio of configurations sampled uniformly
+  void uniformRatio(const value_type& ratio) {
+    assert(ratio >= 0 && ratio <= 1);
+    uniformRatio_ = ratio;
+  }
+  /// Get the ratio of configurations sampled uniformly
+  const value_type& uniformRatio() const { return uniformRatio_; }
+
+  /// Set the maximal number of bridges tested for one sample
+  void maxTrials(const size_type& maxTrials) { maxTrials_ = maxTrials; }
+  /// Get the maximal number of bridges tested for one sample
+  const size_type& maxTrials() const { return maxTrials_; }
+
+  /// Whether to sample the extra degrees of freedom
+  void sampleExtraDOF(bool sampleExtraDOF);
+
+  /// \name Statistics
+  /// \{
+
+  /// Number of bridges tested since last reset
+  size_type numberTrials() const { return numberTrials_; }
+  /// Number of configurations returned by the bridge test
+  size_type numberBridgeSamples() const { return numberBridgeSamples_; }
+  /// Number of configurations sampled uniformly, including fall backs
+  size_type numberUniformSamples() const { return numberUniformSamples_; }
+  /// Ratio of tested bridges that produced a configuration
+  value_type acceptanceRate() const {
+    if (numberTrials_ == 0) return 0;
+    return (value_type)numberBridgeSamples_ / (value_type)numberTrials_;
+  }
+  /// Reset the statistics
+  void resetStatistics() {
+    numberTrials_ = numberBridgeSamples_ = numberUniformSamples_ = 0;
+  }
+
+  /// \}
+
+ protected:
+  Bridge(const DevicePtr_t& robot,
+         const ConfigValidationPtr_t& configValidation);
+  void init(const BridgePtr_t& self) {
+    ConfigurationShooter::init(self);
+    weak_ = self;
+  }
+
+  virtual void impl_shoot(Configuration_t& q) const;
+
+ private:
+  DevicePtr_t robot_;
+  ConfigValidationPtr_t configValidation_;
+  UniformPtr_t uniform_;
+  GaussianPtr_t gaussian_;
+  value_type uniformRatio_;
+  size_type maxTrials_;
+  mutable size_type numberTrials_, numberBridgeSamples_, numberUniformSamples_;
+  BridgeWkPtr_t weak_;
+};  // class Bridge
+/// \}
+}  // namespace configurationShooter
+}  //   namespace core
+}  // namespace hpp
+
+#endif  // HPP_CORE_CONFIGURATION_SHOOTER_BRIDGE_HH
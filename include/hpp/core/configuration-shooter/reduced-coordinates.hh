@@ -0,0 +1,99 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_CONFIGURATION_SHOOTER_REDUCED_COORDINATES_HH
+#define HPP_CORE_CONFIGURATION_SHOOTER_REDUCED_COORDINATES_HH
+
+#include <hpp/core/configuration-shooter.hh>
+#include <hpp/pinocchio/device.hh>
+
+namespace hpp {
+namespace core {
+namespace configurationShooter {
+/// \addtogroup configuration_sampling
+/// \{
+
+/// Sample configurations in the reduced coordinates of explicit constraints
+///
+/// The variables that are not output of an explicit constraint of the
+/// constraint set are sampled. The output variables are then computed by
+/// evaluating the explicit functions. The resulting configurations satisfy
+/// the explicit constraints (locked joints, explicit relative
+/// transformations...) so that projection only has to handle the implicit
+/// constraints.
+///
+/// The free variables are sampled by another configuration shooter,
+/// configurationShooter::Uniform by default.
+class HPP_CORE_DLLAPI ReducedCoordinates : public ConfigurationShooter {
+ public:
+  /// Create an instance
+  /// \param robot the robot,
+  /// \param constraints the constraints whose explicit part is used. The
+  ///        constraint set is not copied so that modifications of its
+  ///        config projector are taken into account.
+  static ReducedCoordinatesPtr_t create(const DevicePtr_t& robot,
+                                        const ConstraintSetPtr_t& constraints);
+
+  /// Set the shooter used to sample the free variables
+  void innerShooter(const ConfigurationShooterPtr_t& shooter) {
+    assert(shooter);
+    innerShooter_ = shooter;
+  }
+  /// Get the shooter used to sample the free variables
+  const ConfigurationShooterPtr_t& innerShooter() const {
+    return innerShooter_;
+  }
+
+  /// Set the constraints
+  void constraints(const ConstraintSetPtr_t& constraints) {
+    constraints_ = constraints;
+  }
+  /// Get the constraints
+  const ConstraintSetPtr_t& constraints() const { return constraints_; }
+
+ protected:
+  ReducedCoordinates(const DevicePtr_t& robot,
+                     const ConstraintSetPtr_t& constraints);
+  void init(const ReducedCoordinatesPtr_t& self) {
+    ConfigurationShooter::init(self);
+    weak_ = self;
+  }
+
+  virtual void impl_shoot(Configuration_t& q) const;
+
+ private:
+  DevicePtr_t robot_;
+  ConstraintSetPtr_t constraints_;
+  ConfigurationShooterPtr_t innerShooter_;
+  ReducedCoordinatesWkPtr_t weak_;
+};  // class ReducedCoordinates
+/// \}
+}  // namespace configurationShooter
+}  //   namespace core
+}  // namespace hpp
+
+#endif  // HPP_CORE_CONFIGURATION_SHOOTER_REDUCED_COORDINATES_HH
@@ -0,0 +1,130 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_CONFIGURATION_SHOOTER_RETRACTION_HH
+#define HPP_CORE_CONFIGURATION_SHOOTER_RETRACTION_HH
+
+#include <hpp/core/configuration-shooter.hh>
+#include <hpp/pinocchio/device.hh>
+
+namespace hpp {
+namespace core {
+namespace configurationShooter {
+/// \addtogroup configuration_sampling
+/// \{
+
+/// Push configurations in collision to the free space
+///
+/// Configurations are sampled by another shooter. As long as a
+/// configuration is in collision, it is moved along the contact normal of
+/// the colliding pair by the penetration depth. The motion of the contact
+/// points is linearized with the Jacobians of the colliding bodies, and
+/// the smallest configuration displacement that separates them is applied.
+///
+/// The resulting configurations concentrate near the boundary of the
+/// obstacles. If a configuration is still invalid after the maximal number
+/// of iterations, or if it is invalid for another reason than a collision,
+/// it is returned as is.
+class HPP_CORE_DLLAPI Retraction : public ConfigurationShooter {
+ public:
+  /// Create an instance
+  /// \param robot the robot,
+  /// \param configValidation validation used to test the configurations,
+  ///        usually the ConfigValidations of the problem.
+  /// \param innerShooter shooter that samples the configurations to retract.
+  static RetractionPtr_t create(const DevicePtr_t& robot,
+                                const ConfigValidationPtr_t& configValidation,
+                                const ConfigurationShooterPtr_t& innerShooter);
+
+  /// Set the shooter that samples the configurations to retract
+  void innerShooter(const ConfigurationShooterPtr_t& shooter) {
+    assert(shooter);
+    innerShooter_ = shooter;
+  }
+  /// Get the shooter that samples the configurations to retract
+  const ConfigurationShooterPtr_t& innerShooter() const {
+    return innerShooter_;
+  }
+
+  /// Set the maximal number of retraction steps for one sample
+  void maxIterations(const size_type& maxIterations) {
+    maxIterations_ = maxIterations;
+  }
+  /// Get the maximal number of retraction steps for one sample
+  const size_type& maxIterations() const { return maxIterations_; }
+
+  /// Set the distance added to the penetration depth at each step
+  void margin(const value_type& margin) { margin_ = margin; }
+  /// Get the distance added to the penetration depth at each step
+  const value_type& margin() const { return margin_; }
+
+  /// \name Statistics
+  /// \{
+
+  /// Number of configurations sampled since last reset
+  size_type numberSamples() const { return numberSamples_; }
+  /// Number of configurations in collision moved to the free space
+  size_type numberRetracted() const { return numberRetracted_; }
+  /// Number of configurations returned invalid
+  size_type numberFailures() const { return numberFailures_; }
+  /// Reset the statistics
+  void resetStatistics() {
+    numberSamples_ = numberRetracted_ = numberFailures_ = 0;
+  }
+
+  /// \}
+
+ protected:
+  Retraction(const DevicePtr_t& robot,
+             const ConfigValidationPtr_t& configValidation,
+             const ConfigurationShooterPtr_t& innerShooter);
+  void init(const RetractionPtr_t& self) {
+    ConfigurationShooter::init(self);
+    weak_ = self;
+  }
+
+  virtual void impl_shoot(Configuration_t& q) const;
+
+ private:
+  /// Move a configuration away from the collision of the report
+  /// \return false if the colliding bodies cannot be separated.
+  bool step(Configuration_t& q, const CollisionValidationReport& report) const;
+
+  DevicePtr_t robot_;
+  ConfigValidationPtr_t configValidation_;
+  ConfigurationShooterPtr_t innerShooter_;
+  size_type maxIterations_;
+  value_type margin_;
+  mutable size_type numberSamples_, numberRetracted_, numberFailures_;
+  RetractionWkPtr_t weak_;
+};  // class Retraction
+/// \}
+}  // namespace configurationShooter
+}  //   namespace core
+}  // namespace hpp
+
+#endif  // HPP_CORE_CONFIGURATION_SHOOTER_RETRACTION_HH
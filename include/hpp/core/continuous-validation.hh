@@ -145,6 +145,9 @@ class HPP_CORE_DLLAPI ContinuousValidation : public PathValidation,
   virtual bool validate(const PathPtr_t& path, bool reverse,
                         PathPtr_t& validPart,
                         PathValidationReportPtr_t& report);
+  /// Return this instance
+  /// Concurrent validations take their interval validations from a pool.
+  virtual PathValidationPtr_t copy() const { return weak_.lock(); }
   /// Iteratively call method doExecute of delegate classes AddObstacle
   /// \param object new obstacle.
   /// \sa ContinuousValidation::add, ContinuousValidation::AddObstacle.
@@ -0,0 +1,150 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_DISTANCE_FIELD_HH
+#define HPP_CORE_DISTANCE_FIELD_HH
+
+#include <hpp/core/config.hh>
+#include <hpp/core/fwd.hh>
+#include <string>
+#include <vector>
+
+namespace hpp {
+namespace core {
+/// \addtogroup validation
+/// \{
+
+/// Distance field of static obstacles sampled on a voxel grid
+///
+/// The field stores, at the center of each voxel of an axis aligned box, a
+/// lower bound of the distance to the closest obstacle. Obstacles that are
+/// convex shapes give a signed distance, negative inside. hpp-fcl measures
+/// the distance between a point and a mesh as the distance to its closest
+/// triangle: meshes are thus surfaces, and the value is positive inside a
+/// closed mesh, as far from its triangles. A body entirely inside a mesh
+/// obstacle is then reported collision free, as by hpp-fcl collision
+/// checking. As the distance is 1-Lipschitz, a lower bound at any point of
+/// the box is the value of the closest voxel minus the distance to its
+/// center.
+///
+/// Robot bodies are covered by spheres (see \ref sphereDecomposition), so
+/// a lower bound of the distance between a body and the obstacles is
+/// obtained with one lookup per sphere. This bound certifies that a body is
+/// collision free away from the obstacles. Near the surface, exact
+/// collision checking is still required, see
+/// CollisionValidation::distanceField.
+///
+/// Values are computed with hpp-fcl distance queries. Obstacles farther than
+/// \ref maxDistance are not evaluated, and the value is bounded by
+/// maxDistance.
+class HPP_CORE_DLLAPI DistanceField {
+ public:
+  struct Sphere {
+    /// Center in the frame of the object
+    vector3_t center;
+    value_type radius;
+  };
+  typedef std::vector<Sphere> Spheres_t;
+
+  /// Create an empty field
+  /// \param lower, upper corners of the box covered by the field,
+  /// \param resolution size of the voxels.
+  static DistanceFieldPtr_t create(const vector3_t& lower,
+                                   const vector3_t& upper,
+                                   const value_type& resolution);
+
+  /// Add a static obstacle
+  /// \note \ref compute or \ref computeOrLoad must be called afterward.
+  void addObstacle(const CollisionObjectConstPtr_t& object);
+
+  /// Names of the obstacles in the field
+  const std::vector<std::string>& obstacleNames() const {
+    return obstacleNames_;
+  }
+
+  /// Set the distance beyond which obstacles are not evaluated
+  void maxDistance(const value_type& distance) { maxDistance_ = distance; }
+  /// Get the distance beyond which obstacles are not evaluated
+  const value_type& maxDistance() const { return maxDistance_; }
+
+  /// Evaluate the field at the center of every voxel
+  void compute();
+
+  /// Load the field from a cache file or compute and save it
+  ///
+  /// The file is used only if it was computed with the same box,
+  /// resolution, maximal distance and obstacles at the same positions.
+  /// \return true if the file was used.
+  bool computeOrLoad(const std::string& filename);
+
+  /// Write the field in a binary file
+  void save(const std::string& filename) const;
+
+  /// Read the field from a binary file
+  /// \return false if the file does not exist or was computed with other
+  ///         parameters or obstacles.
+  bool load(const std::string& filename);
+
+  /// Lower bound of the distance between a point and the obstacles
+  /// \return -infinity outside of the box.
+  value_type distanceLowerBound(const vector3_t& point) const;
+
+  /// Lower bound of the distance between spheres and the obstacles
+  /// \param spheres spheres in the frame of an object,
+  /// \param M position of the object.
+  value_type distanceLowerBound(const Spheres_t& spheres,
+                                const Transform3f& M) const;
+
+  /// Cover an object with spheres
+  ///
+  /// The local bounding box of the object is cut along its longest
+  /// dimension into boxes close to cubes, and each box is enclosed in a
+  /// sphere.
+  static Spheres_t sphereDecomposition(const CollisionObjectConstPtr_t& object);
+
+ protected:
+  DistanceField(const vector3_t& lower, const vector3_t& upper,
+                const value_type& resolution);
+
+ private:
+  /// Parameters and obstacle positions the values depend on
+  std::vector<value_type> key() const;
+  size_type index(const vector3_t& point, vector3_t& center) const;
+
+  vector3_t lower_;
+  value_type resolution_;
+  Eigen::Matrix<size_type, 3, 1> size_;
+  value_type maxDistance_;
+  ConstObjectStdVector_t obstacles_;
+  std::vector<std::string> obstacleNames_;
+  std::vector<float> values_;
+};  // class DistanceField
+/// \}
+}  // namespace core
+}  // namespace hpp
+
+#endif  // HPP_CORE_DISTANCE_FIELD_HH
@@ -91,6 +91,20 @@ class DubinsPath : public PathVector {
                                 const std::vector<JointPtr_t> wheels,
                                 ConstraintSetPtr_t constraints);
 
+  /// Create the paths of the feasible Dubins words by increasing length
+  ///
+  /// The words are computed once for all the paths. Callers may thus
+  /// fall back on a longer word when the shortest one is in collision.
+  /// \param maxNumber maximal number of paths,
+  /// \param maxLengthRatio words longer than the shortest one times this
+  ///        ratio are discarded.
+  /// Other parameters are those of create.
+  static std::vector<DubinsPathPtr_t> createCandidates(
+      const DevicePtr_t& device, ConfigurationIn_t init, ConfigurationIn_t end,
+      value_type extraLength, value_type rho, size_type xyId, size_type rzId,
+      const std::vector<JointPtr_t> wheels, ConstraintSetPtr_t constraints,
+      size_type maxNumber, value_type maxLengthRatio);
+
   /// Create copy and return shared pointer
   /// \param path path to copy
   static DubinsPathPtr_t createCopy(const DubinsPathPtr_t& path) {
@@ -153,6 +167,14 @@ class DubinsPath : public PathVector {
              const std::vector<JointPtr_t> wheels,
              ConstraintSetPtr_t constraints);
 
+  /// Constructor with constraints and given word
+  DubinsPath(const DevicePtr_t& robot, ConfigurationIn_t init,
+             ConfigurationIn_t end, value_type extraLength, value_type rho,
+             size_type xyId, size_type rzId,
+             const std::vector<JointPtr_t> wheels,
+             ConstraintSetPtr_t constraints, std::size_t typeId,
+             const Eigen::Matrix<value_type, 3, 1>& lengths);
+
   /// Copy constructor
   DubinsPath(const DubinsPath& path);
 
@@ -167,6 +189,7 @@ class DubinsPath : public PathVector {
  private:
   void dubins_init_normalised(double alpha, double beta, double d);
   void dubins_init(vector3_t q0, vector3_t q1);
+  void buildSegments();
   typedef Eigen::Matrix<value_type, 3, 1> Lengths_t;
 
   DevicePtr_t device_;
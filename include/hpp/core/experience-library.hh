@@ -0,0 +1,134 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_EXPERIENCE_LIBRARY_HH
+#define HPP_CORE_EXPERIENCE_LIBRARY_HH
+
+#include <hpp/core/config.hh>
+#include <hpp/core/fwd.hh>
+#include <string>
+#include <vector>
+
+namespace hpp {
+namespace core {
+/// \addtogroup path_planning
+/// \{
+
+/// Database of solution paths reused to solve new queries
+///
+/// An experience is a path solving a previous query, indexed by its initial
+/// and end configurations. The distance of an experience to a query is the
+/// sum of the distance between the initial configurations and of the
+/// distance between the end configurations.
+///
+/// To solve a query, the closest experiences are retrieved. The query
+/// endpoints are connected to them and the resulting path is validated.
+/// Only the invalid parts are planned again, see PathPlanner::localPlan.
+///
+/// The number of experiences is bounded. When it is exceeded, the least
+/// relevant experience is removed. The relevance of an experience is its
+/// number of uses plus one, divided by the number of insertions and reuses
+/// since its last use plus one. Experiences that are not reused anymore
+/// thus end up being replaced, however often they were reused before.
+///
+/// The library can be saved to and loaded from a file.
+class HPP_CORE_DLLAPI ExperienceLibrary {
+ public:
+  struct Experience {
+    PathVectorPtr_t path;
+    /// Number of queries solved with this experience
+    size_type numberUses;
+    /// Date of last insertion or reuse
+    size_type lastUse;
+
+    template <class Archive>
+    void serialize(Archive& ar, const unsigned int version);
+  };
+  typedef std::vector<Experience> Experiences_t;
+
+  /// Create an empty library
+  /// \param robot the robot, required to load the paths,
+  /// \param distance distance used to compare configurations.
+  static ExperienceLibraryPtr_t create(const DevicePtr_t& robot,
+                                       const DistancePtr_t& distance);
+
+  /// Add a solution path
+  /// Paths of null length are ignored.
+  void add(const PathVectorPtr_t& path);
+
+  /// Retrieve the experiences closest to a query
+  /// \param q1, q2 initial and end configurations of the query,
+  /// \param k maximal number of experiences.
+  /// \return indices of experiences sorted by increasing distance.
+  std::vector<std::size_t> retrieve(ConfigurationIn_t q1, ConfigurationIn_t q2,
+                                    std::size_t k) const;
+
+  /// Solve a query by reusing the closest experiences
+  /// \param planner the planner of the problem, used for local planning,
+  /// \param q1, q2 initial and end configurations of the query,
+  /// \param k maximal number of experiences tried.
+  /// \return a valid path or NULL if no experience could be repaired.
+  PathVectorPtr_t solve(const PathPlannerPtr_t& planner, ConfigurationIn_t q1,
+                        ConfigurationIn_t q2, std::size_t k);
+
+  /// Set the maximal number of experiences
+  void maxSize(const std::size_t& maxSize);
+  /// Get the maximal number of experiences
+  const std::size_t& maxSize() const { return maxSize_; }
+
+  const Experiences_t& experiences() const { return experiences_; }
+
+  std::size_t size() const { return experiences_.size(); }
+
+  void clear() { experiences_.clear(); }
+
+  /// Write the experiences in a binary file
+  void save(const std::string& filename) const;
+
+  /// Replace the experiences by the ones stored in a file
+  /// \sa save
+  void load(const std::string& filename);
+
+ protected:
+  ExperienceLibrary(const DevicePtr_t& robot, const DistancePtr_t& distance);
+
+ private:
+  /// Remove the least relevant experiences until the size is acceptable
+  void evict();
+
+  DevicePtr_t robot_;
+  DistancePtr_t distance_;
+  Experiences_t experiences_;
+  std::size_t maxSize_;
+  /// Incremented at each insertion or reuse
+  size_type date_;
+};  // class ExperienceLibrary
+/// \}
+}  // namespace core
+}  // namespace hpp
+
+#endif  // HPP_CORE_EXPERIENCE_LIBRARY_HH
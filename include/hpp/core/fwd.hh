@@ -42,12 +42,14 @@
 
 namespace hpp {
 namespace core {
+HPP_PREDEF_CLASS(ArcLengthPath);
 HPP_PREDEF_CLASS(BiRRTPlanner);
 HPP_PREDEF_CLASS(CollisionValidation);
 HPP_PREDEF_CLASS(CollisionValidationReport);
 HPP_PREDEF_CLASS(AllCollisionsValidationReport);
 HPP_PREDEF_CLASS(ConfigurationShooter);
 HPP_PREDEF_CLASS(ConfigProjector);
+HPP_PREDEF_CLASS(ConfigurationLayout);
 HPP_PREDEF_CLASS(ConfigValidation);
 HPP_PREDEF_CLASS(ConfigValidations);
 HPP_PREDEF_CLASS(ConnectedComponent);
@@ -56,8 +58,12 @@ HPP_PREDEF_CLASS(ConstraintSet);
 HPP_PREDEF_CLASS(DiffusingPlanner);
 HPP_PREDEF_CLASS(Distance);
 HPP_PREDEF_CLASS(DistanceBetweenObjects);
+HPP_PREDEF_CLASS(DistanceField);
 class Edge;
+HPP_PREDEF_CLASS(ExperienceLibrary);
 HPP_PREDEF_CLASS(ExtractedPath);
+HPP_PREDEF_CLASS(InverseKinematics);
+HPP_PREDEF_CLASS(ReversedPath);
 HPP_PREDEF_CLASS(SubchainPath);
 HPP_PREDEF_CLASS(JointBoundValidation);
 struct JointBoundValidationReport;
@@ -74,6 +80,8 @@ class ProblemSolver;
 HPP_PREDEF_CLASS(Roadmap);
 HPP_PREDEF_CLASS(SteeringMethod);
 HPP_PREDEF_CLASS(StraightPath);
+HPP_PREDEF_CLASS(TaskScheduler);
+class TaskGroup;
 HPP_PREDEF_CLASS(InterpolatedPath);
 HPP_PREDEF_CLASS(DubinsPath);
 HPP_PREDEF_CLASS(ReedsSheppPath);
@@ -88,6 +96,7 @@ class KDTree;
 typedef constraints::ComparisonTypes_t ComparisonTypes_t;
 typedef constraints::ComparisonType ComparisonType;
 
+typedef shared_ptr<ArcLengthPath> ArcLengthPathPtr_t;
 typedef shared_ptr<BiRRTPlanner> BiRRTPlannerPtr_t;
 typedef hpp::pinocchio::Body Body;
 typedef hpp::pinocchio::BodyPtr_t BodyPtr_t;
@@ -112,6 +121,7 @@ typedef Configurations_t::iterator ConfigIterator_t;
 typedef Configurations_t::const_iterator ConfigConstIterator_t;
 typedef shared_ptr<ConfigurationShooter> ConfigurationShooterPtr_t;
 typedef shared_ptr<ConfigProjector> ConfigProjectorPtr_t;
+typedef shared_ptr<ConfigurationLayout> ConfigurationLayoutPtr_t;
 typedef shared_ptr<ConfigValidation> ConfigValidationPtr_t;
 typedef shared_ptr<ConfigValidations> ConfigValidationsPtr_t;
 typedef shared_ptr<ConnectedComponent> ConnectedComponentPtr_t;
@@ -140,10 +150,15 @@ typedef constraints::DifferentiableFunctionPtr_t DifferentiableFunctionPtr_t;
 typedef shared_ptr<DiffusingPlanner> DiffusingPlannerPtr_t;
 typedef shared_ptr<Distance> DistancePtr_t;
 typedef shared_ptr<DistanceBetweenObjects> DistanceBetweenObjectsPtr_t;
+typedef shared_ptr<DistanceField> DistanceFieldPtr_t;
 typedef pinocchio::DistanceResults_t DistanceResults_t;
 typedef Edge* EdgePtr_t;
 typedef std::list<Edge*> Edges_t;
+typedef shared_ptr<ExperienceLibrary> ExperienceLibraryPtr_t;
 typedef shared_ptr<ExtractedPath> ExtractedPathPtr_t;
+typedef shared_ptr<InverseKinematics> InverseKinematicsPtr_t;
+typedef std::vector<InverseKinematicsPtr_t> InverseKinematicsVector_t;
+typedef shared_ptr<ReversedPath> ReversedPathPtr_t;
 typedef shared_ptr<SubchainPath> SubchainPathPtr_t;
 typedef pinocchio::JointJacobian_t JointJacobian_t;
 typedef pinocchio::Joint Joint;
@@ -211,6 +226,7 @@ typedef shared_ptr<const KinodynamicOrientedPath>
 typedef shared_ptr<InterpolatedPath> InterpolatedPathPtr_t;
 typedef shared_ptr<const InterpolatedPath> InterpolatedPathConstPtr_t;
 typedef shared_ptr<SteeringMethod> SteeringMethodPtr_t;
+typedef shared_ptr<TaskScheduler> TaskSchedulerPtr_t;
 typedef std::vector<PathPtr_t> Paths_t;
 typedef std::vector<PathVectorPtr_t> PathVectors_t;
 typedef std::vector<PathVectorPtr_t> PathVectors_t;
@@ -295,11 +311,15 @@ HPP_PREDEF_CLASS(SimpleTimeParameterization);
 typedef shared_ptr<SimpleTimeParameterization> SimpleTimeParameterizationPtr_t;
 HPP_PREDEF_CLASS(ConfigOptimization);
 typedef shared_ptr<ConfigOptimization> ConfigOptimizationPtr_t;
+HPP_PREDEF_CLASS(Windowed);
+typedef shared_ptr<Windowed> WindowedPtr_t;
 }  // namespace pathOptimization
 
 namespace pathPlanner {
 HPP_PREDEF_CLASS(kPrmStar);
 typedef shared_ptr<kPrmStar> kPrmStarPtr_t;
+HPP_PREDEF_CLASS(Prioritized);
+typedef shared_ptr<Prioritized> PrioritizedPtr_t;
 }  // namespace pathPlanner
 
 HPP_PREDEF_CLASS(PathValidations);
@@ -353,8 +373,24 @@ HPP_PREDEF_CLASS(Uniform);
 typedef shared_ptr<Uniform> UniformPtr_t;
 HPP_PREDEF_CLASS(Gaussian);
 typedef shared_ptr<Gaussian> GaussianPtr_t;
+HPP_PREDEF_CLASS(ReducedCoordinates);
+typedef shared_ptr<ReducedCoordinates> ReducedCoordinatesPtr_t;
+HPP_PREDEF_CLASS(Bridge);
+typedef shared_ptr<Bridge> BridgePtr_t;
+HPP_PREDEF_CLASS(Retraction);
+typedef shared_ptr<Retraction> RetractionPtr_t;
 }  // namespace configurationShooter
 
+namespace inverseKinematics {
+HPP_PREDEF_CLASS(SphericalWrist);
+typedef shared_ptr<SphericalWrist> SphericalWristPtr_t;
+}  // namespace inverseKinematics
+
+namespace timeParameterization {
+HPP_PREDEF_CLASS(ArcLength);
+typedef shared_ptr<ArcLength> ArcLengthPtr_t;
+}  // namespace timeParameterization
+
 /// Plane polygon represented by its vertices
 /// Used to model contact surfaces for manipulation applications
 typedef constraints::Shape_t Shape_t;
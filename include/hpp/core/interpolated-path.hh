@@ -29,6 +29,7 @@
 #ifndef HPP_CORE_INTERPOLATED_PATH_HH
 #define HPP_CORE_INTERPOLATED_PATH_HH
 
+#include <functional>
 #include <hpp/core/config.hh>
 #include <hpp/core/fwd.hh>
 #include <hpp/core/path.hh>
@@ -176,6 +177,17 @@ class HPP_CORE_DLLAPI InterpolatedPath : public Path {
 
   const InterpolationPoints_t& interpolationPoints() const { return configs_; }
 
+  /// Visit the waypoints of an interpolated path, or of a reversed view of
+  /// one, in the order they are traversed
+  ///
+  /// The waypoints are passed by reference to the interpolation points:
+  /// they remain valid as long as the path is not modified.
+  /// \return false if \c path is neither, in which case \c visitor is not
+  ///         called.
+  static bool visitWaypoints(
+      const PathPtr_t& path,
+      const std::function<void(const Configuration_t&)>& visitor);
+
  protected:
   /// Print path in a stream
   virtual std::ostream& print(std::ostream& os) const {
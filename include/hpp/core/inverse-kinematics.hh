@@ -0,0 +1,76 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_INVERSE_KINEMATICS_HH
+#define HPP_CORE_INVERSE_KINEMATICS_HH
+
+#include <hpp/core/config.hh>
+#include <hpp/core/fwd.hh>
+#include <vector>
+
+namespace hpp {
+namespace core {
+/// \addtogroup constraints
+/// \{
+
+/// Abstraction of closed-form or semi-analytic inverse kinematics solver
+///
+/// A solver handles some numerical constraints of a robot, for instance
+/// the pose of the end-effector of an arm with a given kinematic structure.
+/// When a ConfigProjector contains such a constraint, it calls the solvers
+/// added by ConfigProjector::addInverseKinematics before the Newton-like
+/// resolution. The solution closest to the input configuration that
+/// satisfies all the constraints is returned. If there is none, the
+/// Newton-like resolution is performed.
+///
+/// Solvers may be shared between several ConfigProjector instances and
+/// between threads. Method solve should therefore not modify the object.
+class HPP_CORE_DLLAPI InverseKinematics {
+ public:
+  /// Whether the solver applies to a numerical constraint
+  virtual bool canSolve(const constraints::ImplicitPtr_t& constraint) const = 0;
+
+  /// Compute configurations that satisfy a numerical constraint
+  /// \param constraint a constraint accepted by canSolve,
+  /// \param rhs right hand side of the constraint,
+  /// \param q input configuration. Only the joints handled by the solver
+  ///        are modified in the solutions,
+  /// \retval solutions the solutions are appended to this vector. They
+  ///         satisfy the joint bounds.
+  virtual void solve(const constraints::ImplicitPtr_t& constraint,
+                     vectorIn_t rhs, ConfigurationIn_t q,
+                     std::vector<Configuration_t>& solutions) const = 0;
+
+  virtual ~InverseKinematics() {}
+
+ protected:
+  InverseKinematics() {}
+};  // class InverseKinematics
+/// \}
+}  // namespace core
+}  // namespace hpp
+#endif  // HPP_CORE_INVERSE_KINEMATICS_HH
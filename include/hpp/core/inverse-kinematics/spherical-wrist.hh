@@ -0,0 +1,98 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_INVERSE_KINEMATICS_SPHERICAL_WRIST_HH
+#define HPP_CORE_INVERSE_KINEMATICS_SPHERICAL_WRIST_HH
+
+#include <hpp/core/inverse-kinematics.hh>
+
+namespace hpp {
+namespace core {
+namespace inverseKinematics {
+/// \addtogroup constraints
+/// \{
+
+/// Inverse kinematics of six revolute joint arms with a spherical wrist
+///
+/// The solver handles chains of six consecutive revolute joints the last
+/// three axes of which intersect at the wrist center. The constraints
+/// it solves are constraints::Transformation constraints of the last joint
+/// of a chain with respect to the world frame, with all the components
+/// active and equality comparison types.
+///
+/// The position of the wrist center only depends on the first three joints.
+/// If the first two axes intersect, it is solved in closed form with
+/// Paden-Kahan sub-problems, yielding up to four solutions. Otherwise, it
+/// is solved by Newton iterations from a fixed set of initial guesses.
+/// The orientation of the wrist is then solved in closed form, yielding up
+/// to two solutions for each position of the wrist center.
+///
+/// The joints before the chain keep the values of the input configuration.
+/// Angles are shifted by multiples of \f$2\pi\f$ towards the input
+/// configuration and solutions that violate the joint bounds are discarded.
+class HPP_CORE_DLLAPI SphericalWrist : public InverseKinematics {
+ public:
+  /// Create a solver for all the chains of a robot
+  /// \return the solver, or an empty pointer if the robot has no chain
+  ///         with the required structure.
+  static SphericalWristPtr_t create(const DevicePtr_t& robot);
+
+  /// Create a solver for one chain
+  /// \param joint last joint of the chain.
+  /// \throw std::invalid_argument if the chain does not have the required
+  ///        structure.
+  static SphericalWristPtr_t create(const DevicePtr_t& robot,
+                                    const JointPtr_t& joint);
+
+  /// Indices in the robot model of the last joints of the chains
+  const std::vector<size_type>& endJoints() const { return endJoints_; }
+
+  virtual bool canSolve(const constraints::ImplicitPtr_t& constraint) const;
+
+  virtual void solve(const constraints::ImplicitPtr_t& constraint,
+                     vectorIn_t rhs, ConfigurationIn_t q,
+                     std::vector<Configuration_t>& solutions) const;
+
+ protected:
+  SphericalWrist(const DevicePtr_t& robot);
+
+ private:
+  /// Check the structure of the chain ending at a joint
+  /// \param index index of the joint in the robot model,
+  /// \retval chain indices of the joints of the chain, from the base.
+  bool isChain(size_type index, std::vector<size_type>& chain) const;
+
+  DevicePtr_t robot_;
+  std::vector<size_type> endJoints_;
+  /// Joints of each chain, from the base
+  std::vector<std::vector<size_type> > chains_;
+};  // class SphericalWrist
+/// \}
+}  // namespace inverseKinematics
+}  // namespace core
+}  // namespace hpp
+#endif  // HPP_CORE_INVERSE_KINEMATICS_SPHERICAL_WRIST_HH
@@ -184,6 +184,17 @@ class HPP_CORE_DLLAPI KinodynamicOrientedPath : public KinodynamicPath {
 
   virtual PathPtr_t impl_extract(const interval_t& subInterval) const;
 
+  /// Bound of the velocity on a time interval
+  ///
+  /// In addition to the bound of KinodynamicPath, bound the angular velocity
+  /// of the root by the rotation rate of the heading, that is constant
+  /// between switch times up to the norm of the velocity. The bound is exact
+  /// when ignoring the z value. Where the heading may cross the -x axis, the
+  /// orientation jumps: the bound then includes a rotation of pi over the
+  /// piece between switch times.
+  virtual void impl_velocityBound(vectorOut_t result, const value_type& t0,
+                                  const value_type& t1) const;
+
  private:
   KinodynamicOrientedPathWkPtr_t weak_;
   bool ignoreZValue_;
@@ -56,6 +56,10 @@ namespace core {
 /// * The robot have an extra Config Space of dimension >= 6.
 /// The first 3 values of the extraConfig are the velocity of the root and the 3
 /// other values are the aceleration.
+///
+/// The phases of an axis may end before the end of the path: the translation
+/// then rests at the end configuration. This happens when reversing a path
+/// that starts with a waiting phase.
 class HPP_CORE_DLLAPI KinodynamicPath : public StraightPath {
  public:
   typedef StraightPath parent_t;
@@ -137,8 +141,9 @@ class HPP_CORE_DLLAPI KinodynamicPath : public StraightPath {
 
   /// Extraction/Reversion of a sub-path
   /// \param subInterval interval of definition of the extract path
-  /// If upper bound of subInterval is smaller than lower bound, return an empty
-  /// path
+  /// If upper bound of subInterval is smaller than lower bound, the result is
+  /// the time reversal of the sub-path: positions are traversed backward and
+  /// the velocities stored in the extra config space are negated.
   virtual PathPtr_t impl_extract(const interval_t& paramInterval) const;
 
   vector_t getT0() { return t0_; }
@@ -193,6 +198,24 @@ class HPP_CORE_DLLAPI KinodynamicPath : public StraightPath {
 
   virtual bool impl_compute(ConfigurationOut_t result, value_type t) const;
 
+  /// Bound of the velocity on a time interval
+  ///
+  /// The velocity of each translation axis is piecewise linear: its maximal
+  /// absolute value is reached at a bound of the interval or at a switch
+  /// time. The derivative of the velocity stored in the extra config space is
+  /// bounded by the acceleration of the phases crossed by the interval.
+  virtual void impl_velocityBound(vectorOut_t result, const value_type& t0,
+                                  const value_type& t1) const;
+
+  /// Velocity and acceleration of translation axis id at time t
+  void translationProfile(size_type id, value_type t, value_type& velocity,
+                          value_type& acceleration) const;
+
+  /// Sorted switch times of translation axis id inside [t0, t1]
+  /// The bounds of the interval are the first and last elements.
+  std::vector<value_type> switchTimes(size_type id, const value_type& t0,
+                                      const value_type& t1) const;
+
   inline double sgnenum(double val) const { return ((0. < val) - (val < 0.)); }
 
   inline int sgn(double d) const { return d >= 0.0 ? 1 : -1; }
@@ -202,6 +225,11 @@ class HPP_CORE_DLLAPI KinodynamicPath : public StraightPath {
   const DevicePtr_t& device() const { return device_; }
 
  private:
+  /// Time reversal of this path
+  /// Return a ReversedPath if the profile cannot be reversed in place, that
+  /// is if an axis starts with a constant non-zero velocity phase.
+  PathPtr_t reversed() const;
+
   KinodynamicPathWkPtr_t weak_;
   DevicePtr_t device_;
   vector_t a1_;
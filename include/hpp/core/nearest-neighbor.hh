@@ -59,11 +59,13 @@ class NearestNeighbor {
                            value_type& distance) = 0;
 
   /// \param[out] distance to the Kth closest neighbor
+  /// \param reverse if true, compute distance from given configuration to
+  /// nodes in roadmap, if false from nodes in roadmap to given configuration
   /// \return the K nearest neighbors
   virtual Nodes_t KnearestSearch(
       const Configuration_t& configuration,
       const ConnectedComponentPtr_t& connectedComponent, const std::size_t K,
-      value_type& distance) = 0;
+      value_type& distance, bool reverse = false) = 0;
 
   /// \param[out] distance to the Kth closest neighbor
   /// \return the K nearest neighbors
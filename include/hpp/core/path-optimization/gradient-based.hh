@@ -30,6 +30,7 @@
 #ifndef HPP_CORE_PATH_OPTIMIZATION_GRADIENT_BASED_HH
 #define HPP_CORE_PATH_OPTIMIZATION_GRADIENT_BASED_HH
 
+#include <hpp/core/path-optimization/linear-constraint.hh>
 #include <hpp/core/path-optimizer.hh>
 #include <hpp/core/path-vector.hh>
 #include <hpp/core/steering-method/straight.hh>
@@ -42,6 +43,26 @@ namespace pathOptimization {
 class CollisionConstraintsResult;
 typedef std::vector<CollisionConstraintsResult> CollisionConstraintsResults_t;
 
+/// Gradient based optimization of piecewise straight paths
+///
+/// The variables are the waypoints of the path. The cost is the sum of
+/// the squared weighed lengths of the straight segments, the minimum of
+/// which is the shortest path with the same number of waypoints.
+///
+/// At each iteration, a step toward the minimum of the quadratic
+/// approximation of the cost is computed subject to
+/// \li the linearized problem constraints at each waypoint (equality),
+/// \li the linearized collision constraints (inequality).
+///
+/// Degrees of freedom computed explicitly by the problem constraints
+/// (locked joints for instance) are removed from the variables.
+///
+/// If the path resulting from the step is in collision, a collision
+/// constraint is added for the first collision, linearized on the
+/// latest valid path. If no constraint can be added, the step is reduced.
+///
+/// \sa SplineGradientBased for a more general version handling
+///     spline paths.
 class HPP_CORE_DLLAPI GradientBased : public PathOptimizer {
  public:
   /// Return shared pointer to new object.
@@ -49,17 +70,26 @@ class HPP_CORE_DLLAPI GradientBased : public PathOptimizer {
   static GradientBasedPtr_t create(const ProblemConstPtr_t& problem);
 
   /// Optimize path
+  /// \param path a path made of straight segments,
+  /// \return a path with the same number of waypoints. If the input path
+  ///         is not valid once its segments are replaced by straight
+  ///         paths, the input path is returned.
   virtual PathVectorPtr_t optimize(const PathVectorPtr_t& path);
 
+  ~GradientBased();
+
  protected:
   GradientBased(const ProblemConstPtr_t& problem);
 
  private:
-  typedef Eigen::JacobiSVD<matrix_t> Jacobi_t;
-
+  /// Convert vectors of dimension numberDofs_ from and to vectors of
+  /// dimension nbWaypoints_ * robotNumberDofs_.
+  /// The degrees of freedom computed explicitly are removed.
+  /// \{
   void compressHessian(matrixIn_t normal, matrixOut_t small) const;
   void compressVector(vectorIn_t normal, vectorOut_t small) const;
   void uncompressVector(vectorIn_t small, vectorOut_t normal) const;
+  /// \}
 
   void initialize(const PathVectorPtr_t& path);
 
@@ -76,19 +106,24 @@ class HPP_CORE_DLLAPI GradientBased : public PathOptimizer {
   }
 
   /// Convert a vector into a path
-  void vectorToPath(vectorIn_t x, const PathVectorPtr_t& result) const {
+  PathVectorPtr_t vectorToPath(vectorIn_t x) const {
+    PathVectorPtr_t result =
+        PathVector::create(configSize_, robotNumberDofs_);
     Configuration_t q0 = initial_, q1;
     size_type index = 0;
     while (index < x.size()) {
       q1 = x.segment(index, configSize_);
       PathPtr_t p = (*steeringMethod_)(q0, q1);
+      if (!p) return PathVectorPtr_t();
       result->appendPath(p);
       q0 = q1;
       index += configSize_;
     }
     q1 = end_;
     PathPtr_t p = (*steeringMethod_)(q0, q1);
+    if (!p) return PathVectorPtr_t();
     result->appendPath(p);
+    return result;
   }
 
   void initializeProblemConstraints();
@@ -97,42 +132,24 @@ class HPP_CORE_DLLAPI GradientBased : public PathOptimizer {
   /// \param x input path as a vector
   ///
   /// Constraints of the problem are applied to each waypoint. Therefore,
-  /// the first 6n lines of the Jacobian and of the value are computed,
-  /// where n is the number of waypoints.
+  /// the Jacobian is block diagonal with blocks of fSize_ rows.
   void updateProblemConstraints(vectorIn_t x);
 
-  /// Check whether constraints are satisfied
-  ///
-  /// \param x input path as a vector,
-  /// \param path input path (same path as x)
-  /// \param collisionConstraints vector of collision constraints
-  ///
-  /// Check that
-  ///   \li each waypoint satisfies the problem constraints, and
-  ///   \li each collision constraint drift is within bounds that ensures
-  ///       the user that there is no collision
+  /// Project the waypoints onto the problem constraints
   ///
-  bool constraintsSatisfied(
-      vectorOut_t& x, PathVectorPtr_t& path,
-      CollisionConstraintsResults_t& collisionConstraints);
+  /// \retval x path as a vector
+  /// \return whether projection succeeded for each waypoint.
+  bool solveConstraints(vectorOut_t x) const;
 
-  /// Solve problem constraints and collision constraints
-  ///
-  /// \retval x path that satisfies the constraints as a vector,
-  /// \retval path path that satisfies the constraints (same as x)
-  /// \param collisionConstraints vector of collision constraints
-  ///
-  /// While constraints are not satisfied
-  /// (method GradientBased::constraintsSatisfied), linearize constraints
-  /// (problem and collision) around current path and solve linearized
-  /// constraints regardless of the cost
-  bool solveConstraints(vectorOut_t x, PathVectorPtr_t& path,
-                        CollisionConstraintsResults_t& collisionConstraints);
   /// Process path integration
   void integrate(vectorIn_t x0, vectorIn_t step, vectorOut_t x1) const;
 
-  /// Compute iteration of optimization program
-  vector_t computeIterate(vectorIn_t x) const;
+  /// Compute step toward the optimum of the linearized problem
+  ///
+  /// \param x current path as a vector,
+  /// \retval step step in the compressed variables.
+  /// \return false if the quadratic program has no solution.
+  bool computeIterate(vectorIn_t x, vectorOut_t step);
 
   /// Display path waypoints in log file
   void displayPath(vectorIn_t x, std::string
@@ -147,59 +164,63 @@ class HPP_CORE_DLLAPI GradientBased : public PathOptimizer {
 
   /// Add a collision constraint
   ///
-  /// \param ccr contains parameter of collision configuration
-  /// \param latest valid path
-  /// Add lines to the Jacobian and fill with values corresponding to
-  /// new relative position constraint.
-  /// Resize right hand side.
-  void addCollisionConstraint(const CollisionConstraintsResult& ccr,
-                              const PathVectorPtr_t& path) const;
+  /// \param report validation report of the path in collision,
+  /// \param collisionPath path in collision,
+  /// \param validPath latest valid path.
+  /// \return whether a constraint was added.
+  /// Add a line to the collision Jacobian corresponding to a linearized
+  /// relative position constraint and resize right hand side.
+  bool addCollisionConstraint(const PathValidationReportPtr_t& report,
+                              const PathVectorPtr_t& collisionPath,
+                              const PathVectorPtr_t& validPath);
 
   /// Update right hand side of constraints
   ///
-  /// \param list of collision constraints
-  /// \param latest valid path
+  /// \param validPath latest valid path
   ///
   /// Update right hand side with current path so that latest valid path
-  /// perfectly satisfies constraints.
-  void updateRightHandSide(
-      const CollisionConstraintsResults_t& collisionConstraints,
-      const PathVectorPtr_t& path) const;
+  /// satisfies the collision constraints.
+  void updateRightHandSide(const PathVectorPtr_t& validPath);
 
-  /// Get constraints of problem and update local jacobian J_
-  bool getProblemConstraints();
+  /// Configuration at a given parameter in [0,1] of a segment
+  Configuration_t configAtParameter(const PathVectorPtr_t& path,
+                                    size_type rank, value_type s) const;
 
-  mutable CostPtr_t cost_;
+  CostPtr_t cost_;
   DevicePtr_t robot_;
+  ConfigProjectorPtr_t configProjector_;
   size_type configSize_;
   size_type robotNumberDofs_;
   size_type robotNbNonLockedDofs_;
   size_type numberDofs_;
-  size_type fSize_;  // dimension of collision constraints
-  mutable Configuration_t initial_;
-  mutable Configuration_t end_;
+  size_type fSize_;  // dimension of problem constraints at one waypoint
+  Configuration_t initial_;
+  Configuration_t end_;
   WeighedDistancePtr_t distance_;
   steeringMethod::StraightPtr_t steeringMethod_;
-  /// I_, H_ Identity matrix and cost Hessian respectively
-  /// Jf_  collision-constraints jacobian for now
-  /// J_ problem-constraints jacobian
-  /// Aplusb = Jf^{+}*b (for affine constraints)
-  mutable matrix_t H_, Hinverse_, J_;
-  mutable matrix_t Hz_, gz_;
+  /// H_ cost Hessian, Hz_ compressed cost Hessian,
+  /// J_ problem-constraints Jacobian, value_ their value.
+  /// H_ and Hz_ are block tridiagonal and J_ is block diagonal. They are
+  /// stored as dense matrices since LinearConstraint and QuadraticProgram
+  /// decompose dense matrices.
+  matrix_t H_, Hz_, J_;
+  vector_t value_;
+  size_type nbWaypoints_;
+  /// Gradient of the cost as a row matrix and compressed.
+  matrix_t rgrad_;
+  vector_t gradient_;
   mutable vector_t stepNormal_;
-  mutable bool fullRank_;
-  mutable size_type nbWaypoints_;
-  mutable value_type alpha_;
-  mutable rowvector_t rgrad_;
-  mutable vector_t rhs_;
-  mutable vector_t value_;
-  mutable vector_t p_, p0_;
+  /// Linearized collision constraints \f$ J p \geq b \f$ on the step in
+  /// compressed variables.
+  LinearConstraint collision_;
+  CollisionConstraintsResults_t collisionConstraints_;
   value_type epsilon_;
-  std::size_t iterMax_;
-  value_type alphaInit_;  // .1, .2, .4
+  value_type costThreshold_;
+  value_type alphaInit_;
   value_type alphaMax_;
 };  // GradientBased
 }  // namespace pathOptimization
+/// \}
 }  // namespace core
 }  // namespace hpp
 #endif  // HPP_CORE_PATH_OPTIMIZATION_GRADIENT_BASED_HH
@@ -0,0 +1,116 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_PATH_OPTIMIZATION_WINDOWED_HH
+#define HPP_CORE_PATH_OPTIMIZATION_WINDOWED_HH
+
+#include <functional>
+#include <hpp/core/path-optimizer.hh>
+#include <mutex>
+#include <vector>
+
+namespace hpp {
+namespace core {
+namespace pathOptimization {
+/// \addtogroup path_optimization
+/// \{
+
+/// Windowed path optimization
+///
+/// Path optimizer that splits the input path into windows of consecutive
+/// paths, at waypoint boundaries, and optimizes the windows concurrently
+/// with another path optimizer. A second pass then optimizes windows
+/// centered on the seams between the windows of the first pass, so that
+/// the waypoints at the window boundaries are also optimized.
+///
+/// The result of an inner optimizer is kept only if it starts and ends
+/// at the same configurations as the window it optimizes.
+///
+/// Each task works on a copy of the problem that shares the robot, the
+/// distance, the path validation and the path projector of the problem,
+/// and that owns copies of the constraints and of the steering method.
+///
+/// Parameters:
+/// \li PathOptimization/Windowed/WindowSize: number of paths of each window,
+/// \li PathOptimization/Windowed/NumberThreads: maximal number of parallel
+///     tasks, 0 for the number of threads of the task scheduler,
+/// \li PathOptimization/Windowed/Optimizer: name of the inner optimizer
+///     when created by ProblemSolver. It cannot be "Windowed".
+///
+/// \ref interrupt is forwarded to the running inner optimizers.
+///
+/// \note Path projectors are not thread safe. If the problem has one, the
+///       windows are optimized sequentially.
+class HPP_CORE_DLLAPI Windowed : public PathOptimizer {
+ public:
+  typedef std::function<PathOptimizerPtr_t(const ProblemConstPtr_t&)>
+      OptimizerBuilder_t;
+
+  /// Return shared pointer to new object.
+  /// \param problem the problem,
+  /// \param builder function that creates the optimizer of each window.
+  static WindowedPtr_t create(const ProblemConstPtr_t& problem,
+                              const OptimizerBuilder_t& builder);
+
+  /// Optimize path
+  virtual PathVectorPtr_t optimize(const PathVectorPtr_t& path);
+
+  /// Interrupt path optimization and the running inner optimizers
+  virtual void interrupt();
+
+ protected:
+  /// \throw std::invalid_argument if builder is empty.
+  Windowed(const ProblemConstPtr_t& problem, const OptimizerBuilder_t& builder);
+
+ private:
+  typedef std::vector<PathVectorPtr_t> PathVectors_t;
+
+  /// Optimize each window concurrently
+  /// \return the optimized windows, flattened
+  PathVectors_t optimizeWindows(const PathVectors_t& windows);
+
+  /// Optimize one window with a new instance of the inner optimizer
+  /// \param problem problem owned by the calling task.
+  /// \return the flattened optimized window, or \c window if the inner
+  ///         optimizer failed or did not preserve the end configurations.
+  PathVectorPtr_t optimizeWindow(const ProblemConstPtr_t& problem,
+                                 const PathVectorPtr_t& window) const;
+
+  /// Create a copy of the problem to be used by another task
+  ProblemPtr_t threadProblem() const;
+
+  OptimizerBuilder_t builder_;
+  /// Inner optimizers being run
+  mutable std::vector<PathOptimizerPtr_t> running_;
+  /// Protects running_
+  mutable std::mutex runningMutex_;
+};  // class Windowed
+/// \}
+}  // namespace pathOptimization
+}  // namespace core
+}  // namespace hpp
+#endif  // HPP_CORE_PATH_OPTIMIZATION_WINDOWED_HH
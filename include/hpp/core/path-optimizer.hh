@@ -33,6 +33,7 @@
 #include <boost/date_time/posix_time/ptime.hpp>
 #include <hpp/core/config.hh>
 #include <hpp/core/fwd.hh>
+#include <hpp/core/trace.hh>
 
 namespace hpp {
 namespace core {
@@ -52,7 +53,7 @@ class HPP_CORE_DLLAPI PathOptimizer {
   virtual PathVectorPtr_t optimize(const PathVectorPtr_t& path) = 0;
 
   /// Interrupt path optimization
-  void interrupt() { interrupt_ = true; }
+  virtual void interrupt() { interrupt_ = true; }
   /// Set maximal number of iterations
   void maxIterations(const unsigned long int& n);
   /// set time out (in seconds)
@@ -70,7 +71,10 @@ class HPP_CORE_DLLAPI PathOptimizer {
 
   void monitorExecution();
 
-  void endIteration() { ++monitor_.iteration; }
+  void endIteration() {
+    ++monitor_.iteration;
+    HPP_CORE_TRACE(OPTIMIZER_STEP, true, monitor_.iteration);
+  }
 
   bool shouldStop() const;
 
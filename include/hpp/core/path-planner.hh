@@ -30,6 +30,7 @@
 #ifndef HPP_CORE_PATH_PLANNER_HH
 #define HPP_CORE_PATH_PLANNER_HH
 
+#include <atomic>
 #include <hpp/core/config.hh>
 #include <hpp/core/fwd.hh>
 
@@ -64,14 +65,32 @@ class HPP_CORE_DLLAPI PathPlanner {
   /// in an infinite loop when no solution is found.
   virtual PathVectorPtr_t solve();
   /// Try to connect initial and goal configurations to existing roadmap
+  ///
+  /// For each connected component not containing the initial (resp. a goal)
+  /// node, the nearest nodes of the component are tried by increasing
+  /// distance until one of them can be connected. The number of nodes
+  /// tried and the number of threads among which the connected components
+  /// are distributed are given by parameters
+  /// \li "PathPlanner/ConnectInitAndGoals/NumberCandidates",
+  /// \li "PathPlanner/ConnectInitAndGoals/NumberThreads".
+  ///
+  /// Each thread uses its own copy of the steering method. The path
+  /// validation is shared and should thus be thread safe, which is the case
+  /// of the path validations implemented in this package.
   virtual void tryConnectInitAndGoals();
+  /// Try to connect nodes to the other connected components of the roadmap
+  ///
+  /// Same as \ref tryConnectInitAndGoals with edges going from the
+  /// \c sources and to the \c targets.
+  void tryConnectNodes(const NodeVector_t& sources,
+                       const NodeVector_t& targets);
 
   /// User implementation of one step of resolution
   virtual void oneStep() = 0;
   /// Post processing of the resulting path
   virtual PathVectorPtr_t finishSolve(const PathVectorPtr_t& path);
   /// Interrupt path planning
-  void interrupt();
+  virtual void interrupt();
   /// Set maximal number of iterations
   void maxIterations(const unsigned long int& n);
   /// set time out (in seconds)
@@ -83,8 +102,29 @@ class HPP_CORE_DLLAPI PathPlanner {
   void stopWhenProblemIsSolved(bool enable);
 
   /// Find a path in the roadmap and transform it in trajectory
+  ///
+  /// If parameter "PathPlanner/RepairSolution" is set and the problem target
+  /// is a set of goal configurations, the edges of the path found in the
+  /// roadmap are validated. Invalid edges are ignored by the next graph
+  /// searches, and when no path remains, the endpoints of the invalid edges
+  /// are connected again by local planning. The graph search is resumed
+  /// after each change: only the nodes reached through an invalid edge are
+  /// searched again.
+  ///
+  /// The method is const but it adds the repairing edges to the roadmap and
+  /// caches the validation results, which are kept until the next call to
+  /// \ref startSolve.
+  /// \throw path_planning_failed if the solution cannot be repaired.
   PathVectorPtr_t computePath() const;
 
+  /// Plan a valid path between two configurations
+  ///
+  /// Try the steering method first, then a DiffusingPlanner on a copy of
+  /// the problem, interrupted after "PathPlanner/Repair/LocalTimeOut"
+  /// seconds. The roadmap of this planner is not modified.
+  /// \return a valid path or NULL
+  PathPtr_t localPlan(ConfigurationIn_t q1, ConfigurationIn_t q2) const;
+
  protected:
   /// Constructor
   ///
@@ -99,7 +139,8 @@ class HPP_CORE_DLLAPI PathPlanner {
 
   /// \copydoc PathPlanner::stopWhenProblemIsSolved
   bool stopWhenProblemIsSolved_;
-  bool interrupt_;
+  /// Set by \ref interrupt, possibly from another thread.
+  std::atomic<bool> interrupt_;
 
   /// Maximal number of iterations to solve a problem
   /// reaching this bound raises an exception.
@@ -107,14 +148,19 @@ class HPP_CORE_DLLAPI PathPlanner {
   /// Time out (in seconds) before interrupting the planning
   double timeOut_;
 
-
  private:
+  /// Validate and repair the shortest path in the roadmap
+  /// \sa computePath
+  PathVectorPtr_t repairSolution() const;
+
   /// Reference to the problem
   const ProblemConstWkPtr_t problem_;
   /// Pointer to the roadmap.
   const RoadmapPtr_t roadmap_;
-  
-  
+  /// Cache of the edges validated by repairSolution
+  mutable std::set<EdgePtr_t> validEdges_;
+  /// Cache of the edges found invalid by repairSolution
+  mutable std::set<EdgePtr_t> invalidEdges_;
 
   /// Store weak pointer to itself
   PathPlannerWkPtr_t weakPtr_;
@@ -0,0 +1,169 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_PATH_PLANNER_PRIORITIZED_HH
+#define HPP_CORE_PATH_PLANNER_PRIORITIZED_HH
+
+#include <chrono>
+#include <hpp/core/path-planner.hh>
+#include <mutex>
+
+namespace hpp {
+namespace core {
+namespace pathPlanner {
+/// \addtogroup path_planning
+/// \{
+
+/// Prioritized planning for robots made of several independent sub-robots
+///
+/// A composite robot (several arms in a cell for instance) is split into
+/// sub-robots, each owning some intervals of the configuration and velocity
+/// vectors. Sub-robots are planned one after the other, in the order of
+/// priority, by an inner planner (DiffusingPlanner) that only samples the
+/// configuration parameters of the current sub-robot, the other sub-robots
+/// being at their initial configuration.
+///
+/// The paths of the sub-robots are then executed simultaneously, each one
+/// as a SubchainPath of the composite robot. When adding a sub-robot makes
+/// the combined path invalid, already planned sub-robots are moving
+/// obstacles for the new one:
+/// \li the new sub-robot is first delayed at its initial configuration,
+/// \li if no delay works, the part of the combined path between the first
+///     and the last collision is planned in the composite configuration
+///     space of the sub-robots planned so far.
+///
+/// The path of a sub-robot is only shifted in time as a whole: it is not
+/// planned in the space-time of the sub-robots of higher priority.
+///
+/// The resulting path is inserted in the roadmap as an edge between the
+/// initial and goal nodes. The problem should have a single goal
+/// configuration.
+///
+/// If no sub-robot is given, sub-robots are the kinematic trees attached to
+/// the universe joint. If the problem has constraints, the robot is planned
+/// as a whole since constraints may couple the sub-robots.
+///
+/// Each call to the inner planner is bounded by the time remaining before
+/// the time out of this planner and by the number of iterations given by
+/// parameter "PrioritizedPlanner/InnerMaxIterations", or by
+/// \ref maxIterations if it is smaller. \ref interrupt is forwarded to the
+/// running inner planner.
+class HPP_CORE_DLLAPI Prioritized : public PathPlanner {
+ public:
+  typedef PathPlanner Parent_t;
+  /// Return shared pointer to new instance
+  /// \param problem the path planning problem
+  static PrioritizedPtr_t create(const ProblemConstPtr_t& problem);
+  /// Return shared pointer to new instance
+  /// \param problem the path planning problem
+  /// \param roadmap previously built roadmap
+  static PrioritizedPtr_t createWithRoadmap(const ProblemConstPtr_t& problem,
+                                            const RoadmapPtr_t& roadmap);
+
+  /// Add a sub-robot with lower priority than the ones already added
+  /// \param configIntervals intervals of the configuration vector,
+  /// \param velocityIntervals intervals of the velocity vector.
+  void addSubRobot(const segments_t& configIntervals,
+                   const segments_t& velocityIntervals);
+  /// Remove all sub-robots
+  void resetSubRobots();
+
+  /// Initialize the problem resolution
+  ///  \li call parent implementation,
+  ///  \li check that there is a single goal configuration,
+  ///  \li compute the sub-robots if none was given.
+  virtual void startSolve();
+  /// Plan the next sub-robot
+  virtual void oneStep();
+  /// Interrupt path planning and the running inner planner
+  virtual void interrupt();
+
+ protected:
+  Prioritized(const ProblemConstPtr_t& problem);
+  Prioritized(const ProblemConstPtr_t& problem, const RoadmapPtr_t& roadmap);
+  /// Store weak pointer to itself
+  void init(const PrioritizedWkPtr_t& weak);
+
+ private:
+  struct SubRobot {
+    segments_t configIntervals, velocityIntervals;
+  };
+  typedef std::vector<SubRobot> SubRobots_t;
+  /// Path of some planned sub-robots
+  struct Component {
+    SubchainPathPtr_t path;
+    /// Time the sub-robots wait at their initial configuration
+    value_type delay;
+  };
+  typedef std::vector<Component> Components_t;
+  class CoordinatedPath;
+
+  /// Plan between two configurations with the inner planner
+  /// \param subRobot if not NULL, only the configuration parameters of
+  ///        this sub-robot are sampled.
+  PathVectorPtr_t plan(ConfigurationIn_t qInit, ConfigurationIn_t qGoal,
+                       const SubRobot* subRobot) const;
+  /// Validate the combination of the components, delaying the last one if
+  /// needed
+  /// \return the combined path if a valid delay was found, NULL otherwise
+  PathPtr_t coordinate();
+  /// Plan in the configuration space of all the sub-robots planned so far,
+  /// including the current one, and merge the components into one.
+  /// \param keepValidParts if true, only the part of the combination of the
+  ///        components between the first and the last collision is planned,
+  ///        otherwise the sub-robots are planned from the initial to the
+  ///        goal configuration.
+  /// \return the combined path, NULL if planning failed.
+  PathPtr_t repair(bool keepValidParts);
+  /// Throw path_planning_failed for the current sub-robot
+  void failure() const;
+  /// Compute the sub-robots from the kinematic tree
+  void computeSubRobots();
+
+  /// Sub-robots by decreasing priority
+  SubRobots_t subRobots_;
+  /// Whether sub-robots were computed by computeSubRobots
+  bool automaticSubRobots_;
+  /// Index of the next sub-robot to plan
+  std::size_t current_;
+  /// Paths of the planned sub-robots
+  Components_t components_;
+  /// Time at which resolution started
+  std::chrono::steady_clock::time_point startTime_;
+  /// Inner planner being run, if any
+  mutable PathPlannerPtr_t inner_;
+  /// Protects inner_
+  mutable std::mutex innerMutex_;
+  /// Weak pointer to itself
+  PrioritizedWkPtr_t weak_;
+};  // class Prioritized
+/// \}
+}  // namespace pathPlanner
+}  // namespace core
+}  // namespace hpp
+
+#endif  // HPP_CORE_PATH_PLANNER_PRIORITIZED_HH
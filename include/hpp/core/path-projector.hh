@@ -51,6 +51,10 @@ class HPP_CORE_DLLAPI PathProjector {
   /// \return True if projection succeded
   bool apply(const PathPtr_t& path, PathPtr_t& projection) const;
 
+  /// Copy the instance to project paths concurrently
+  /// \return NULL if the projector cannot be copied, which is the default.
+  virtual PathProjectorPtr_t copy() const { return PathProjectorPtr_t(); }
+
  protected:
   /// Constructor
   ///
@@ -63,6 +67,10 @@ class HPP_CORE_DLLAPI PathProjector {
                 const SteeringMethodPtr_t& steeringMethod,
                 bool keepSteeringMethodConstraints = false);
 
+  /// Copy constructor
+  /// The steering method is copied.
+  PathProjector(const PathProjector& other);
+
   /// Method to be reimplemented by inherited class.
   virtual bool impl_apply(const PathPtr_t& path,
                           PathPtr_t& projection) const = 0;
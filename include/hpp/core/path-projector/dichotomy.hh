@@ -53,6 +53,10 @@ class HPP_CORE_DLLAPI Dichotomy : public PathProjector {
                   maxPathLength);
   }
 
+  virtual PathProjectorPtr_t copy() const {
+    return DichotomyPtr_t(new Dichotomy(*this));
+  }
+
  protected:
   bool impl_apply(const PathPtr_t& path, PathPtr_t& projection) const;
 
@@ -55,18 +55,30 @@ class HPP_CORE_DLLAPI Global : public PathProjector {
   static GlobalPtr_t create(const ProblemConstPtr_t& problem,
                             const value_type& step);
 
+  virtual PathProjectorPtr_t copy() const {
+    return GlobalPtr_t(new Global(*this));
+  }
+
  protected:
   bool impl_apply(const PathPtr_t& path, PathPtr_t& projection) const;
 
+  /// Constructor
+  /// \param estimateHessianBound whether to estimate the bound of the
+  ///        Hessian of the constraints on each segment from the Jacobians
+  ///        at its extremities.
+  /// \param safetyFactor factor applied to the estimated curvature.
   Global(const DistancePtr_t& distance,
          const SteeringMethodPtr_t& steeringMethod, value_type step,
-         value_type threshold, value_type hessianBound);
+         value_type threshold, value_type hessianBound,
+         bool estimateHessianBound = false, value_type safetyFactor = 2.);
 
  private:
   value_type step_;
 
   const value_type hessianBound_;
   const value_type thresholdMin_;
+  const bool estimateHessianBound_;
+  const value_type safetyFactor_;
 
   typedef constraints::solver::lineSearch::FixedSequence LineSearch_t;
   struct Data {
@@ -76,6 +88,9 @@ class HPP_CORE_DLLAPI Global : public PathProjector {
     std::size_t Niter;
     value_type sigma;
     bool projected;
+    /// Reduced Jacobian of the constraints. Only computed when the bound
+    /// of the Hessian is estimated.
+    matrix_t J;
   };
 
   typedef std::list<Configuration_t, Eigen::aligned_allocator<Configuration_t> >
@@ -124,8 +139,12 @@ class HPP_CORE_DLLAPI Global : public PathProjector {
                 bool computeSigma = false, bool projected = false,
                 const Configuration_t& distTo = Configuration_t()) const;
 
+  /// Bound of the Hessian between two consecutive configurations.
+  value_type hessianBound(const Data& prev, const Data& cur) const;
+
   mutable Configuration_t q_;
   mutable vector_t dq_;
+  mutable vector_t value_;
 };
 }  // namespace pathProjector
 }  // namespace core
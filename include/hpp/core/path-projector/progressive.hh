@@ -47,12 +47,22 @@ class HPP_CORE_DLLAPI Progressive : public PathProjector {
   static ProgressivePtr_t create(const ProblemConstPtr_t& problem,
                                  const value_type& step);
 
+  virtual PathProjectorPtr_t copy() const {
+    return ProgressivePtr_t(new Progressive(*this));
+  }
+
  protected:
   bool impl_apply(const PathPtr_t& path, PathPtr_t& projection) const;
 
+  /// Constructor
+  /// \param estimateHessianBound whether to estimate online the bound of the
+  ///        Hessian of the constraints. If hessianBound is positive, it is
+  ///        used as the initial bound.
+  /// \param safetyFactor factor applied to the estimated curvature.
   Progressive(const DistancePtr_t& distance,
               const SteeringMethodPtr_t& steeringMethod, value_type step,
-              value_type threshold, value_type hessianBound);
+              value_type threshold, value_type hessianBound,
+              bool estimateHessianBound = false, value_type safetyFactor = 2.);
 
   bool project(const PathPtr_t& path, PathPtr_t& proj) const;
 
@@ -61,6 +71,8 @@ class HPP_CORE_DLLAPI Progressive : public PathProjector {
   const value_type thresholdMin_;
   const value_type hessianBound_;
   const bool withHessianBound_;
+  const bool estimateHessianBound_;
+  const value_type safetyFactor_;
 };
 }  // namespace pathProjector
 }  // namespace core
@@ -53,6 +53,10 @@ class HPP_CORE_DLLAPI RecursiveHermite : public PathProjector {
 
   bool impl_apply(const PathPtr_t& path, core::PathPtr_t& projection) const;
 
+  virtual PathProjectorPtr_t copy() const {
+    return RecursiveHermitePtr_t(new RecursiveHermite(*this));
+  }
+
 
  protected:
 
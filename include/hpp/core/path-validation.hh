@@ -69,6 +69,14 @@ class HPP_CORE_DLLAPI PathValidation {
   /// The default implementation builds a straight path of length 0
   /// with the input configuration and validates the path.
   virtual bool validate(ConfigurationIn_t q, ValidationReportPtr_t& report);
+
+  /// Get an instance that validates paths concurrently with this one
+  ///
+  /// \return a copy, this instance if it is thread safe, or NULL if the
+  ///         path validation cannot be used concurrently. The default
+  ///         implementation returns NULL.
+  virtual PathValidationPtr_t copy() const { return PathValidationPtr_t(); }
+
   virtual ~PathValidation(){};
 
  protected:
@@ -43,6 +43,10 @@ namespace pathValidation {
 ///
 /// Apply some configuration validation algorithms at discretized values
 /// of the path parameter.
+///
+/// If a distance is set, the path is discretized by length under this
+/// distance instead: parts of the path where the speed is low are not
+/// oversampled.
 class HPP_CORE_DLLAPI Discretized : public PathValidation,
                                     public ConfigValidations {
  public:
@@ -71,6 +75,26 @@ class HPP_CORE_DLLAPI Discretized : public PathValidation,
   /// with the input configuration and validates the path.
   virtual bool validate(ConfigurationIn_t q, ValidationReportPtr_t& report);
 
+  /// Set the distance that measures the length of paths
+  /// If not null, configurations are validated every step size of length
+  /// of the path, instead of every step size of time. The length of each
+  /// path is tabulated at each validation, except for instances of
+  /// ArcLengthPath built with the same distance, the time of which is
+  /// already their length. Paths that fail to project the configurations
+  /// needed to measure their length are validated every step size of time.
+  /// \sa timeParameterization::ArcLength
+  void distance(const DistancePtr_t& distance) { distance_ = distance; }
+
+  /// Get the distance that measures the length of paths
+  const DistancePtr_t& distance() const { return distance_; }
+
+  /// Copy the instance
+  /// The configuration validations are shared: they use the pool of
+  /// device data of the robot and can be used concurrently.
+  virtual PathValidationPtr_t copy() const {
+    return DiscretizedPtr_t(new Discretized(*this));
+  }
+
   virtual ~Discretized(){};
 
  protected:
@@ -80,6 +104,7 @@ class HPP_CORE_DLLAPI Discretized : public PathValidation,
       : ConfigValidations(validations), stepSize_(stepSize){};
 
   value_type stepSize_;
+  DistancePtr_t distance_;
 };  // class Discretized
 /// \}
 }  // namespace pathValidation
@@ -70,6 +70,10 @@ class HPP_CORE_DLLAPI PathValidations
   /// Add a path validation object
   virtual void addPathValidation(const PathValidationPtr_t& pathValidation);
 
+  /// Copy each path validation
+  /// \return NULL if one of them cannot be copied.
+  virtual PathValidationPtr_t copy() const;
+
   virtual ~PathValidations(){};
 
  protected:
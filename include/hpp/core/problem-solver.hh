@@ -66,6 +66,8 @@ typedef std::function<DistancePtr_t(const ProblemConstPtr_t&)>
     DistanceBuilder_t;
 typedef std::function<SteeringMethodPtr_t(const ProblemConstPtr_t&)>
     SteeringMethodBuilder_t;
+typedef std::function<InverseKinematicsPtr_t(const DevicePtr_t&)>
+    InverseKinematicsBuilder_t;
 typedef std::vector<std::pair<std::string, CollisionObjectPtr_t> >
     AffordanceObjects_t;
 typedef vector3_t AffordanceConfig_t;
@@ -80,6 +82,25 @@ class HPP_CORE_DLLAPI ProblemSolver {
   typedef std::vector<PathOptimizerPtr_t> PathOptimizers_t;
   typedef std::vector<std::string> PathOptimizerTypes_t;
   typedef std::vector<std::string> ConfigValidationTypes_t;
+  /// Initial and goal configurations of a query
+  typedef std::pair<ConfigurationPtr_t, ConfigurationPtr_t> Query_t;
+  typedef std::vector<Query_t> Queries_t;
+  /// Result of a query solved by \ref solveQueries
+  struct QueryResult {
+    /// Whether a path has been found
+    bool success;
+    /// Id of the path in \ref paths if \c success is true
+    std::size_t pathId;
+    /// Number of roadmap expansion steps done before the query was solved
+    size_type iterations;
+    /// Time (in seconds) elapsed before the query was solved
+    value_type time;
+    /// Number of edges of the path
+    size_type numberEdges;
+    QueryResult()
+        : success(false), pathId(0), iterations(0), time(0), numberEdges(0) {}
+  };
+  typedef std::vector<QueryResult> QueryResults_t;
 
   /// Create instance and return pointer
   static ProblemSolverPtr_t create();
@@ -330,8 +351,44 @@ class HPP_CORE_DLLAPI ProblemSolver {
   virtual void finishSolveStepByStep();
 
   /// Set and solve the problem
+  ///
+  /// If an experience library is set and the problem target is a set of goal
+  /// configurations, the closest experiences are reused first, see
+  /// ExperienceLibrary::solve. The number of experiences tried is given by
+  /// parameter "ProblemSolver/Experience/NumberRetrieved". If none of them
+  /// can be repaired, the path planner solves the problem and the optimized
+  /// solution is added to the library.
   virtual void solve();
 
+  /// Set the experience library used by \ref solve
+  /// \param library the library, NULL to plan from scratch.
+  void experienceLibrary(const ExperienceLibraryPtr_t& library) {
+    experienceLibrary_ = library;
+  }
+  /// Get the experience library used by \ref solve
+  const ExperienceLibraryPtr_t& experienceLibrary() const {
+    return experienceLibrary_;
+  }
+
+  /// Solve several queries on a shared roadmap
+  ///
+  /// The endpoints of all queries are added to the roadmap and connected to
+  /// it concurrently, see PathPlanner::tryConnectNodes. The roadmap is then
+  /// expanded by the path planner, each step with the initial and goal
+  /// configurations of the next unsolved query in turn, until all queries
+  /// are solved or the limits given by \ref maxIterPathPlanning and
+  /// \ref setTimeOutPathPlanning are reached. Finally the graph searches of
+  /// the solved queries are run in parallel by a number of threads given by
+  /// parameter "ProblemSolver/Queries/NumberThreads".
+  ///
+  /// \return one result per query. The paths found are stored in
+  ///         \ref paths and are not optimized.
+  /// \note The initial and goal configurations of the problem are restored
+  ///       on return. The nodes added for the endpoints of the queries are
+  ///       removed from the roadmap, see Roadmap::removeNodes. The nodes
+  ///       added while expanding the roadmap are kept.
+  QueryResults_t solveQueries(const Queries_t& queries);
+
   /// Make direct connection between two configurations
   /// \param start, end: the configurations to link.
   /// \param validate whether path should be validated. If true, path
@@ -531,6 +588,12 @@ class HPP_CORE_DLLAPI ProblemSolver {
   /// with a problem as input
   Container<PathOptimizerBuilder_t> pathOptimizers;
 
+  /// Container of static method that creates an InverseKinematics solver
+  /// with a robot as input. The solvers are added to the ConfigProjector
+  /// instances created by this class. A builder returns an empty pointer
+  /// if the robot has no kinematic chain the solver applies to.
+  Container<InverseKinematicsBuilder_t> inverseKinematics;
+
   /// Container of constraints::Implicit
   Container<constraints::ImplicitPtr_t> numericalConstraints;
   /// member lockedJoints has been removed. LockedJointPtr_t
@@ -594,6 +657,8 @@ class HPP_CORE_DLLAPI ProblemSolver {
   ConfigurationPtr_t initConf_;
   /// Shared pointer to goal configuration.
   Configurations_t goalConfigurations_;
+  /// Solutions reused by solve
+  ExperienceLibraryPtr_t experienceLibrary_;
   /// Robot type
   std::string robotType_;
   /// Configuration shooter
@@ -633,6 +698,8 @@ class HPP_CORE_DLLAPI ProblemSolver {
   /// Computation of distances to obstacles
   DistanceBetweenObjectsPtr_t distanceBetweenObjects_;
   void initProblem();
+  /// Add the inverse kinematics solvers that apply to the robot
+  void addInverseKinematics(const ConfigProjectorPtr_t& configProjector) const;
 };  // class ProblemSolver
 }  // namespace core
 }  // namespace hpp
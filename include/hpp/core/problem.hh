@@ -182,6 +182,20 @@ class HPP_CORE_DLLAPI Problem {
   PathProjectorPtr_t pathProjector() const { return pathProjector_; }
   /// \}
 
+  /// \name Parallel computations
+  /// \{
+  /// Set the scheduler of parallel computations
+  void taskScheduler(const TaskSchedulerPtr_t& scheduler) {
+    taskScheduler_ = scheduler;
+  }
+
+  /// Get the scheduler of parallel computations
+  /// By default, the scheduler shared by the process,
+  /// TaskScheduler::global(). Its threads are thus only created by the
+  /// first parallel computation.
+  TaskSchedulerPtr_t taskScheduler() const;
+  /// \}
+
   /// \name Constraints applicable to the robot
   /// \{
 
@@ -313,6 +327,8 @@ class HPP_CORE_DLLAPI Problem {
   ConstraintSetPtr_t constraints_;
   /// Configuration shooter
   ConfigurationShooterPtr_t configurationShooter_;
+  /// Scheduler of parallel computations
+  TaskSchedulerPtr_t taskScheduler_;
 };  // class Problem
 /// \}
 }  // namespace core
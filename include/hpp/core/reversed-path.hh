@@ -0,0 +1,177 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_REVERSED_PATH_HH
+#define HPP_CORE_REVERSED_PATH_HH
+
+#include <hpp/core/path.hh>
+
+namespace hpp {
+namespace core {
+/// \addtogroup path
+/// \{
+
+/// Path traversed backward
+///
+/// The reversed path shares the original path: the configuration at
+/// parameter \f$s\f$ is the configuration of the original path at time
+/// \f$t_0 + t_1 - s\f$ where \f$[t_0,t_1]\f$ is the time range of the
+/// original path. Creating a reversed path thus takes constant time
+/// whatever the size of the original path, and reversing it gives back the
+/// original path.
+/// \note Decorator design pattern
+class HPP_CORE_DLLAPI ReversedPath : public Path {
+ public:
+  typedef Path parent_t;
+
+  virtual ~ReversedPath() {}
+
+  /// Return a shared pointer to a copy of this
+  virtual PathPtr_t copy() const { return createCopy(weak_.lock()); }
+
+  /// Return a shared pointer to a copy of this and set constraints
+  ///
+  /// \param constraints constraints to apply to the copy
+  /// \precond *this should not have constraints.
+  virtual PathPtr_t copy(const ConstraintSetPtr_t& constraints) const {
+    return createCopy(weak_.lock(), constraints);
+  }
+
+  /// Create a path traversing \c original backward
+  static ReversedPathPtr_t create(const PathPtr_t& original) {
+    ReversedPath* ptr = new ReversedPath(original);
+    ReversedPathPtr_t shPtr(ptr);
+    ptr->init(shPtr);
+    return shPtr;
+  }
+
+  static ReversedPathPtr_t createCopy(const ReversedPathPtr_t& path) {
+    ReversedPath* ptr = new ReversedPath(*path);
+    ReversedPathPtr_t shPtr(ptr);
+    ptr->init(shPtr);
+    return shPtr;
+  }
+
+  static ReversedPathPtr_t createCopy(const ReversedPathPtr_t& path,
+                                      const ConstraintSetPtr_t& constraints) {
+    ReversedPath* ptr = new ReversedPath(*path, constraints);
+    ReversedPathPtr_t shPtr(ptr);
+    ptr->init(shPtr);
+    return shPtr;
+  }
+
+  /// Return the original path
+  virtual PathPtr_t reverse() const { return original_; }
+
+  /// Get the path that is traversed backward
+  const PathPtr_t& original() const { return original_; }
+
+  /// Get the initial configuration
+  virtual Configuration_t initial() const { return original_->end(); }
+
+  /// Get the final configuration
+  virtual Configuration_t end() const { return original_->initial(); }
+
+ protected:
+  virtual bool impl_compute(ConfigurationOut_t result, value_type param) const {
+    // The constraints of the original path are those of this path and are
+    // applied by Path::eval: do not apply them here.
+    return original_->at(timeInOriginalPath(param), result);
+  }
+
+  virtual void impl_derivative(vectorOut_t result, const value_type& param,
+                               size_type order) const {
+    original_->derivative(result, timeInOriginalPath(param), order);
+    if (order % 2 == 1) result *= -1.;
+  }
+
+  void impl_velocityBound(vectorOut_t result, const value_type& param0,
+                          const value_type& param1) const override {
+    original_->velocityBound(result, timeInOriginalPath(param1),
+                             timeInOriginalPath(param0));
+  }
+
+  virtual PathPtr_t impl_extract(const interval_t& paramInterval) const {
+    if (paramInterval == originalRange_) return copy();
+    return original_->extract(timeInOriginalPath(paramInterval.first),
+                              timeInOriginalPath(paramInterval.second));
+  }
+
+  /// Print path in a stream
+  virtual std::ostream& print(std::ostream& os) const {
+    os << "Reversed Path:" << std::endl;
+    Path::print(os);
+    os << "original path:" << std::endl;
+    os << *original_ << std::endl;
+    return os;
+  }
+
+  /// Constructor
+  ///
+  /// \param original Path to reverse.
+  ReversedPath(const PathPtr_t& original)
+      : Path(original->timeRange(), original->outputSize(),
+             original->outputDerivativeSize(), original->constraints()),
+        original_(original),
+        originalRange_(original->timeRange()) {}
+
+  ReversedPath(const ReversedPath& path)
+      : Path(path),
+        original_(path.original_),
+        originalRange_(path.originalRange_),
+        weak_() {}
+
+  ReversedPath(const ReversedPath& path, const ConstraintSetPtr_t& constraints)
+      : Path(path, constraints),
+        original_(path.original_),
+        originalRange_(path.originalRange_),
+        weak_() {}
+
+  void init(ReversedPathPtr_t self) {
+    parent_t::init(self);
+    weak_ = self;
+  }
+
+  /// For serialization only.
+  ReversedPath() {}
+
+ private:
+  inline value_type timeInOriginalPath(const value_type& s) const {
+    return originalRange_.first + originalRange_.second - s;
+  }
+
+  PathPtr_t original_;
+  /// Time range of the original path
+  interval_t originalRange_;
+  ReversedPathWkPtr_t weak_;
+
+  HPP_SERIALIZABLE();
+};  // class ReversedPath
+/// \}
+}  //   namespace core
+}  // namespace hpp
+#endif  // HPP_CORE_REVERSED_PATH_HH
@@ -179,6 +179,14 @@ class HPP_CORE_DLLAPI Roadmap {
   /// Add the nodes and edges of a roadmap into this one.
   void merge(const RoadmapPtr_t& other);
 
+  /// Remove nodes and the edges that start or end at them
+  ///
+  /// Removing a node may split a connected component: the roadmap is
+  /// rebuilt from the remaining nodes and edges, which invalidates the
+  /// pointers to them. The initial node and the goal nodes are kept unless
+  /// they are removed.
+  void removeNodes(const NodeVector_t& nodes);
+
   /// Add a PathVector instance in the roadmap
   /// Waypoints are inserted as nodes,
   /// each elementary path is inserted as an edge
@@ -33,6 +33,7 @@
 #include <hpp/core/fwd.hh>
 #include <hpp/core/path.hh>
 #include <hpp/core/projection-error.hh>
+#include <hpp/core/trace.hh>
 #include <hpp/util/debug.hh>
 
 namespace hpp {
@@ -60,6 +61,7 @@ class HPP_CORE_DLLAPI SteeringMethod {
       hppDout(info, "Could not build path: " << e.what());
     }
     assert(q1 != q2 || path);
+    HPP_CORE_TRACE(STEER, path, path ? path->length() : 0);
     return path;
   }
 
@@ -59,6 +59,26 @@ class HPP_CORE_DLLAPI CarLike : public SteeringMethod {
 
   inline value_type turningRadius() const { return rho_; }
 
+  /// Set the maximal number of words tried between two configurations
+  ///
+  /// If greater than 1, the words are tried by increasing length and the
+  /// first one that is valid according to the problem path validation
+  /// is returned. If none is valid, the word with the longest valid part
+  /// is returned.
+  /// \note The result of steering then depends on
+  ///       \c problem()->pathValidation(), that is called by the steering
+  ///       method.
+  void maxWords(const size_type& n);
+
+  /// Get the maximal number of words tried between two configurations
+  inline size_type maxWords() const { return maxWords_; }
+
+  /// Set the ratio to the shortest word above which words are not tried
+  void maxWordLengthRatio(const value_type& ratio);
+
+  /// Get the ratio to the shortest word above which words are not tried
+  inline value_type maxWordLengthRatio() const { return maxWordLengthRatio_; }
+
  protected:
   /// Constructor
   CarLike(const ProblemConstPtr_t& problem);
@@ -71,6 +91,12 @@ class HPP_CORE_DLLAPI CarLike : public SteeringMethod {
   /// Copy constructor
   CarLike(const CarLike& other);
 
+  /// Return the first candidate path that is valid
+  /// \param candidates paths sorted by increasing length,
+  /// \return the candidate with the longest valid part if none is valid,
+  ///         the first candidate if the problem has no path validation.
+  PathPtr_t firstValid(const std::vector<PathPtr_t>& candidates) const;
+
   /// Store weak pointer to itself
   void init(CarLikeWkPtr_t weak) {
     core::SteeringMethod::init(weak);
@@ -83,6 +109,8 @@ class HPP_CORE_DLLAPI CarLike : public SteeringMethod {
   JointPtr_t xy_, rz_;
   size_type xyId_, rzId_;
   std::vector<JointPtr_t> wheels_;
+  size_type maxWords_;
+  value_type maxWordLengthRatio_;
 
  private:
   CarLikeWkPtr_t weak_;
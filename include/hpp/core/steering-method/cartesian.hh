@@ -0,0 +1,155 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_STEERING_METHOD_CARTESIAN_HH
+#define HPP_CORE_STEERING_METHOD_CARTESIAN_HH
+
+#include <hpp/core/config.hh>
+#include <hpp/core/fwd.hh>
+#include <hpp/core/steering-method.hh>
+#include <hpp/core/steering-method/fwd.hh>
+
+namespace hpp {
+namespace core {
+namespace steeringMethod {
+/// \addtogroup steering_method
+/// \{
+
+/// Steering method that moves a frame of the robot along a straight line
+///
+/// The pose of the frame is interpolated along the geodesic of
+/// \f$R^3\times SO(3)\f$ between a start pose and a target pose: the
+/// origin of the frame follows a straight line and its orientation rotates
+/// about a fixed axis. The interpolated pose is tracked by incremental
+/// inverse kinematics. Each waypoint is computed by Newton iterations that
+/// start from the previous waypoint and reuse the pseudo-inverse of the
+/// Jacobian as long as the error decreases fast enough. The other degrees
+/// of freedom are pulled toward a reference configuration in the kernel
+/// of the Jacobian.
+///
+/// The step along the line is halved when the inverse kinematics does not
+/// converge or when the joints move by more than a maximal step between
+/// consecutive waypoints, and doubled after each success. Waypoints are
+/// thus dense only where the joints move fast. The motion fails if the
+/// step becomes too small, which happens at joint jumps, and when the
+/// Jacobian is singular.
+///
+/// The result is an InterpolatedPath through the waypoints.
+///
+/// Parameters:
+/// \li SteeringMethod/Cartesian/Joint: name of the joint that holds the
+///     frame, when created by ProblemSolver,
+/// \li SteeringMethod/Cartesian/ErrorThreshold: error on the pose of the
+///     frame at waypoints,
+/// \li SteeringMethod/Cartesian/MaxJointStep: maximal norm of the
+///     difference between consecutive waypoints,
+/// \li SteeringMethod/Cartesian/SingularityThreshold: minimal singular
+///     value of the Jacobian of the pose of the frame.
+class HPP_CORE_DLLAPI Cartesian : public SteeringMethod {
+ public:
+  /// Create instance and return shared pointer
+  /// The joint is given by parameter SteeringMethod/Cartesian/Joint.
+  static CartesianPtr_t create(const ProblemConstPtr_t& problem);
+
+  /// Create instance and return shared pointer
+  /// \param joint joint that holds the frame,
+  /// \param frameInJoint pose of the frame in the joint.
+  static CartesianPtr_t create(const ProblemConstPtr_t& problem,
+                               const JointPtr_t& joint,
+                               const Transform3f& frameInJoint);
+
+  /// Copy instance and return shared pointer
+  static CartesianPtr_t createCopy(const CartesianPtr_t& other);
+
+  /// Copy instance and return shared pointer
+  virtual SteeringMethodPtr_t copy() const { return createCopy(weak_.lock()); }
+
+  /// Set the frame that moves along straight lines
+  /// \param joint joint that holds the frame,
+  /// \param frameInJoint pose of the frame in the joint.
+  void frame(const JointPtr_t& joint, const Transform3f& frameInJoint);
+
+  /// Get the joint that holds the frame
+  const JointPtr_t& joint() const { return joint_; }
+
+  /// Get the pose of the frame in the joint
+  const Transform3f& frameInJoint() const { return frameInJoint_; }
+
+  /// Move the frame to a pose
+  /// \param q1 initial configuration,
+  /// \param pose target pose of the frame in the world frame.
+  /// \return a path from q1 or an empty path if the motion failed.
+  ///
+  /// The other degrees of freedom are pulled toward q1.
+  PathPtr_t moveTo(ConfigurationIn_t q1, const Transform3f& pose) const;
+
+ protected:
+  /// Move the frame from its pose in q1 to its pose in q2
+  ///
+  /// The other degrees of freedom are pulled toward the straight
+  /// interpolation between q1 and q2. The motion fails if the inverse
+  /// kinematics does not end close to q2.
+  virtual PathPtr_t impl_compute(ConfigurationIn_t q1,
+                                 ConfigurationIn_t q2) const;
+
+  /// Constructor
+  Cartesian(const ProblemConstPtr_t& problem, const JointPtr_t& joint,
+            const Transform3f& frameInJoint);
+
+  /// Copy constructor
+  Cartesian(const Cartesian& other);
+
+  /// Store weak pointer to itself
+  void init(CartesianWkPtr_t weak) {
+    SteeringMethod::init(weak);
+    weak_ = weak;
+  }
+
+ private:
+  /// Track the straight line between two poses of the frame
+  /// \param q1 initial configuration,
+  /// \param target target pose of the frame as an element of
+  ///        \f$R^3\times SO(3)\f$,
+  /// \param q2 if not empty, configuration toward which the other degrees
+  ///        of freedom are pulled.
+  PathPtr_t track(ConfigurationIn_t q1, vectorIn_t target,
+                  ConfigurationIn_t q2) const;
+
+  JointPtr_t joint_;
+  Transform3f frameInJoint_;
+  /// Pose of the frame in the world frame
+  DifferentiableFunctionPtr_t pose_;
+  value_type errorThreshold_;
+  value_type maxJointStep_;
+  value_type singularityThreshold_;
+  CartesianWkPtr_t weak_;
+};  // class Cartesian
+/// \}
+}  // namespace steeringMethod
+}  // namespace core
+}  // namespace hpp
+#endif  // HPP_CORE_STEERING_METHOD_CARTESIAN_HH
@@ -37,6 +37,8 @@ HPP_PREDEF_CLASS(Straight);
 typedef shared_ptr<Straight> StraightPtr_t;
 HPP_PREDEF_CLASS(Interpolated);
 typedef shared_ptr<Interpolated> InterpolatedPtr_t;
+HPP_PREDEF_CLASS(Cartesian);
+typedef shared_ptr<Cartesian> CartesianPtr_t;
 HPP_PREDEF_CLASS(CarLike);
 typedef shared_ptr<CarLike> CarLikePtr_t;
 HPP_PREDEF_CLASS(ConstantCurvature);
@@ -126,6 +126,21 @@ PathVectorPtr_t reedsSheppPathOrDistance(
     const std::vector<JointPtr_t> wheels, ConstraintSetPtr_t constraints,
     bool computeDistance, value_type& distance);
 
+/// Create the Reeds and Shepp paths of the feasible words by increasing
+/// length
+///
+/// The words are computed once for all the paths. Callers may thus fall
+/// back on a longer word when the shortest one is in collision.
+/// \param maxNumber maximal number of paths,
+/// \param maxLengthRatio words longer than the shortest one times this
+///        ratio are discarded.
+/// Other parameters are those of reedsSheppPathOrDistance.
+std::vector<PathVectorPtr_t> reedsSheppPaths(
+    const DevicePtr_t& device, ConfigurationIn_t init, ConfigurationIn_t end,
+    value_type extraLength, value_type rho, size_type xyId, size_type rzId,
+    const std::vector<JointPtr_t> wheels, ConstraintSetPtr_t constraints,
+    size_type maxNumber, value_type maxLengthRatio);
+
 /// \}
 }  // namespace steeringMethod
 }  // namespace core
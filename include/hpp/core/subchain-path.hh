@@ -107,7 +107,28 @@ class SubchainPath : public Path {
     qout = configView_.rview(qin);
   }
 
+  /// Get the original path
+  const PathPtr_t& original() const { return original_; }
+
+  /// Get the selected configuration parameters
+  const Eigen::RowBlockIndices& configView() const { return configView_; }
+
+  /// Get the selected velocity parameters
+  const Eigen::RowBlockIndices& velocityView() const { return velView_; }
+
  protected:
+  virtual void impl_derivative(vectorOut_t result, const value_type& param,
+                               size_type order) const {
+    original_->derivative(v_, param, order);
+    result = velView_.rview(v_);
+  }
+
+  virtual void impl_velocityBound(vectorOut_t result, const value_type& param0,
+                                  const value_type& param1) const {
+    original_->velocityBound(v_, param0, param1);
+    result = velView_.rview(v_);
+  }
+
   /// Print path in a stream
   virtual std::ostream& print(std::ostream& os) const {
     os << "Dof Extracted Path:" << std::endl;
@@ -128,19 +149,26 @@ class SubchainPath : public Path {
              Eigen::BlockIndex::cardinal(velIntervals)),
         original_(original),
         configView_(confIntervals),
-        q_(Configuration_t::Zero(original->outputSize())) {}
+        velView_(velIntervals),
+        q_(Configuration_t::Zero(original->outputSize())),
+        v_(vector_t::Zero(original->outputDerivativeSize())) {}
 
   SubchainPath(const SubchainPath& path)
       : Path(path),
         original_(path.original_),
         configView_(path.configView_),
+        velView_(path.velView_),
         q_(path.q_),
+        v_(path.v_),
         weak_() {}
 
   SubchainPath(const SubchainPath& path, const ConstraintSetPtr_t& constraints)
       : Path(path, constraints),
         original_(path.original_),
         configView_(path.configView_),
+        velView_(path.velView_),
+        q_(path.q_),
+        v_(path.v_),
         weak_() {}
 
   void init(SubchainPathPtr_t self) {
@@ -152,6 +180,7 @@ class SubchainPath : public Path {
   PathPtr_t original_;
   Eigen::RowBlockIndices configView_, velView_;
   mutable Configuration_t q_;
+  mutable vector_t v_;
   SubchainPathWkPtr_t weak_;
 };  // SubchainPath
 /// \}
@@ -0,0 +1,233 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_TASK_SCHEDULER_HH
+#define HPP_CORE_TASK_SCHEDULER_HH
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <hpp/core/config.hh>
+#include <hpp/core/fwd.hh>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hpp {
+namespace core {
+/// \addtogroup parallelism
+/// \{
+
+/// Pool of worker threads executing tasks
+///
+/// Each worker owns a queue of tasks. Tasks submitted by a worker are
+/// pushed in its own queue and executed in last-in first-out order.
+/// Tasks submitted by other threads are pushed in a shared queue. A worker
+/// with no task steals the oldest task of another worker.
+///
+/// Tasks are submitted through a TaskGroup. A worker that waits for the
+/// completion of a group executes pending tasks meanwhile, so that
+/// parallel loops can be nested without creating more threads than
+/// numberThreads(). As a consequence, resources attached to a worker (see
+/// WorkerLocal) should not be used across a call to TaskGroup::wait.
+///
+/// A scheduler is shared by the process (see global()) and by default by
+/// all the Problem instances (see Problem::taskScheduler).
+class HPP_CORE_DLLAPI TaskScheduler {
+ public:
+  typedef std::function<void()> Task_t;
+
+  /// Create a scheduler
+  /// \param nbThreads number of worker threads. If 0, use the number of
+  ///        hardware threads.
+  static TaskSchedulerPtr_t create(std::size_t nbThreads = 0);
+
+  /// Get the scheduler shared by the process
+  /// It is created at first call with the number of hardware threads.
+  static TaskSchedulerPtr_t global();
+
+  /// Replace the scheduler shared by the process
+  /// \note Problem instances keep the scheduler they were created with.
+  static void global(const TaskSchedulerPtr_t& scheduler);
+
+  /// Stop the workers after completion of the pending tasks
+  ~TaskScheduler();
+
+  /// Number of worker threads
+  std::size_t numberThreads() const { return threads_.size(); }
+
+  /// Index of the worker running the calling thread
+  /// \return a value in [0, numberThreads()) if the calling thread is a
+  ///         worker of this scheduler, numberThreads() otherwise.
+  std::size_t workerIndex() const;
+
+ protected:
+  TaskScheduler(std::size_t nbThreads);
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Task_t> tasks;
+  };
+
+  /// Add a task to the queue of the calling worker or to the shared queue
+  void submit(Task_t&& task);
+  /// Execute one pending task
+  /// \param index index of the calling worker.
+  /// \return false if there was no pending task.
+  bool runOne(std::size_t index);
+  /// Main loop of the workers
+  void work(std::size_t index);
+
+  std::vector<std::unique_ptr<Worker> > workers_;
+  /// Tasks submitted by threads that are not workers
+  std::deque<Task_t> shared_;
+  /// Protects shared_ and stop_
+  std::mutex mutex_;
+  std::condition_variable wakeUp_;
+  /// Number of tasks in the queues
+  std::atomic<std::size_t> nbPending_;
+  bool stop_;
+  std::vector<std::thread> threads_;
+
+  friend class TaskGroup;
+};  // class TaskScheduler
+
+/// Set of tasks that can be waited for and cancelled together
+///
+/// \code
+/// TaskGroup group(problem->taskScheduler());
+/// group.parallelFor(0, n, [&](std::size_t i) { results[i] = f(i); });
+/// group.wait();
+/// \endcode
+///
+/// If a task throws, the group is cancelled and wait rethrows the first
+/// exception. Tasks that did not start when the group is cancelled are not
+/// executed. Running tasks may poll isCancelled to stop early.
+class HPP_CORE_DLLAPI TaskGroup {
+ public:
+  TaskGroup(const TaskSchedulerPtr_t& scheduler);
+
+  /// Wait for the completion of the tasks
+  /// Exceptions are not rethrown: call wait before destruction to
+  /// retrieve them.
+  ~TaskGroup();
+
+  /// Get the scheduler
+  const TaskSchedulerPtr_t& scheduler() const { return scheduler_; }
+
+  /// Submit a task
+  void run(TaskScheduler::Task_t task);
+
+  /// Call body(i) for i in [begin, end)
+  /// \param maxTasks maximal number of tasks among which the indices are
+  ///        distributed. If 0, use the number of threads of the scheduler.
+  /// \note The indices are not processed in order.
+  void parallelFor(std::size_t begin, std::size_t end,
+                   const std::function<void(std::size_t)>& body,
+                   std::size_t maxTasks = 0);
+
+  /// Distribute the indices of [begin, end) among tasks
+  ///
+  /// Each of the nbTasks tasks calls body(task, i) with its rank \c task
+  /// in [0, nbTasks) for the indices it takes, in increasing order. This
+  /// enables each task to own resources that are not thread safe.
+  void distribute(std::size_t nbTasks, std::size_t begin, std::size_t end,
+                  const std::function<void(std::size_t, std::size_t)>& body);
+
+  /// Wait for the completion of the tasks
+  /// \throw the first exception thrown by a task, if any.
+  void wait();
+
+  /// Cancel the tasks that did not start
+  void cancel() { cancelled_ = true; }
+
+  /// Whether the group has been cancelled
+  bool isCancelled() const { return cancelled_; }
+
+ private:
+  /// Wait without rethrowing exceptions
+  void join();
+
+  TaskSchedulerPtr_t scheduler_;
+  std::atomic<std::size_t> nbRunning_;
+  std::atomic<bool> cancelled_;
+  std::mutex mutex_;
+  std::condition_variable done_;
+  std::exception_ptr error_;
+};  // class TaskGroup
+
+/// Storage owned by each worker of a scheduler
+///
+/// Useful for scratch memory of tasks. Objects are constructed on first
+/// access by a worker. Each thread that is not a worker of the scheduler
+/// owns an object as well.
+/// \tparam T type of the stored objects.
+template <typename T>
+class WorkerLocal {
+ public:
+  /// Constructor
+  /// \param scheduler the scheduler,
+  /// \param init function that constructs the object of a worker.
+  WorkerLocal(const TaskSchedulerPtr_t& scheduler,
+              const std::function<T()>& init = []() { return T(); })
+      : scheduler_(scheduler),
+        init_(init),
+        values_(scheduler->numberThreads()) {}
+
+  /// Get the object of the calling thread
+  T& local() {
+    const std::size_t index(scheduler_->workerIndex());
+    if (index < values_.size()) {
+      std::unique_ptr<T>& value(values_[index]);
+      if (!value) value.reset(new T(init_()));
+      return *value;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_ptr<T>& value(others_[std::this_thread::get_id()]);
+    if (!value) value.reset(new T(init_()));
+    return *value;
+  }
+
+ private:
+  TaskSchedulerPtr_t scheduler_;
+  std::function<T()> init_;
+  /// Objects of the workers, indexed by worker
+  std::vector<std::unique_ptr<T> > values_;
+  /// Objects of the other threads
+  std::map<std::thread::id, std::unique_ptr<T> > others_;
+  /// Protects others_
+  std::mutex mutex_;
+};  // class WorkerLocal
+/// \}
+}  // namespace core
+}  // namespace hpp
+#endif  // HPP_CORE_TASK_SCHEDULER_HH
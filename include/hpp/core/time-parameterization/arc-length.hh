@@ -0,0 +1,117 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_TIME_PARAMETERIZATION_ARC_LENGTH_HH
+#define HPP_CORE_TIME_PARAMETERIZATION_ARC_LENGTH_HH
+
+#include <hpp/core/config.hh>
+#include <hpp/core/fwd.hh>
+#include <hpp/core/time-parameterization.hh>
+#include <vector>
+
+namespace hpp {
+namespace core {
+namespace timeParameterization {
+/// Parameterization of a path by its length
+///
+/// The length of a path under a Distance, from the beginning of its time
+/// range, is tabulated at increasing times. The table is inverted by
+/// linear interpolation: \ref value maps a length in
+/// \f$ [0, L] \f$, where \f$ L \f$ is the \ref length of the path, to a
+/// time of the path.
+///
+/// Intervals of time are split in halves until the lengths of both halves
+/// differ by less than a tolerance. The speed of the path is then nearly
+/// constant between consecutive samples, and parts of the path with
+/// constant speed are covered by few samples. Intervals where the path does
+/// not move are skipped: \ref value jumps over them.
+class HPP_CORE_DLLAPI ArcLength : public TimeParameterization {
+ public:
+  /// Tabulate the length of a path
+  /// \param path the path,
+  /// \param distance distance that measures the length,
+  /// \param tolerance tolerance on the difference of length of the two
+  ///        halves of each interval, relative to the length of the path.
+  /// \return NULL if the path fails to project one of the sampled
+  ///         configurations.
+  static ArcLengthPtr_t create(const PathPtr_t& path,
+                               const DistancePtr_t& distance,
+                               const value_type& tolerance = 1e-2);
+
+  /// Time of the path where its length reaches s
+  value_type value(const value_type& s) const;
+
+  /// Derivative of the time with respect to the length
+  /// Derivatives of order greater than 1 are 0.
+  value_type derivative(const value_type& s, const size_type& order) const;
+
+  /// Upper bound of the derivative on \f$ [ low, up ] \f$
+  value_type derivativeBound(const value_type& low,
+                             const value_type& up) const;
+
+  TimeParameterizationPtr_t copy() const {
+    return TimeParameterizationPtr_t(new ArcLength(*this));
+  }
+
+  /// Length of the path
+  value_type length() const { return lengths_.back(); }
+
+  /// Length of the path at a given time
+  value_type lengthAtTime(const value_type& t) const;
+
+  /// Number of samples of the table
+  std::size_t size() const { return times_.size(); }
+
+  /// Distance that measures the length
+  const DistancePtr_t& distance() const { return distance_; }
+
+ private:
+  ArcLength(const DistancePtr_t& distance) : distance_(distance) {}
+
+  /// \return false if the path fails to project a configuration.
+  bool tabulate(const PathPtr_t& path, const Distance& distance,
+                const value_type& t0, ConfigurationIn_t q0,
+                const value_type& t1, ConfigurationIn_t q1,
+                const value_type& tolerance, size_type depth);
+
+  /// Index of the interval of the table that contains x
+  /// \param x value to search for,
+  /// \param values increasing lengths_ or times_.
+  static std::size_t interval(const value_type& x,
+                              const std::vector<value_type>& values);
+
+  /// Slope of the time with respect to the length on interval i
+  value_type slope(std::size_t i) const;
+
+  DistancePtr_t distance_;
+  std::vector<value_type> lengths_;
+  std::vector<value_type> times_;
+};  // class ArcLength
+}  // namespace timeParameterization
+}  //   namespace core
+}  // namespace hpp
+#endif  // HPP_CORE_TIME_PARAMETERIZATION_ARC_LENGTH_HH
@@ -0,0 +1,139 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_TRACE_HH
+#define HPP_CORE_TRACE_HH
+
+#include <cstdint>
+#include <hpp/core/config.hh>
+#include <hpp/core/fwd.hh>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace hpp {
+namespace core {
+/// \addtogroup path_planning
+/// \{
+
+/// Low overhead recording of planner events
+///
+/// Events are stored in a ring buffer owned by the recording thread, so that
+/// recording neither allocates (except for the first event of a thread) nor
+/// locks. When the buffer of a thread is full, its oldest events are
+/// overwritten.
+///
+/// Recording is enabled at compile time by the CMake option
+/// HPP_CORE_ENABLE_TRACE. When disabled, macro HPP_CORE_TRACE expands to
+/// nothing and its arguments are not evaluated.
+///
+/// Buffers can be written to a compact binary file with trace::dump and
+/// read back with trace::load for offline analysis.
+namespace trace {
+enum Event {
+  /// A configuration was sampled.
+  SAMPLE = 0,
+  /// A nearest neighbor was searched. The value is the distance.
+  NEAREST,
+  /// A path was computed by a steering method. The value is its length.
+  STEER,
+  /// A path was projected. The value is the length of the input path.
+  PROJECT,
+  /// A path was validated. The value is the length of the input path.
+  VALIDATE,
+  /// A node was added to a roadmap.
+  ADD_NODE,
+  /// An edge was added to a roadmap. The value is the length of its path.
+  ADD_EDGE,
+  /// A path optimizer iteration ended. The value is the iteration number.
+  OPTIMIZER_STEP,
+  NB_EVENTS
+};
+
+/// An event as stored in the buffers and in the binary files.
+struct Record {
+  /// Nanoseconds since the first use of the recorder in the process.
+  std::uint64_t time;
+  /// Rank of the recording thread, in order of first record.
+  std::uint32_t thread;
+  /// Event type (see trace::Event).
+  std::uint8_t event;
+  /// Whether the operation succeeded.
+  std::uint8_t success;
+  std::uint16_t reserved;
+  /// Event specific value.
+  double value;
+};
+
+/// Number of records kept per thread (a power of two).
+static const std::size_t bufferSize = 1 << 16;
+
+/// Name of an event
+HPP_CORE_DLLAPI const char* eventName(std::uint8_t event);
+
+/// Record an event in the buffer of the calling thread.
+///
+/// \note Prefer macro HPP_CORE_TRACE that is compiled out when tracing is
+///       disabled.
+HPP_CORE_DLLAPI void record(Event event, bool success, double value);
+
+/// Copy the events of all threads, sorted by time.
+///
+/// \warning Threads should not record while this function is running.
+HPP_CORE_DLLAPI std::vector<Record> records();
+
+/// Remove all recorded events.
+///
+/// \warning Threads should not record while this function is running.
+HPP_CORE_DLLAPI void clear();
+
+/// Write the events of all threads in a binary file.
+/// \return whether the file could be written.
+HPP_CORE_DLLAPI bool dump(const std::string& filename);
+
+/// Read events written by trace::dump.
+/// \return whether the file could be read.
+HPP_CORE_DLLAPI bool load(const std::string& filename,
+                          std::vector<Record>& records);
+
+/// Print events in a human readable format, one per line.
+HPP_CORE_DLLAPI std::ostream& replay(std::ostream& os,
+                                     const std::vector<Record>& records);
+}  // namespace trace
+/// \}
+}  // namespace core
+}  // namespace hpp
+
+#ifdef HPP_CORE_ENABLE_TRACE
+#define HPP_CORE_TRACE(event, success, value)                           \
+  ::hpp::core::trace::record(::hpp::core::trace::event, (bool)(success), \
+                             (double)(value))
+#else
+#define HPP_CORE_TRACE(event, success, value) ((void)0)
+#endif
+
+#endif  // HPP_CORE_TRACE_HH
@@ -63,6 +63,38 @@ class HPP_CORE_DLLAPI WeighedDistance : public Distance {
   /// Get size of weight vector
   size_type size() const { return weights_.size(); }
 
+  /// \name Calibration of the weights
+  /// \{
+
+  /// Fit the weights to the motion of the robot geometry
+  ///
+  /// For each sample, a random configuration is shot and each joint is
+  /// moved alone by a small random step. The displacement of the
+  /// bounding sphere of every body of the subtree of the joint is
+  /// computed by forward kinematics and the largest one is kept. The
+  /// weight of the joint is the least square fit of the ratio between
+  /// this displacement and the norm of the step.
+  /// \param nbSamples number of random configurations,
+  /// \param step norm of the motion applied to each joint.
+  void calibrate(size_type nbSamples, value_type step = 1e-3);
+
+  /// Load the weights from a file or calibrate and save them
+  /// \return true if the file was used.
+  /// \sa calibrate, load, save
+  bool calibrateOrLoad(const std::string& filename, size_type nbSamples);
+
+  /// Write the weights in a binary file
+  void save(const std::string& filename) const;
+
+  /// Read the weights from a binary file
+  /// \return false if the file does not exist, cannot be read or was
+  ///         written for another robot model. The joint names, the joint placements and the
+  ///         placements and bounding radii of the geometries of the robot
+  ///         are compared to those stored in the file.
+  bool load(const std::string& filename);
+
+  /// \}
+
   /// Get robot
   const DevicePtr_t& robot() const { return robot_; }
 
@@ -80,6 +112,10 @@ class HPP_CORE_DLLAPI WeighedDistance : public Distance {
 
  private:
   void computeWeights();
+  /// Robot name and joint names the weights depend on
+  std::vector<std::string> key() const;
+  /// Joint and geometry placements and bounding radii the weights depend on
+  std::vector<value_type> geometryKey() const;
   DevicePtr_t robot_;
   vector_t weights_;
   WeighedDistanceWkPtr_t weak_;
@@ -0,0 +1,111 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <cmath>
+#include <hpp/core/arc-length-path.hh>
+#include <hpp/core/time-parameterization/arc-length.hh>
+#include <hpp/util/indent.hh>
+
+namespace hpp {
+namespace core {
+ArcLengthPathPtr_t ArcLengthPath::create(const PathPtr_t& original,
+                                         const DistancePtr_t& distance,
+                                         const value_type& tolerance) {
+  timeParameterization::ArcLengthPtr_t arcLength(
+      timeParameterization::ArcLength::create(original, distance, tolerance));
+  if (!arcLength) return ArcLengthPathPtr_t();
+  ArcLengthPath* ptr = new ArcLengthPath(original, arcLength);
+  ArcLengthPathPtr_t shPtr(ptr);
+  ptr->init(shPtr);
+  return shPtr;
+}
+
+ArcLengthPathPtr_t ArcLengthPath::createCopy(const ArcLengthPathPtr_t& path) {
+  ArcLengthPath* ptr = new ArcLengthPath(*path);
+  ArcLengthPathPtr_t shPtr(ptr);
+  ptr->init(shPtr);
+  return shPtr;
+}
+
+ArcLengthPathPtr_t ArcLengthPath::createCopy(
+    const ArcLengthPathPtr_t& path, const ConstraintSetPtr_t& constraints) {
+  ArcLengthPath* ptr = new ArcLengthPath(*path, constraints);
+  ArcLengthPathPtr_t shPtr(ptr);
+  ptr->init(shPtr);
+  return shPtr;
+}
+
+ArcLengthPath::ArcLengthPath(
+    const PathPtr_t& original,
+    const timeParameterization::ArcLengthPtr_t& arcLength)
+    : Path(interval_t(0, arcLength->length()), original->outputSize(),
+           original->outputDerivativeSize(), original->constraints()),
+      original_(original),
+      arcLength_(arcLength) {}
+
+ArcLengthPath::ArcLengthPath(const ArcLengthPath& path)
+    : Path(path), original_(path.original_), arcLength_(path.arcLength_) {}
+
+ArcLengthPath::ArcLengthPath(const ArcLengthPath& path,
+                             const ConstraintSetPtr_t& constraints)
+    : Path(path, constraints),
+      original_(path.original_),
+      arcLength_(path.arcLength_) {}
+
+void ArcLengthPath::init(ArcLengthPathPtr_t self) {
+  parent_t::init(self);
+  weak_ = self;
+}
+
+std::ostream& ArcLengthPath::print(std::ostream& os) const {
+  Path::print(os << "ArcLengthPath:") << incendl;
+  os << "samples: " << arcLength_->size() << iendl;
+  os << "original path: " << *original_;
+  return os << decindent;
+}
+
+bool ArcLengthPath::impl_compute(ConfigurationOut_t result,
+                                 value_type param) const {
+  return original_->at(arcLength_->value(param), result);
+}
+
+void ArcLengthPath::impl_derivative(vectorOut_t result,
+                                    const value_type& param,
+                                    size_type order) const {
+  original_->derivative(result, arcLength_->value(param), order);
+  result *= std::pow(arcLength_->derivative(param, 1), (value_type)order);
+}
+
+void ArcLengthPath::impl_velocityBound(vectorOut_t result,
+                                       const value_type& param0,
+                                       const value_type& param1) const {
+  original_->velocityBound(result, arcLength_->value(param0),
+                           arcLength_->value(param1));
+  result *= arcLength_->derivativeBound(param0, param1);
+}
+}  //   namespace core
+}  // namespace hpp
@@ -36,13 +36,19 @@
 #include <hpp/core/fwd.hh>
 #include <hpp/core/node.hh>
 #include <hpp/core/path-vector.hh>
+#include <algorithm>
 #include <limits>
+#include <set>
+#include <vector>
 
 namespace hpp {
 namespace core {
 class HPP_CORE_LOCAL Astar {
-  typedef std::list<NodePtr_t> Nodes_t;
+ public:
   typedef std::list<EdgePtr_t> Edges_t;
+
+ private:
+  typedef std::list<NodePtr_t> Nodes_t;
   typedef std::map<NodePtr_t, EdgePtr_t> Parent_t;
   Nodes_t closed_;
   Nodes_t open_;
@@ -51,12 +57,44 @@ class HPP_CORE_LOCAL Astar {
   Parent_t parent_;
   RoadmapPtr_t roadmap_;
   DistancePtr_t distance_;
+  const std::set<EdgePtr_t>* ignoredEdges_;
+  NodePtr_t start_;
+  NodeVector_t goals_;
+  /// Whether the sets and costs of a previous search can be reused
+  bool searched_;
+  /// Number of nodes expanded by the last call to findPath
+  std::size_t numberExpanded_;
 
  public:
-  Astar(const RoadmapPtr_t& roadmap, const DistancePtr_t distance)
-      : roadmap_(roadmap), distance_(distance) {}
+  /// Constructor
+  /// \param ignoredEdges if not NULL, edges that are not explored.
+  Astar(const RoadmapPtr_t& roadmap, const DistancePtr_t distance,
+        const std::set<EdgePtr_t>* ignoredEdges = NULL)
+      : roadmap_(roadmap),
+        distance_(distance),
+        ignoredEdges_(ignoredEdges),
+        start_(roadmap->initNode()),
+        goals_(roadmap->goalNodes()),
+        searched_(false),
+        numberExpanded_(0) {}
 
-  void solution(PathVectorPtr_t sol) {
+  /// Constructor for a search between given nodes
+  ///
+  /// The roadmap is only read, so that several searches with different
+  /// start and goal nodes can run concurrently on the same roadmap.
+  Astar(const RoadmapPtr_t& roadmap, const DistancePtr_t distance,
+        const NodePtr_t& start, const NodeVector_t& goals)
+      : roadmap_(roadmap),
+        distance_(distance),
+        ignoredEdges_(NULL),
+        start_(start),
+        goals_(goals),
+        searched_(false),
+        numberExpanded_(0) {}
+
+  /// Compute the edges of the shortest path to a goal node
+  /// \throw std::runtime_error if no goal node can be reached.
+  Edges_t solutionEdges() {
     NodePtr_t node = findPath();
     Edges_t edges;
 
@@ -69,6 +107,76 @@ class HPP_CORE_LOCAL Astar {
       } else
         node = NodePtr_t(0x0);
     }
+    return edges;
+  }
+
+  /// Update the search after edges have been inserted in the set of
+  /// ignored edges.
+  ///
+  /// Removing edges can only increase the costs from the start. The nodes
+  /// reached through the removed edges, and the nodes reached through
+  /// them, are removed from the search. They are opened again from the
+  /// remaining expanded nodes, so that the next search resumes from there
+  /// instead of starting again from the start node.
+  /// \param edges edges already inserted in the set of ignored edges.
+  void removeEdges(const std::vector<EdgePtr_t>& edges) {
+    if (!searched_) return;
+    // Nodes whose cost from start goes through one of the edges
+    std::set<NodePtr_t> removed;
+    std::vector<NodePtr_t> stack;
+    for (const EdgePtr_t& edge : edges) {
+      Parent_t::const_iterator it(parent_.find(edge->to()));
+      if (it != parent_.end() && it->second == edge)
+        stack.push_back(edge->to());
+    }
+    while (!stack.empty()) {
+      NodePtr_t node(stack.back());
+      stack.pop_back();
+      if (!removed.insert(node).second) continue;
+      for (const EdgePtr_t& edge : node->outEdges()) {
+        Parent_t::const_iterator it(parent_.find(edge->to()));
+        if (it != parent_.end() && it->second == edge)
+          stack.push_back(edge->to());
+      }
+    }
+    for (const NodePtr_t& node : removed) {
+      closed_.remove(node);
+      open_.remove(node);
+      parent_.erase(node);
+      costFromStart_.erase(node);
+      estimatedCostToGoal_.erase(node);
+    }
+    // Open the removed nodes again from the remaining expanded nodes.
+    for (const NodePtr_t& node : removed) {
+      for (const EdgePtr_t& edge : node->inEdges()) {
+        if (isClosed(edge->from())) relax(edge->from(), edge);
+      }
+    }
+  }
+
+  /// Update the search after an edge has been added to the roadmap
+  ///
+  /// If the edge decreases the cost of an expanded node, the next search
+  /// starts again from the start node.
+  void addEdge(const EdgePtr_t& edge) {
+    if (!searched_ || !isClosed(edge->from())) return;
+    const NodePtr_t& child(edge->to());
+    if (isClosed(child) && costFromStart_[edge->from()] + edgeCost(edge) <
+                               costFromStart_[child]) {
+      searched_ = false;
+      return;
+    }
+    relax(edge->from(), edge);
+  }
+
+  /// Discard the state of the previous search
+  void reset() { searched_ = false; }
+
+  /// Number of nodes expanded by the last search
+  std::size_t numberExpanded() const { return numberExpanded_; }
+
+  void solution(PathVectorPtr_t sol) {
+    Edges_t edges(solutionEdges());
     for (Edges_t::const_iterator itEdge = edges.begin(); itEdge != edges.end();
          ++itEdge) {
       const PathPtr_t& path((*itEdge)->path());
@@ -86,8 +194,8 @@ class HPP_CORE_LOCAL Astar {
   };  // struc SortFunctor
 
   bool isGoal(const NodePtr_t node) {
-    for (NodeVector_t::const_iterator itGoal = roadmap_->goalNodes().begin();
-         itGoal != roadmap_->goalNodes().end(); ++itGoal) {
+    for (NodeVector_t::const_iterator itGoal = goals_.begin();
+         itGoal != goals_.end(); ++itGoal) {
       if (*itGoal == node) {
         return true;
       }
@@ -95,14 +203,44 @@ class HPP_CORE_LOCAL Astar {
     return false;
   }
 
-  NodePtr_t findPath() {
-    closed_.clear();
-    open_.clear();
-    parent_.clear();
-    estimatedCostToGoal_.clear();
-    costFromStart_.clear();
+  bool isClosed(const NodePtr_t& node) const {
+    return std::find(closed_.begin(), closed_.end(), node) != closed_.end();
+  }
 
-    open_.push_back(roadmap_->initNode());
+  /// Update the cost of the child of edge from an expanded node
+  void relax(const NodePtr_t& current, const EdgePtr_t& edge) {
+    if (ignoredEdges_ && ignoredEdges_->count(edge)) return;
+    value_type transitionCost = edgeCost(edge);
+    NodePtr_t child(edge->to());
+    if (isClosed(child)) return;
+    value_type tmpCost = costFromStart_[current] + transitionCost;
+    bool childNotInOpenSet =
+        (std::find(open_.begin(), open_.end(), child) == open_.end());
+    if ((childNotInOpenSet) || (tmpCost < costFromStart_[child])) {
+      parent_[child] = edge;
+      costFromStart_[child] = tmpCost;
+      estimatedCostToGoal_[child] = costFromStart_[child] + heuristic(child);
+      if (childNotInOpenSet) open_.push_back(child);
+    }
+  }
+
+  /// Run the search, resuming the previous one if possible
+  ///
+  /// The goal node returned by a search stays in the open set, so that a
+  /// search resumed without any change returns it again.
+  NodePtr_t findPath() {
+    numberExpanded_ = 0;
+    if (!searched_) {
+      closed_.clear();
+      open_.clear();
+      parent_.clear();
+      estimatedCostToGoal_.clear();
+      costFromStart_.clear();
+      open_.push_back(start_);
+      costFromStart_[start_] = 0;
+      estimatedCostToGoal_[start_] = heuristic(start_);
+      searched_ = true;
+    }
     while (!open_.empty()) {
       open_.sort(SortFunctor(estimatedCostToGoal_));
       Nodes_t::iterator itv = open_.begin();
@@ -112,23 +250,10 @@ class HPP_CORE_LOCAL Astar {
       }
       open_.erase(itv);
       closed_.push_back(current);
+      ++numberExpanded_;
       for (Edges_t::const_iterator itEdge = current->outEdges().begin();
            itEdge != current->outEdges().end(); ++itEdge) {
-        value_type transitionCost = edgeCost(*itEdge);
-        NodePtr_t child((*itEdge)->to());
-        if (std::find(closed_.begin(), closed_.end(), child) == closed_.end()) {
-          // node is not in closed set
-          value_type tmpCost = costFromStart_[current] + transitionCost;
-          bool childNotInOpenSet =
-              (std::find(open_.begin(), open_.end(), child) == open_.end());
-          if ((childNotInOpenSet) || (tmpCost < costFromStart_[child])) {
-            parent_[child] = *itEdge;
-            costFromStart_[child] = tmpCost;
-            estimatedCostToGoal_[child] =
-                costFromStart_[child] + heuristic(child);
-            if (childNotInOpenSet) open_.push_back(child);
-          }
-        }
+        relax(current, *itEdge);
       }
     }
     throw std::runtime_error("A* failed to find a solution to the goal.");
@@ -137,8 +262,8 @@ class HPP_CORE_LOCAL Astar {
   value_type heuristic(const NodePtr_t node) const {
     const ConfigurationPtr_t config = node->configuration();
     value_type res = std::numeric_limits<value_type>::infinity();
-    for (NodeVector_t::const_iterator itGoal = roadmap_->goalNodes().begin();
-         itGoal != roadmap_->goalNodes().end(); ++itGoal) {
+    for (NodeVector_t::const_iterator itGoal = goals_.begin();
+         itGoal != goals_.end(); ++itGoal) {
       ConfigurationPtr_t goal = (*itGoal)->configuration();
       value_type dist = (*distance_)(*config, *goal);
       if (dist < res) {
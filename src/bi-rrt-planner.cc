@@ -27,6 +27,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
 // DAMAGE.
 
+#include <Eigen/SVD>
 #include <hpp/core/bi-rrt-planner.hh>
 #include <hpp/core/config-projector.hh>
 #include <hpp/core/configuration-shooter.hh>
@@ -37,8 +38,10 @@
 #include <hpp/core/problem.hh>
 #include <hpp/core/roadmap.hh>
 #include <hpp/core/steering-method.hh>
+#include <hpp/core/trace.hh>
 #include <hpp/pinocchio/configuration.hh>
 #include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/liegroup.hh>
 #include <hpp/util/debug.hh>
 
 namespace hpp {
@@ -59,13 +62,15 @@ BiRRTPlannerPtr_t BiRRTPlanner::create(const ProblemConstPtr_t& problem) {
 BiRRTPlanner::BiRRTPlanner(const ProblemConstPtr_t& problem)
     : PathPlanner(problem),
       configurationShooter_(problem->configurationShooter()),
-      qProj_(problem->robot()->configSize()) {}
+      qProj_(problem->robot()->configSize()),
+      atlas_(false) {}
 
 BiRRTPlanner::BiRRTPlanner(const ProblemConstPtr_t& problem,
                            const RoadmapPtr_t& roadmap)
     : PathPlanner(problem, roadmap),
       configurationShooter_(problem->configurationShooter()),
-      qProj_(problem->robot()->configSize()) {}
+      qProj_(problem->robot()->configSize()),
+      atlas_(false) {}
 
 void BiRRTPlanner::init(const BiRRTPlannerWkPtr_t& weak) {
   PathPlanner::init(weak);
@@ -80,6 +85,8 @@ PathPtr_t BiRRTPlanner::extendInternal(const SteeringMethodPtr_t& sm,
   const ConstraintSetPtr_t& constraints(sm->constraints());
   if (constraints) {
     ConfigProjectorPtr_t configProjector(constraints->configProjector());
+    if (atlas_ && configProjector)
+      return extendInAtlas(sm, qProj_, near, target, reverse);
     if (configProjector) {
       configProjector->projectOnKernel(*(near->configuration()), target,
                                        qProj_);
@@ -97,9 +104,80 @@ PathPtr_t BiRRTPlanner::extendInternal(const SteeringMethodPtr_t& sm,
                  : (*sm)(*(near->configuration()), target);
 }
 
+BiRRTPlanner::Chart& BiRRTPlanner::chart(ConfigProjector& configProjector,
+                                          const NodePtr_t& node) {
+  Charts_t::iterator it(charts_.find(node));
+  if (it != charts_.end()) return it->second;
+
+  Chart& c(charts_[node]);
+  c.radius =
+      problem()->getParameter("BiRRTPlanner/Atlas/ChartRadius").floatValue();
+  const size_type nFree(configProjector.numberFreeVariables());
+  if (configProjector.dimension() == 0) {
+    c.basis.setIdentity(nFree, nFree);
+    return c;
+  }
+  vector_t value(configProjector.solver().dimension());
+  matrix_t J(configProjector.dimension(), nFree);
+  configProjector.computeValueAndJacobian(*node->configuration(), value, J);
+  Eigen::JacobiSVD<matrix_t> svd(J, Eigen::ComputeFullV);
+  const size_type rank(svd.rank());
+  c.basis = svd.matrixV().rightCols(nFree - rank);
+  hppDout(info, "New chart of dimension " << c.basis.cols());
+  return c;
+}
+
+PathPtr_t BiRRTPlanner::extendInAtlas(const SteeringMethodPtr_t& sm,
+                                      Configuration_t& qProj_,
+                                      const NodePtr_t& near,
+                                      const Configuration_t& target,
+                                      bool reverse) {
+  static const value_type minRadius = 1e-3;
+  const ConstraintSetPtr_t& constraints(sm->constraints());
+  ConfigProjectorPtr_t configProjector(constraints->configProjector());
+  DevicePtr_t robot(problem()->robot());
+  const Configuration_t& q0(*near->configuration());
+  Chart& c(chart(*configProjector, near));
+  if (c.basis.cols() == 0) return PathPtr_t();
+
+  // Project the direction toward target onto the chart and bound the step
+  // by the chart radius.
+  dq_.resize(robot->numberDof());
+  dqSmall_.resize(configProjector->numberFreeVariables());
+  pinocchio::difference<pinocchio::RnxSOnLieGroupMap>(robot, target, q0, dq_);
+  configProjector->compressVector(dq_, dqSmall_);
+  vector_t w(c.basis.transpose() * dqSmall_);
+  const value_type norm(w.norm());
+  if (norm < Eigen::NumTraits<value_type>::dummy_precision())
+    return PathPtr_t();
+  if (norm > c.radius) w *= c.radius / norm;
+  dqSmall_.noalias() = c.basis * w;
+  dq_.setZero();
+  configProjector->uncompressVector(dqSmall_, dq_);
+  qTangent_.resize(robot->configSize());
+  pinocchio::integrate<false, pinocchio::RnxSOnLieGroupMap>(robot, q0, dq_,
+                                                            qTangent_);
+
+  // Project the short step back onto the constraints.
+  qProj_ = qTangent_;
+  if (!constraints->apply(qProj_)) {
+    if (c.radius > minRadius) c.radius /= 2;
+    return PathPtr_t();
+  }
+  // A large deviation means that the chart is too large for the curvature
+  // of the constraints at this node.
+  pinocchio::difference<pinocchio::RnxSOnLieGroupMap>(robot, qProj_, qTangent_,
+                                                      dq_);
+  if (dq_.norm() > .5 * std::min(norm, c.radius) && c.radius > minRadius)
+    c.radius /= 2;
+  return reverse ? (*sm)(qProj_, q0) : (*sm)(q0, qProj_);
+}
+
 /// One step of extension.
 void BiRRTPlanner::startSolve() {
   PathPlanner::startSolve();
+  atlas_ = problem()->getParameter("BiRRTPlanner/Atlas").boolValue();
+  charts_.clear();
   startComponent_ = roadmap()->initNode()->connectedComponent();
   for (NodeVector_t::const_iterator cit = roadmap()->goalNodes().begin();
        cit != roadmap()->goalNodes().end(); ++cit) {
@@ -117,12 +195,14 @@ void BiRRTPlanner::oneStep() {
   // first try to connect to start component
   Configuration_t q_rand;
   configurationShooter_->shoot(q_rand);
+  HPP_CORE_TRACE(SAMPLE, true, 0);
   near = roadmap()->nearestNode(q_rand, startComponent_, distance);
   path = extendInternal(problem()->steeringMethod(), qProj_, near, q_rand);
   if (path) {
     PathValidationReportPtr_t report;
     pathValidFromStart =
         pathValidation->validate(path, false, validPath, report);
+    HPP_CORE_TRACE(VALIDATE, pathValidFromStart, path->length());
     if (validPath) {
       // Insert new path to q_near in roadmap
       value_type t_final = validPath->timeRange().second;
@@ -170,5 +250,18 @@ void BiRRTPlanner::oneStep() {
     }
   }
 }
+
+HPP_START_PARAMETER_DECLARATION(BiRRTPlanner)
+Problem::declareParameter(ParameterDescription(
+    Parameter::BOOL, "BiRRTPlanner/Atlas",
+    "Extend in the tangent space of the constraints at the nearest node "
+    "instead of projecting the random configuration.",
+    Parameter(false)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "BiRRTPlanner/Atlas/ChartRadius",
+    "Initial radius of the charts, i.e. maximal length of an extension "
+    "step in the tangent space.",
+    Parameter(0.5)));
+HPP_END_PARAMETER_DECLARATION(BiRRTPlanner)
 }  // namespace core
 }  // namespace hpp
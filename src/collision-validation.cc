@@ -29,6 +29,10 @@
 
 #include <hpp/fcl/collision.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include <hpp/core/collision-validation-report.hh>
 #include <hpp/core/collision-validation.hh>
 #include <hpp/core/relative-motion.hh>
@@ -57,8 +61,11 @@ bool CollisionValidation::validate(const Configuration_t& config,
   const CollisionPairs_t* pairs(&cPairs_);
   CollisionRequests_t* requests(&cRequests_);
 
-  bool collide = ObstacleUser::collide(cPairs_, cRequests_, collisionResult,
-                                       iPair, device.d());
+  bool collide =
+      distanceField_
+          ? collideWithField(collisionResult, iPair, device.d())
+          : ObstacleUser::collide(cPairs_, cRequests_, collisionResult, iPair,
+                                  device.d());
   if (!collide && checkParameterized_) {
     collide = ObstacleUser::collide(pPairs_, pRequests_, collisionResult, iPair,
                                     device.d());
@@ -94,6 +101,50 @@ bool CollisionValidation::validate(const Configuration_t& config,
   return true;
 }
 
+void CollisionValidation::distanceField(const DistanceFieldPtr_t& field) {
+  distanceField_ = field;
+  fieldObjects_.clear();
+  spheres_.clear();
+  fieldObstacles_.clear();
+  if (!field) return;
+  const std::vector<std::string>& names(field->obstacleNames());
+  for (const CollisionPair& pair : cPairs_) {
+    if (std::find(names.begin(), names.end(), pair.second->name()) ==
+        names.end())
+      continue;
+    fieldObstacles_.insert(pair.second);
+    if (fieldObjects_.count(pair.first) == 0) {
+      fieldObjects_[pair.first] = spheres_.size();
+      spheres_.push_back(DistanceField::sphereDecomposition(pair.first));
+    }
+  }
+}
+
+bool CollisionValidation::collideWithField(fcl::CollisionResult& result,
+                                           std::size_t& iPair,
+                                           pinocchio::DeviceData& data) {
+  // Lower bound of the distance to the field, computed once per object,
+  // NaN until then. Instances are shared between threads: each thread
+  // reuses its own buffer.
+  thread_local std::vector<value_type> clearance;
+  clearance.assign(spheres_.size(),
+                   std::numeric_limits<value_type>::quiet_NaN());
+  for (iPair = 0; iPair < cPairs_.size(); ++iPair) {
+    const CollisionPair& pair(cPairs_[iPair]);
+    auto object = fieldObjects_.find(pair.first);
+    if (object != fieldObjects_.end() && fieldObstacles_.count(pair.second)) {
+      value_type& c(clearance[object->second]);
+      if (std::isnan(c))
+        c = distanceField_->distanceLowerBound(spheres_[object->second],
+                                               pair.first->getTransform(data));
+      if (c > cRequests_[iPair].security_margin) continue;
+    }
+    result.clear();
+    if (pair.collide(data, cRequests_[iPair], result) != 0) return true;
+  }
+  return false;
+}
+
 CollisionValidation::CollisionValidation(const DevicePtr_t& robot)
     : ObstacleUser(robot),
       robot_(robot),
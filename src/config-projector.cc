@@ -31,6 +31,7 @@
 #include <hpp/constraints/differentiable-function.hh>
 #include <hpp/constraints/solver/by-substitution.hh>
 #include <hpp/core/config-projector.hh>
+#include <hpp/core/inverse-kinematics.hh>
 #include <hpp/pinocchio/configuration.hh>
 #include <hpp/pinocchio/device.hh>
 #include <hpp/pinocchio/extra-config-space.hh>
@@ -40,6 +41,7 @@
 #include <hpp/util/debug.hh>
 #include <hpp/util/serialization.hh>
 #include <hpp/util/timer.hh>
+#include <algorithm>
 #include <limits>
 #include <pinocchio/multibody/model.hpp>
 
@@ -51,6 +53,31 @@ typedef constraints::solver::lineSearch::ErrorNormBased ErrorNormBased_t;
 typedef constraints::solver::lineSearch::FixedSequence FixedSequence_t;
 typedef constraints::solver::lineSearch::Constant Constant_t;
 
+namespace {
+/// Number of resolutions performed with each line search before the
+/// adaptive line search starts selecting the best one.
+const size_type adaptiveMinTrials = 5;
+/// Period, in number of resolutions, at which the adaptive line search
+/// selects the least used line search.
+const size_type adaptiveExplorationPeriod = 50;
+
+/// Line search wrapper that counts the iterations of the solver.
+template <typename LineSearch_t>
+struct CountIterations {
+  CountIterations(size_type& count) : count_(&count) { *count_ = 0; }
+
+  template <typename SolverType>
+  bool operator()(const SolverType& solver, vectorOut_t arg,
+                  vectorOut_t darg) {
+    ++*count_;
+    return lineSearch_(solver, arg, darg);
+  }
+
+  LineSearch_t lineSearch_;
+  size_type* count_;
+};
+}  // namespace
+
 ConfigProjector::LineSearchType ConfigProjector::defaultLineSearch_ =
     ConfigProjector::FixedSequence;
 
@@ -104,7 +131,12 @@ ConfigProjector::ConfigProjector(const ConfigProjector& cp)
       lineSearchType_(cp.lineSearchType_),
       solver_(new BySubstitution(*cp.solver_)),
       weak_(),
-      statistics_(cp.statistics_) {}
+      statistics_(cp.statistics_),
+      inverseKinematics_(cp.inverseKinematics_) {
+  std::copy(cp.lineSearchStatistics_,
+            cp.lineSearchStatistics_ + NbLineSearchTypes,
+            lineSearchStatistics_);
+}
 
 ConfigProjector::~ConfigProjector() { delete solver_; }
 
@@ -185,8 +217,15 @@ bool ConfigProjector::impl_compute(ConfigurationOut_t configuration) {
     throw std::runtime_error(
         "In ConfigProjector::apply: can't project a configuration if JACOBIAN "
         "computation flag is not enabled.");
+  if (solveInverseKinematics(configuration)) {
+    statistics_.addSuccess();
+    return true;
+  }
+  const LineSearchType ls = selectLineSearch();
+  size_type nbIterations;
   BySubstitution::Status status =
-      (BySubstitution::Status)solverSolve(configuration);
+      (BySubstitution::Status)solverSolve(configuration, ls, nbIterations);
+  addLineSearchStatistics(ls, status == BySubstitution::SUCCESS, nbIterations);
   switch (status) {
     case BySubstitution::ERROR_INCREASED:
       statistics_.addFailure(REASON_ERROR_INCREASED);
@@ -208,6 +247,42 @@ bool ConfigProjector::impl_compute(ConfigurationOut_t configuration) {
   return false;
 }
 
+bool ConfigProjector::solveInverseKinematics(
+    ConfigurationOut_t configuration) const {
+  if (inverseKinematics_.empty()) return false;
+  std::vector<Configuration_t> solutions;
+  std::vector<std::pair<value_type, std::size_t> > order;
+  vector_t rhs, v(robot_->numberDof());
+  for (const constraints::ImplicitPtr_t& nc : solver_->numericalConstraints()) {
+    for (const InverseKinematicsPtr_t& ik : inverseKinematics_) {
+      if (!ik->canSolve(nc)) continue;
+      rhs.resize(nc->rightHandSideSize());
+      solver_->getRightHandSide(nc, rhs);
+      solutions.clear();
+      ik->solve(nc, rhs, configuration, solutions);
+      // Try the solutions by increasing distance to the input configuration.
+      order.clear();
+      for (std::size_t i = 0; i < solutions.size(); ++i) {
+        pinocchio::difference<pinocchio::RnxSOnLieGroupMap>(
+            robot_, solutions[i], configuration, v);
+        order.push_back(std::make_pair(v.norm(), i));
+      }
+      std::sort(order.begin(), order.end());
+      for (const auto& o : order) {
+        Configuration_t& q(solutions[o.second]);
+        solver_->explicitConstraintSet().solve(q);
+        if (solver_->isSatisfied(q)) {
+          configuration = q;
+          return true;
+        }
+      }
+      hppDout(info, "no solution of the inverse kinematics satisfies the "
+                    "constraints.");
+    }
+  }
+  return false;
+}
+
 bool ConfigProjector::optimize(ConfigurationOut_t configuration,
                                std::size_t maxIter) {
   if (!lastIsOptional()) return true;
@@ -216,7 +291,7 @@ bool ConfigProjector::optimize(ConfigurationOut_t configuration,
   if (maxIter != 0) maxIterations(maxIter);
   hppDout(info, "before optimization: " << configuration.transpose());
   BySubstitution::Status status = BySubstitution::MAX_ITERATION_REACHED;
-  switch (lineSearchType_) {
+  switch (selectLineSearch()) {
     case Backtracking: {
       Backtracking_t ls;
       status = solver_->solve(configuration, true, ls);
@@ -237,6 +312,10 @@ bool ConfigProjector::optimize(ConfigurationOut_t configuration,
       status = solver_->solve(configuration, true, ls);
       break;
     }
+    case Adaptive:
+      // selectLineSearch never returns Adaptive.
+      assert(false);
+      break;
   }
   maxIterations(maxIterSave);
   hppDout(info, "After optimization: " << configuration.transpose());
@@ -330,7 +409,7 @@ void ConfigProjector::rightHandSideAt(const value_type& s) {
 }
 
 inline bool ConfigProjector::solverOneStep(ConfigurationOut_t config) const {
-  switch (lineSearchType_) {
+  switch (selectLineSearch()) {
     case Backtracking: {
       Backtracking_t ls;
       return solver_->oneStep(config, ls);
@@ -347,33 +426,89 @@ inline bool ConfigProjector::solverOneStep(ConfigurationOut_t config) const {
       Constant_t ls;
       return solver_->oneStep(config, ls);
     }
+    case Adaptive:
+      // selectLineSearch never returns Adaptive.
+      assert(false);
+      break;
   }
   return false;
 }
 
-inline int ConfigProjector::solverSolve(ConfigurationOut_t config) const {
-  switch (lineSearchType_) {
+inline int ConfigProjector::solverSolve(ConfigurationOut_t config,
+                                        LineSearchType lineSearchType,
+                                        size_type& nbIterations) const {
+  switch (lineSearchType) {
     case Backtracking: {
-      Backtracking_t ls;
+      CountIterations<Backtracking_t> ls(nbIterations);
       return solver_->solve(config, ls);
     }
     case ErrorNormBased: {
-      ErrorNormBased_t ls;
+      CountIterations<ErrorNormBased_t> ls(nbIterations);
       return solver_->solve(config, ls);
     }
     case FixedSequence: {
-      FixedSequence_t ls;
+      CountIterations<FixedSequence_t> ls(nbIterations);
       return solver_->solve(config, ls);
     }
     case Constant: {
-      Constant_t ls;
+      CountIterations<Constant_t> ls(nbIterations);
       return solver_->solve(config, ls);
     }
+    case Adaptive:
+      break;
   }
   throw std::runtime_error("Unknow line search type");
   return BySubstitution::MAX_ITERATION_REACHED;
 }
 
+ConfigProjector::LineSearchType ConfigProjector::selectLineSearch() const {
+  if (lineSearchType_ != Adaptive) return lineSearchType_;
+  std::size_t leastUsed = 0;
+  size_type nbCalls = 0;
+  for (std::size_t i = 0; i < NbLineSearchTypes; ++i) {
+    nbCalls += lineSearchStatistics_[i].nbCalls;
+    if (lineSearchStatistics_[i].nbCalls <
+        lineSearchStatistics_[leastUsed].nbCalls)
+      leastUsed = i;
+  }
+  if (lineSearchStatistics_[leastUsed].nbCalls < adaptiveMinTrials ||
+      nbCalls % adaptiveExplorationPeriod == 0)
+    return (LineSearchType)leastUsed;
+
+  // Select the line search with the lowest number of iterations per success.
+  // A failure costs the maximal number of iterations since it usually
+  // triggers a new resolution from another configuration.
+  const value_type maxIter = (value_type)maxIterations();
+  std::size_t best = 0;
+  value_type bestCost = std::numeric_limits<value_type>::infinity();
+  for (std::size_t i = 0; i < NbLineSearchTypes; ++i) {
+    const LineSearchStatistics& s(lineSearchStatistics_[i]);
+    const value_type cost =
+        ((value_type)s.nbIterations +
+         maxIter * (value_type)(s.nbCalls - s.nbSuccesses)) /
+        (value_type)(s.nbSuccesses + 1);
+    if (cost < bestCost) {
+      bestCost = cost;
+      best = i;
+    }
+  }
+  return (LineSearchType)best;
+}
+
+void ConfigProjector::addLineSearchStatistics(LineSearchType ls, bool success,
+                                              size_type nbIterations) {
+  assert(ls != Adaptive);
+  LineSearchStatistics& s(lineSearchStatistics_[ls]);
+  ++s.nbCalls;
+  if (success) ++s.nbSuccesses;
+  s.nbIterations += nbIterations;
+}
+
+void ConfigProjector::resetLineSearchStatistics() {
+  std::fill(lineSearchStatistics_, lineSearchStatistics_ + NbLineSearchTypes,
+            LineSearchStatistics());
+}
+
 void ConfigProjector::lastIsOptional(bool optional) {
   solver_->lastIsOptional(optional);
 }
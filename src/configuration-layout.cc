@@ -0,0 +1,310 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <hpp/core/configuration-layout.hh>
+#include <hpp/pinocchio/configuration.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/joint-collection.hh>
+#include <hpp/pinocchio/liegroup.hh>
+#include <hpp/util/debug.hh>
+#include <map>
+#include <mutex>
+
+namespace hpp {
+namespace core {
+namespace {
+typedef Eigen::Quaternion<value_type> Quaternion_t;
+typedef Eigen::Map<const Quaternion_t> QuaternionConstMap_t;
+typedef Eigen::Map<Quaternion_t> QuaternionMap_t;
+
+// SO(2) elements are stored as (cos theta, sin theta).
+inline value_type so2Difference(const value_type* q1, const value_type* q0) {
+  return atan2(q0[0] * q1[1] - q0[1] * q1[0], q0[0] * q1[0] + q0[1] * q1[1]);
+}
+
+inline void so2Integrate(const value_type* q, const value_type& w,
+                         value_type* res) {
+  const value_type c(cos(w)), s(sin(w));
+  const value_type c0(c * q[0] - s * q[1]), s0(s * q[0] + c * q[1]);
+  // First order normalization, as in pinocchio.
+  const value_type alpha((3 - c0 * c0 - s0 * s0) / 2);
+  res[0] = alpha * c0;
+  res[1] = alpha * s0;
+}
+
+// SO(3) elements are stored as unit quaternions (x, y, z, w).
+inline void so3Difference(const value_type* q1, const value_type* q0,
+                          value_type* v) {
+  Quaternion_t dq(QuaternionConstMap_t(q0).conjugate() *
+                  QuaternionConstMap_t(q1));
+  if (dq.w() < 0) dq.coeffs() *= -1;
+  const value_type n(dq.vec().norm());
+  value_type alpha;
+  if (n > 1e-6)
+    alpha = 2 * atan2(n, dq.w()) / n;
+  else
+    alpha = 2 / dq.w() * (1 - n * n / (3 * dq.w() * dq.w()));
+  Eigen::Map<Eigen::Matrix<value_type, 3, 1> > res(v);
+  res = alpha * dq.vec();
+}
+
+inline void so3Integrate(const value_type* q, const value_type* v,
+                         value_type* res) {
+  Eigen::Map<const Eigen::Matrix<value_type, 3, 1> > w(v);
+  const value_type theta(w.norm());
+  Quaternion_t e;
+  if (theta > 1e-6) {
+    e.vec() = sin(theta / 2) / theta * w;
+    e.w() = cos(theta / 2);
+  } else {
+    e.vec() = (.5 - theta * theta / 48) * w;
+    e.w() = 1 - theta * theta / 8;
+  }
+  QuaternionConstMap_t quat(q);
+  Quaternion_t out(quat * e);
+  out.normalize();
+  // Stay in the same hemisphere as the input, as pinocchio does.
+  if (quat.dot(out) < 0) out.coeffs() *= -1;
+  QuaternionMap_t quatRes(res);
+  quatRes = out;
+}
+
+struct CacheEntry {
+  DeviceWkPtr_t robot;
+  ConfigurationLayoutPtr_t layout;
+};
+
+bool isUpToDate(const ConfigurationLayout& layout, const DevicePtr_t& robot,
+                size_type nJoints) {
+  return layout.nq() == robot->configSize() &&
+         layout.nv() == robot->numberDof() &&
+         nJoints == (size_type)robot->model().njoints;
+}
+}  // namespace
+
+ConfigurationLayoutPtr_t ConfigurationLayout::create(const DevicePtr_t& robot) {
+  return ConfigurationLayoutPtr_t(new ConfigurationLayout(robot));
+}
+
+ConfigurationLayoutPtr_t ConfigurationLayout::get(const DevicePtr_t& robot) {
+  // Paths of a problem usually share the same robot: keep the last layout
+  // of each thread to avoid locking the global cache.
+  thread_local CacheEntry last;
+  if (last.layout && last.robot.lock() == robot &&
+      isUpToDate(*last.layout, robot, last.layout->nJoints_))
+    return last.layout;
+
+  static std::mutex mutex;
+  static std::map<const pinocchio::Device*, CacheEntry> cache;
+  std::lock_guard<std::mutex> lock(mutex);
+  CacheEntry& entry(cache[robot.get()]);
+  if (!entry.layout || entry.robot.lock() != robot ||
+      !isUpToDate(*entry.layout, robot, entry.layout->nJoints_)) {
+    // Remove entries of destroyed robots.
+    for (auto it = cache.begin(); it != cache.end();) {
+      if (it->second.robot.expired() && it->first != robot.get())
+        it = cache.erase(it);
+      else
+        ++it;
+    }
+    entry.robot = robot;
+    entry.layout = create(robot);
+  }
+  last = entry;
+  return entry.layout;
+}
+
+ConfigurationLayout::ConfigurationLayout(const DevicePtr_t& robot)
+    : robot_(robot),
+      nq_(robot->configSize()),
+      nv_(robot->numberDof()),
+      nJoints_(robot->model().njoints),
+      supported_(true) {
+  const pinocchio::Model& model(robot->model());
+  for (pinocchio::JointIndex i = 1; i < (pinocchio::JointIndex)model.njoints;
+       ++i) {
+    const size_type iq(model.joints[i].idx_q()), iv(model.joints[i].idx_v()),
+        nq(model.joints[i].nq()), nv(model.joints[i].nv());
+    const std::string name(model.joints[i].shortname());
+    if (nq == nv) {
+      addSegment(VECTOR_SPACE, iq, iv, nq, nv);
+    } else if (nq == 2 && nv == 1) {
+      addSegment(SO2, iq, iv, 2, 1);
+    } else if (name == "JointModelPlanar") {
+      addSegment(VECTOR_SPACE, iq, iv, 2, 2);
+      addSegment(SO2, iq + 2, iv + 2, 2, 1);
+    } else if (name == "JointModelSpherical") {
+      addSegment(SO3, iq, iv, 4, 3);
+    } else if (name == "JointModelFreeFlyer") {
+      addSegment(VECTOR_SPACE, iq, iv, 3, 3);
+      addSegment(SO3, iq + 3, iv + 3, 4, 3);
+    } else {
+      hppDout(info, "Joint " << model.names[i] << " of type " << name
+                             << " is not supported by ConfigurationLayout.");
+      supported_ = false;
+    }
+  }
+  const size_type nExtra(robot->extraConfigSpace().dimension());
+  addSegment(VECTOR_SPACE, model.nq, model.nv, nExtra, nExtra);
+}
+
+void ConfigurationLayout::addSegment(SegmentType type, size_type iq,
+                                     size_type iv, size_type nq,
+                                     size_type nv) {
+  if (nq == 0) return;
+  if (type == VECTOR_SPACE && !segments_.empty()) {
+    Segment& last(segments_.back());
+    if (last.type == VECTOR_SPACE && last.iq + last.nq == iq &&
+        last.iv + last.nv == iv) {
+      last.nq += nq;
+      last.nv += nv;
+      return;
+    }
+  }
+  Segment s = {type, iq, iv, nq, nv};
+  segments_.push_back(s);
+}
+
+void ConfigurationLayout::interpolate(ConfigurationIn_t q0,
+                                      ConfigurationIn_t q1, const value_type& u,
+                                      ConfigurationOut_t result) const {
+  assert(q0.size() == nq_ && q1.size() == nq_ && result.size() == nq_);
+  if (!supported_) {
+    pinocchio::interpolate<pinocchio::RnxSOnLieGroupMap>(robot_.lock(), q0, q1,
+                                                         u, result);
+    return;
+  }
+  value_type w[3];
+  for (const Segment& s : segments_) {
+    switch (s.type) {
+      case VECTOR_SPACE:
+        result.segment(s.iq, s.nq) =
+            (1 - u) * q0.segment(s.iq, s.nq) + u * q1.segment(s.iq, s.nq);
+        break;
+      case SO2:
+        so2Integrate(q0.data() + s.iq,
+                     u * so2Difference(q1.data() + s.iq, q0.data() + s.iq),
+                     result.data() + s.iq);
+        break;
+      case SO3:
+        so3Difference(q1.data() + s.iq, q0.data() + s.iq, w);
+        for (int k = 0; k < 3; ++k) w[k] *= u;
+        so3Integrate(q0.data() + s.iq, w, result.data() + s.iq);
+        break;
+    }
+  }
+}
+
+void ConfigurationLayout::interpolate(ConfigurationIn_t q0,
+                                      ConfigurationIn_t q1, vectorIn_t u,
+                                      matrixOut_t result) const {
+  assert(q0.size() == nq_ && q1.size() == nq_);
+  assert(result.rows() == nq_ && result.cols() == u.size());
+  if (!supported_) {
+    DevicePtr_t robot(robot_.lock());
+    for (size_type i = 0; i < u.size(); ++i)
+      pinocchio::interpolate<pinocchio::RnxSOnLieGroupMap>(robot, q0, q1, u[i],
+                                                           result.col(i));
+    return;
+  }
+  value_type w[3], wu[3];
+  for (const Segment& s : segments_) {
+    switch (s.type) {
+      case VECTOR_SPACE:
+        result.middleRows(s.iq, s.nq).noalias() =
+            q0.segment(s.iq, s.nq) * (1 - u.array()).matrix().transpose();
+        result.middleRows(s.iq, s.nq).noalias() +=
+            q1.segment(s.iq, s.nq) * u.transpose();
+        break;
+      case SO2:
+        w[0] = so2Difference(q1.data() + s.iq, q0.data() + s.iq);
+        for (size_type i = 0; i < u.size(); ++i)
+          so2Integrate(q0.data() + s.iq, u[i] * w[0],
+                       result.col(i).data() + s.iq);
+        break;
+      case SO3:
+        so3Difference(q1.data() + s.iq, q0.data() + s.iq, w);
+        for (size_type i = 0; i < u.size(); ++i) {
+          for (int k = 0; k < 3; ++k) wu[k] = u[i] * w[k];
+          so3Integrate(q0.data() + s.iq, wu, result.col(i).data() + s.iq);
+        }
+        break;
+    }
+  }
+}
+
+void ConfigurationLayout::difference(ConfigurationIn_t q1,
+                                     ConfigurationIn_t q0,
+                                     vectorOut_t result) const {
+  assert(q0.size() == nq_ && q1.size() == nq_ && result.size() == nv_);
+  if (!supported_) {
+    pinocchio::difference<pinocchio::RnxSOnLieGroupMap>(robot_.lock(), q1, q0,
+                                                        result);
+    return;
+  }
+  for (const Segment& s : segments_) {
+    switch (s.type) {
+      case VECTOR_SPACE:
+        result.segment(s.iv, s.nv) =
+            q1.segment(s.iq, s.nq) - q0.segment(s.iq, s.nq);
+        break;
+      case SO2:
+        result[s.iv] = so2Difference(q1.data() + s.iq, q0.data() + s.iq);
+        break;
+      case SO3:
+        so3Difference(q1.data() + s.iq, q0.data() + s.iq,
+                      result.data() + s.iv);
+        break;
+    }
+  }
+}
+
+void ConfigurationLayout::integrate(ConfigurationIn_t q, vectorIn_t v,
+                                    ConfigurationOut_t result) const {
+  assert(q.size() == nq_ && v.size() == nv_ && result.size() == nq_);
+  if (!supported_) {
+    pinocchio::integrate<false, pinocchio::RnxSOnLieGroupMap>(robot_.lock(), q,
+                                                              v, result);
+    return;
+  }
+  for (const Segment& s : segments_) {
+    switch (s.type) {
+      case VECTOR_SPACE:
+        result.segment(s.iq, s.nq) =
+            q.segment(s.iq, s.nq) + v.segment(s.iv, s.nv);
+        break;
+      case SO2:
+        so2Integrate(q.data() + s.iq, v[s.iv], result.data() + s.iq);
+        break;
+      case SO3:
+        so3Integrate(q.data() + s.iq, v.data() + s.iv, result.data() + s.iq);
+        break;
+    }
+  }
+}
+}  // namespace core
+}  // namespace hpp
@@ -0,0 +1,97 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <hpp/core/config-validation.hh>
+#include <hpp/core/configuration-shooter/bridge.hh>
+#include <hpp/core/configuration-shooter/gaussian.hh>
+#include <hpp/core/configuration-shooter/uniform.hh>
+#include <hpp/pinocchio/configuration.hh>
+#include <hpp/util/debug.hh>
+
+namespace hpp {
+namespace core {
+namespace configurationShooter {
+
+BridgePtr_t Bridge::create(const DevicePtr_t& robot,
+                           const ConfigValidationPtr_t& configValidation) {
+  Bridge* ptr = new Bridge(robot, configValidation);
+  BridgePtr_t shPtr(ptr);
+  ptr->init(shPtr);
+  return shPtr;
+}
+
+Bridge::Bridge(const DevicePtr_t& robot,
+               const ConfigValidationPtr_t& configValidation)
+    : robot_(robot),
+      configValidation_(configValidation),
+      uniform_(Uniform::create(robot_)),
+      gaussian_(Gaussian::create(robot_)),
+      uniformRatio_(0.2),
+      maxTrials_(100),
+      numberTrials_(0),
+      numberBridgeSamples_(0),
+      numberUniformSamples_(0) {
+  assert(configValidation);
+  sigma(0.05);
+}
+
+void Bridge::sigma(const value_type& factor) { gaussian_->sigma(factor); }
+
+void Bridge::sampleExtraDOF(bool sampleExtraDOF) {
+  uniform_->sampleExtraDOF(sampleExtraDOF);
+}
+
+void Bridge::impl_shoot(Configuration_t& q) const {
+  if (uniformRatio_ > 0 && rand() < uniformRatio_ * RAND_MAX) {
+    ++numberUniformSamples_;
+    uniform_->shoot(q);
+    return;
+  }
+  ValidationReportPtr_t report;
+  Configuration_t q1, q2;
+  for (size_type i = 0; i < maxTrials_; ++i) {
+    ++numberTrials_;
+    uniform_->shoot(q1);
+    if (configValidation_->validate(q1, report)) continue;
+    gaussian_->center(q1);
+    gaussian_->shoot(q2);
+    if (configValidation_->validate(q2, report)) continue;
+    q.resize(robot_->configSize());
+    pinocchio::interpolate(robot_, q1, q2, 0.5, q);
+    if (configValidation_->validate(q, report)) {
+      ++numberBridgeSamples_;
+      return;
+    }
+  }
+  hppDout(info, "No bridge found after " << maxTrials_ << " trials.");
+  ++numberUniformSamples_;
+  uniform_->shoot(q);
+}
+
+}  // namespace configurationShooter
+}  // namespace core
+}  // namespace hpp
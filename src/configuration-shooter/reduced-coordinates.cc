@@ -0,0 +1,71 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <hpp/constraints/explicit-constraint-set.hh>
+#include <hpp/constraints/solver/by-substitution.hh>
+#include <hpp/core/config-projector.hh>
+#include <hpp/core/configuration-shooter/reduced-coordinates.hh>
+#include <hpp/core/configuration-shooter/uniform.hh>
+#include <hpp/core/constraint-set.hh>
+#include <hpp/util/debug.hh>
+
+namespace hpp {
+namespace core {
+namespace configurationShooter {
+
+ReducedCoordinatesPtr_t ReducedCoordinates::create(
+    const DevicePtr_t& robot, const ConstraintSetPtr_t& constraints) {
+  ReducedCoordinates* ptr = new ReducedCoordinates(robot, constraints);
+  ReducedCoordinatesPtr_t shPtr(ptr);
+  ptr->init(shPtr);
+  return shPtr;
+}
+
+ReducedCoordinates::ReducedCoordinates(const DevicePtr_t& robot,
+                                       const ConstraintSetPtr_t& constraints)
+    : robot_(robot),
+      constraints_(constraints),
+      innerShooter_(Uniform::create(robot)) {}
+
+void ReducedCoordinates::impl_shoot(Configuration_t& q) const {
+  innerShooter_->shoot(q);
+  if (!constraints_) return;
+  ConfigProjectorPtr_t cp(constraints_->configProjector());
+  if (!cp) return;
+  // Output variables of explicit constraints are overwritten by the value
+  // of the explicit functions at the sampled input variables.
+  const constraints::ExplicitConstraintSet& explicitSet(
+      cp->solver().explicitConstraintSet());
+  if (!explicitSet.solve(q)) {
+    hppDout(info, "Explicit constraints could not be solved at "
+                      << q.transpose());
+  }
+}
+
+}  // namespace configurationShooter
+}  // namespace core
+}  // namespace hpp
@@ -0,0 +1,153 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <hpp/fcl/collision.h>
+
+#include <hpp/constraints/generic-transformation.hh>
+#include <hpp/core/collision-validation-report.hh>
+#include <hpp/core/config-validation.hh>
+#include <hpp/core/configuration-shooter/retraction.hh>
+#include <hpp/pinocchio/collision-object.hh>
+#include <hpp/pinocchio/configuration.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/joint.hh>
+#include <hpp/util/debug.hh>
+#include <pinocchio/spatial/fcl-pinocchio-conversions.hpp>
+
+namespace hpp {
+namespace core {
+namespace configurationShooter {
+namespace {
+/// Add sign * n^T J to g, where J is the Jacobian of the position in the
+/// world frame of point p attached to the object.
+void addNormalJacobian(const DevicePtr_t& robot,
+                       const CollisionObjectConstPtr_t& object,
+                       const pinocchio::DeviceData& data, const vector3_t& p,
+                       const vector3_t& n, ConfigurationIn_t q,
+                       value_type sign, vectorOut_t g) {
+  JointConstPtr_t joint(object->joint());
+  // obstacles do not move
+  if (!joint || joint->index() == 0) return;
+  static const matrix3_t I3(matrix3_t::Identity());
+  Transform3f M(joint->currentTransformation(data));
+  DifferentiableFunctionPtr_t f(
+      constraints::Position::create("", robot, joint,
+                                    Transform3f(I3, M.actInv(p)),
+                                    Transform3f::Identity()));
+  matrix_t J(f->outputDerivativeSize(), f->inputDerivativeSize());
+  f->jacobian(J, q);
+  g.noalias() += sign * J.transpose() * n;
+}
+}  // namespace
+
+RetractionPtr_t Retraction::create(
+    const DevicePtr_t& robot, const ConfigValidationPtr_t& configValidation,
+    const ConfigurationShooterPtr_t& innerShooter) {
+  Retraction* ptr = new Retraction(robot, configValidation, innerShooter);
+  RetractionPtr_t shPtr(ptr);
+  ptr->init(shPtr);
+  return shPtr;
+}
+
+Retraction::Retraction(const DevicePtr_t& robot,
+                       const ConfigValidationPtr_t& configValidation,
+                       const ConfigurationShooterPtr_t& innerShooter)
+    : robot_(robot),
+      configValidation_(configValidation),
+      innerShooter_(innerShooter),
+      maxIterations_(10),
+      margin_(1e-3),
+      numberSamples_(0),
+      numberRetracted_(0),
+      numberFailures_(0) {
+  assert(configValidation);
+  assert(innerShooter);
+}
+
+void Retraction::impl_shoot(Configuration_t& q) const {
+  ++numberSamples_;
+  innerShooter_->shoot(q);
+  ValidationReportPtr_t report;
+  for (size_type i = 0; i <= maxIterations_; ++i) {
+    if (configValidation_->validate(q, report)) {
+      if (i > 0) ++numberRetracted_;
+      return;
+    }
+    if (i == maxIterations_) break;
+    CollisionValidationReportPtr_t collisionReport(
+        HPP_DYNAMIC_PTR_CAST(CollisionValidationReport, report));
+    if (!collisionReport || !step(q, *collisionReport)) break;
+  }
+  ++numberFailures_;
+}
+
+bool Retraction::step(Configuration_t& q,
+                      const CollisionValidationReport& report) const {
+  const CollisionObjectConstPtr_t& o1(report.object1);
+  const CollisionObjectConstPtr_t& o2(report.object2);
+  if (!o1 || !o2) return false;
+  // The report of the configuration validation may not contain the
+  // contact: recompute it.
+  using ::pinocchio::toFclTransform3f;
+  pinocchio::DeviceSync device(robot_);
+  device.currentConfiguration(q);
+  device.computeForwardKinematics();
+  device.updateGeometryPlacements();
+  fcl::CollisionRequest request(fcl::CONTACT, 1);
+  fcl::CollisionResult result;
+  fcl::collide(o1->geometry().get(),
+               toFclTransform3f(o1->getTransform(device.d())),
+               o2->geometry().get(),
+               toFclTransform3f(o2->getTransform(device.d())), request,
+               result);
+  if (result.numContacts() == 0) return false;
+  const fcl::Contact& contact(result.getContact(0));
+
+  // The normal points from object 1 to object 2: separating the objects
+  // means moving object 2 along the normal and object 1 backward.
+  vector_t g(vector_t::Zero(robot_->numberDof()));
+  addNormalJacobian(robot_, o1, device.d(), contact.pos, contact.normal, q,
+                    -1, g);
+  addNormalJacobian(robot_, o2, device.d(), contact.pos, contact.normal, q, 1,
+                    g);
+  value_type norm2 = g.squaredNorm();
+  if (norm2 < Eigen::NumTraits<value_type>::dummy_precision()) {
+    hppDout(info, "Cannot separate " << o1->name() << " and " << o2->name());
+    return false;
+  }
+  // smallest displacement such that g^T v = depth
+  vector_t v(g * ((fabs(contact.penetration_depth) + margin_) / norm2));
+  Configuration_t qNew(q.size());
+  pinocchio::integrate(robot_, q, v, qNew);
+  pinocchio::saturate(robot_, qNew);
+  q = qNew;
+  return true;
+}
+
+}  // namespace configurationShooter
+}  // namespace core
+}  // namespace hpp
@@ -32,6 +32,7 @@
 #include <hpp/fcl/collision_data.h>
 
 #include <hpp/core/continuous-validation/body-pair-collision.hh>
+#include <hpp/core/kinodynamic-path.hh>
 #include <hpp/core/path.hh>
 #include <hpp/core/straight-path.hh>  // To enable dynamic casting (needs inheritance).
 #include <hpp/pinocchio/body.hh>
@@ -101,7 +102,11 @@ bool BodyPairCollision::validateConfiguration(
 }
 
 void BodyPairCollision::setupPath() {
-  if (HPP_DYNAMIC_PTR_CAST(StraightPath, path_)) refine_ = false;
+  // The velocity of a straight path is constant, kinodynamic paths have a
+  // bound depending on the interval.
+  if (HPP_DYNAMIC_PTR_CAST(StraightPath, path_) &&
+      !HPP_DYNAMIC_PTR_CAST(KinodynamicPath, path_))
+    refine_ = false;
   Vb_ = vector_t(path_->outputDerivativeSize());
   value_type t0 = path_->timeRange().first;
   value_type t1 = path_->timeRange().second;
@@ -39,6 +39,7 @@
 #include <hpp/core/problem.hh>
 #include <hpp/core/roadmap.hh>
 #include <hpp/core/steering-method.hh>
+#include <hpp/core/trace.hh>
 #include <hpp/pinocchio/configuration.hh>
 #include <hpp/pinocchio/device.hh>
 #include <hpp/util/debug.hh>
@@ -196,6 +197,7 @@ void DiffusingPlanner::oneStep() {
   // Pick a random node
   Configuration_t q_rand;
   configurationShooter_->shoot(q_rand);
+  HPP_CORE_TRACE(SAMPLE, true, 0);
   //
   // First extend each connected component toward q_rand
   //
@@ -214,6 +216,7 @@ void DiffusingPlanner::oneStep() {
       HPP_START_TIMECOUNTER(validatePath);
       bool pathValid = pathValidation->validate(path, false, validPath, report);
       HPP_STOP_TIMECOUNTER(validatePath);
+      HPP_CORE_TRACE(VALIDATE, pathValid, path->length());
       // Insert new path to q_near in roadmap
       value_type t_final = validPath->timeRange().second;
       if (t_final != path->timeRange().first) {
@@ -275,6 +278,7 @@ void DiffusingPlanner::oneStep() {
       HPP_START_TIMECOUNTER(validatePath);
       bool valid = pathValidation->validate(path, false, validPath, report);
       HPP_STOP_TIMECOUNTER(validatePath);
+      HPP_CORE_TRACE(VALIDATE, valid, path->length());
       if (valid) {
         roadmap()->addEdge(*itn1, *itn2, path);
         roadmap()->addEdge(*itn2, *itn1, path->reverse());
@@ -307,6 +311,7 @@ void DiffusingPlanner::oneStep() {
       HPP_START_TIMECOUNTER(validatePath);
       bool valid = pathValidation->validate(path, false, validPath, report);
       HPP_STOP_TIMECOUNTER(validatePath);
+      HPP_CORE_TRACE(VALIDATE, valid, path->length());
       if (valid) {
         roadmap()->addEdge(*itn1, *itn2, path);
         roadmap()->addEdge(*itn2, *itn1, path->reverse());
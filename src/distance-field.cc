@@ -0,0 +1,260 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <hpp/fcl/distance.h>
+#include <hpp/fcl/shape/geometric_shapes.h>
+
+#include <algorithm>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <cmath>
+#include <fstream>
+#include <hpp/core/distance-field.hh>
+#include <hpp/pinocchio/collision-object.hh>
+#include <hpp/util/debug.hh>
+#include <hpp/util/exception-factory.hh>
+#include <hpp/util/serialization.hh>
+#include <limits>
+#include <pinocchio/spatial/fcl-pinocchio-conversions.hpp>
+
+namespace hpp {
+namespace core {
+namespace {
+/// Distance between a point and an axis aligned box, 0 inside
+value_type distanceToBox(const vector3_t& p, const fcl::AABB& box) {
+  vector3_t d = (box.min_ - p).cwiseMax(p - box.max_).cwiseMax(0);
+  return d.norm();
+}
+
+/// Axis aligned box of an object in the world frame
+fcl::AABB worldAABB(const CollisionObjectConstPtr_t& object) {
+  fcl::CollisionGeometry& geometry(*object->geometry());
+  if (geometry.aabb_local.min_[0] > geometry.aabb_local.max_[0])
+    geometry.computeLocalAABB();
+  const fcl::AABB& local(geometry.aabb_local);
+  const Transform3f& M(object->getTransform());
+  fcl::AABB res;
+  for (int i = 0; i < 8; ++i) {
+    vector3_t corner((i & 1) ? local.max_[0] : local.min_[0],
+                     (i & 2) ? local.max_[1] : local.min_[1],
+                     (i & 4) ? local.max_[2] : local.min_[2]);
+    corner = M.act(corner);
+    if (i == 0)
+      res = fcl::AABB(corner);
+    else
+      res += corner;
+  }
+  return res;
+}
+}  // namespace
+
+DistanceFieldPtr_t DistanceField::create(const vector3_t& lower,
+                                         const vector3_t& upper,
+                                         const value_type& resolution) {
+  return DistanceFieldPtr_t(new DistanceField(lower, upper, resolution));
+}
+
+DistanceField::DistanceField(const vector3_t& lower, const vector3_t& upper,
+                             const value_type& resolution)
+    : lower_(lower),
+      resolution_(resolution),
+      maxDistance_(std::numeric_limits<value_type>::infinity()) {
+  if (resolution <= 0)
+    throw std::invalid_argument("Resolution of distance field must be "
+                                "positive.");
+  if ((upper.array() <= lower.array()).any())
+    throw std::invalid_argument("Upper corner of distance field must be "
+                                "above lower corner.");
+  for (int i = 0; i < 3; ++i)
+    size_[i] = std::max(
+        (size_type)1, (size_type)std::ceil((upper[i] - lower[i]) / resolution));
+}
+
+void DistanceField::addObstacle(const CollisionObjectConstPtr_t& object) {
+  obstacles_.push_back(object);
+  obstacleNames_.push_back(object->name());
+  values_.clear();
+}
+
+void DistanceField::compute() {
+  std::vector<fcl::AABB> boxes;
+  boxes.reserve(obstacles_.size());
+  for (const CollisionObjectConstPtr_t& o : obstacles_)
+    boxes.push_back(worldAABB(o));
+
+  fcl::Sphere point(0);
+  fcl::DistanceRequest request(false);
+  fcl::DistanceResult result;
+  fcl::Transform3f tf;
+
+  values_.resize(size_.prod());
+  size_type k = 0;
+  for (size_type iz = 0; iz < size_[2]; ++iz)
+    for (size_type iy = 0; iy < size_[1]; ++iy)
+      for (size_type ix = 0; ix < size_[0]; ++ix, ++k) {
+        vector3_t center(lower_ +
+                         resolution_ * vector3_t(ix + .5, iy + .5, iz + .5));
+        tf.setTranslation(center);
+        value_type d = maxDistance_;
+        for (std::size_t j = 0; j < obstacles_.size(); ++j) {
+          // The distance to the bounding box is smaller than the distance
+          // to the obstacle.
+          if (distanceToBox(center, boxes[j]) >= d) continue;
+          result.clear();
+          fcl::distance(&point, tf, obstacles_[j]->geometry().get(),
+                        obstacles_[j]->getFclTransform(), request, result);
+          d = std::min(d, result.min_distance);
+        }
+        // Round toward minus infinity to keep a lower bound.
+        float value = (float)d;
+        if (value > d)
+          value =
+              std::nextafter(value, -std::numeric_limits<float>::infinity());
+        values_[k] = value;
+      }
+  hppDout(info, "Computed distance field of " << obstacles_.size()
+                                              << " obstacles on "
+                                              << values_.size() << " voxels.");
+}
+
+bool DistanceField::computeOrLoad(const std::string& filename) {
+  if (load(filename)) return true;
+  compute();
+  save(filename);
+  return false;
+}
+
+std::vector<value_type> DistanceField::key() const {
+  std::vector<value_type> res;
+  res.reserve(8 + 12 * obstacles_.size());
+  for (int i = 0; i < 3; ++i) res.push_back(lower_[i]);
+  res.push_back(resolution_);
+  for (int i = 0; i < 3; ++i) res.push_back((value_type)size_[i]);
+  res.push_back(maxDistance_);
+  for (const CollisionObjectConstPtr_t& o : obstacles_) {
+    const Transform3f& M(o->getTransform());
+    for (int i = 0; i < 3; ++i) res.push_back(M.translation()[i]);
+    for (int i = 0; i < 9; ++i) res.push_back(M.rotation().data()[i]);
+  }
+  return res;
+}
+
+void DistanceField::save(const std::string& filename) const {
+  if (values_.empty())
+    throw std::logic_error("Distance field has not been computed.");
+  std::ofstream fs(filename.c_str(), std::ios::binary);
+  if (!fs.is_open())
+    HPP_THROW(std::runtime_error, "Could not open " << filename);
+  hpp::serialization::binary_oarchive ar(fs);
+  std::vector<value_type> k(key());
+  ar& boost::serialization::make_nvp("key", k);
+  ar& boost::serialization::make_nvp("obstacles", obstacleNames_);
+  ar& boost::serialization::make_nvp("values", values_);
+}
+
+bool DistanceField::load(const std::string& filename) {
+  std::ifstream fs(filename.c_str(), std::ios::binary);
+  if (!fs.is_open()) return false;
+  hpp::serialization::binary_iarchive ar(fs);
+  std::vector<value_type> k;
+  std::vector<std::string> names;
+  ar& boost::serialization::make_nvp("key", k);
+  ar& boost::serialization::make_nvp("obstacles", names);
+  if (k != key() || names != obstacleNames_) {
+    hppDout(info, "Distance field in " << filename
+                                       << " was computed with other "
+                                          "parameters.");
+    return false;
+  }
+  std::vector<float> values;
+  ar& boost::serialization::make_nvp("values", values);
+  if (values.size() != (std::size_t)size_.prod()) return false;
+  values_.swap(values);
+  return true;
+}
+
+size_type DistanceField::index(const vector3_t& point,
+                               vector3_t& center) const {
+  size_type res = 0, stride = 1;
+  for (int i = 0; i < 3; ++i) {
+    value_type x = std::floor((point[i] - lower_[i]) / resolution_);
+    if (!(x >= 0 && x < (value_type)size_[i])) return -1;
+    center[i] = lower_[i] + (x + .5) * resolution_;
+    res += stride * (size_type)x;
+    stride *= size_[i];
+  }
+  return res;
+}
+
+value_type DistanceField::distanceLowerBound(const vector3_t& point) const {
+  assert(!values_.empty());
+  vector3_t center;
+  size_type i = index(point, center);
+  if (i < 0) return -std::numeric_limits<value_type>::infinity();
+  return values_[i] - (point - center).norm();
+}
+
+value_type DistanceField::distanceLowerBound(const Spheres_t& spheres,
+                                             const Transform3f& M) const {
+  value_type res = std::numeric_limits<value_type>::infinity();
+  for (const Sphere& s : spheres) {
+    res = std::min(res, distanceLowerBound(M.act(s.center)) - s.radius);
+    if (res == -std::numeric_limits<value_type>::infinity()) break;
+  }
+  return res;
+}
+
+DistanceField::Spheres_t DistanceField::sphereDecomposition(
+    const CollisionObjectConstPtr_t& object) {
+  fcl::CollisionGeometry& geometry(*object->geometry());
+  if (geometry.aabb_local.min_[0] > geometry.aabb_local.max_[0])
+    geometry.computeLocalAABB();
+  const fcl::AABB& box(geometry.aabb_local);
+  vector3_t extent(box.max_ - box.min_);
+  int axis[3] = {0, 1, 2};
+  std::sort(axis, axis + 3,
+            [&extent](int a, int b) { return extent[a] > extent[b]; });
+  // Cut along the longest dimension into boxes close to cubes.
+  size_type n = 1;
+  if (extent[axis[1]] > 0)
+    n = std::max((size_type)1,
+                 (size_type)std::round(extent[axis[0]] / extent[axis[1]]));
+  vector3_t step(vector3_t::Zero());
+  step[axis[0]] = extent[axis[0]] / (value_type)n;
+  vector3_t sub(extent);
+  sub[axis[0]] = step[axis[0]];
+  value_type radius = .5 * sub.norm();
+
+  Spheres_t res((std::size_t)n);
+  for (size_type i = 0; i < n; ++i) {
+    res[i].center = box.min_ + .5 * sub + (value_type)i * step;
+    res[i].radius = radius;
+  }
+  return res;
+}
+}  // namespace core
+}  // namespace hpp
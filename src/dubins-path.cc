@@ -21,6 +21,7 @@
 
 #include <math.h>
 
+#include <algorithm>
 #include <boost/serialization/vector.hpp>
 #include <boost/serialization/weak_ptr.hpp>
 #include <hpp/core/dubins-path.hh>
@@ -69,6 +70,85 @@ DubinsPathPtr_t DubinsPath::create(
   return shPtr;
 }
 
+double fmodr(double x, double y) { return x - y * floor(x / y); }
+
+double mod2pi(double theta) { return fmodr(theta, 2 * M_PI); }
+
+namespace {
+/// Position and orientation of the car in a configuration
+vector3_t planarPose(ConfigurationIn_t q, size_type xyId, size_type rzId) {
+  vector3_t res;
+  res[0] = q[xyId + 0];
+  res[1] = q[xyId + 1];
+  res[2] = atan2(q[rzId + 1], q[rzId + 0]);
+  return res;
+}
+
+/// Express the problem between two poses in the frame of the segment
+/// joining them, with unit turning radius.
+void normalise(const vector3_t& q0, const vector3_t& q1, value_type rho,
+               double& alpha, double& beta, double& d) {
+  double dx = q1[0] - q0[0];
+  double dy = q1[1] - q0[1];
+  d = sqrt(dx * dx + dy * dy) / rho;
+  double theta = mod2pi(atan2(dy, dx));
+  alpha = mod2pi(q0[2] - theta);
+  beta = mod2pi(q1[2] - theta);
+}
+
+struct Word {
+  std::size_t typeId;
+  double params[3];
+  double cost() const { return params[0] + params[1] + params[2]; }
+  bool operator<(const Word& other) const { return cost() < other.cost(); }
+};
+
+/// Feasible words sorted by increasing length. Words of equal length keep
+/// the order of dubins_words.
+std::vector<Word> sortedWords(double alpha, double beta, double d) {
+  std::vector<Word> res;
+  res.reserve(6);
+  for (std::size_t i = 0; i < 6; i++) {
+    Word w;
+    w.typeId = i;
+    if (dubins_words[i](alpha, beta, d, w.params) == EDUBOK) res.push_back(w);
+  }
+  std::stable_sort(res.begin(), res.end());
+  return res;
+}
+}  // namespace
+
+std::vector<DubinsPathPtr_t> DubinsPath::createCandidates(
+    const DevicePtr_t& device, ConfigurationIn_t init, ConfigurationIn_t end,
+    value_type extraLength, value_type rho, size_type xyId, size_type rzId,
+    const std::vector<JointPtr_t> wheels, ConstraintSetPtr_t constraints,
+    size_type maxNumber, value_type maxLengthRatio) {
+  double alpha, beta, d;
+  normalise(planarPose(init, xyId, rzId), planarPose(end, xyId, rzId), rho,
+            alpha, beta, d);
+  std::vector<Word> words(sortedWords(alpha, beta, d));
+  if (words.empty()) {
+    hppDout(error, "Failed to build Dubins path between "
+                       << init.transpose() << " and " << end.transpose()
+                       << ".");
+    throw std::logic_error("Failed to build Dubins path");
+  }
+  std::vector<DubinsPathPtr_t> res;
+  for (const Word& w : words) {
+    if ((size_type)res.size() >= maxNumber ||
+        w.cost() > maxLengthRatio * words.front().cost())
+      break;
+    Lengths_t lengths(w.params[0], w.params[1], w.params[2]);
+    DubinsPath* ptr =
+        new DubinsPath(device, init, end, extraLength, rho, xyId, rzId, wheels,
+                       constraints, w.typeId, lengths);
+    DubinsPathPtr_t shPtr(ptr);
+    ptr->init(shPtr);
+    res.push_back(shPtr);
+  }
+  return res;
+}
+
 inline value_type meanBounds(const JointPtr_t& j, const size_type& i) {
   return (j->upperBound(i) + j->lowerBound(i)) / 2;
 }
@@ -94,14 +174,8 @@ DubinsPath::DubinsPath(const DevicePtr_t& robot, ConfigurationIn_t init,
       rho_(rho) {
   assert(robot);
   assert(rho_ > 0);
-  vector3_t q0, q1;
-  q0[0] = initial_[xyId_ + 0];
-  q1[0] = end_[xyId_ + 0];
-  q0[1] = initial_[xyId_ + 1];
-  q1[1] = end_[xyId_ + 1];
-  q0[2] = atan2(initial_[rzId_ + 1], initial_[rzId_ + 0]);
-  q1[2] = atan2(end_[rzId_ + 1], end_[rzId_ + 0]);
-  dubins_init(q0, q1);
+  dubins_init(planarPose(initial_, xyId_, rzId_),
+              planarPose(end_, xyId_, rzId_));
 }
 
 DubinsPath::DubinsPath(const DevicePtr_t& robot, ConfigurationIn_t init,
@@ -122,14 +196,32 @@ DubinsPath::DubinsPath(const DevicePtr_t& robot, ConfigurationIn_t init,
   this->constraints(constraints);
   assert(robot);
   assert(rho_ > 0);
-  vector3_t q0, q1;
-  q0[0] = initial_[xyId_ + 0];
-  q1[0] = end_[xyId_ + 0];
-  q0[1] = initial_[xyId_ + 1];
-  q1[1] = end_[xyId_ + 1];
-  q0[2] = atan2(initial_[rzId_ + 1], initial_[rzId_ + 0]);
-  q1[2] = atan2(end_[rzId_ + 1], end_[rzId_ + 0]);
-  dubins_init(q0, q1);
+  dubins_init(planarPose(initial_, xyId_, rzId_),
+              planarPose(end_, xyId_, rzId_));
+}
+
+DubinsPath::DubinsPath(const DevicePtr_t& robot, ConfigurationIn_t init,
+                       ConfigurationIn_t end, value_type extraLength,
+                       value_type rho, size_type xyId, size_type rzId,
+                       const std::vector<JointPtr_t> wheels,
+                       ConstraintSetPtr_t constraints, std::size_t typeId,
+                       const Lengths_t& lengths)
+    : parent_t(robot->configSize(), robot->numberDof()),
+      device_(robot),
+      initial_(init),
+      end_(end),
+      xyId_(xyId),
+      rzId_(rzId),
+      wheels_(wheels),
+      typeId_(typeId),
+      lengths_(lengths),
+      extraLength_(extraLength),
+      rho_(rho) {
+  this->constraints(constraints);
+  assert(robot);
+  assert(rho_ > 0);
+  qi_ = planarPose(initial_, xyId_, rzId_);
+  buildSegments();
 }
 
 DubinsPath::DubinsPath(const DubinsPath& path)
@@ -169,53 +261,27 @@ void DubinsPath::init(DubinsPathPtr_t self) {
 }
 
 void DubinsPath::dubins_init_normalised(double alpha, double beta, double d) {
-  double best_cost = INFINITY;
-  int best_word;
-  int i;
-
-  best_word = -1;
-  for (i = 0; i < 6; i++) {
-    double params[3];
-    int err = dubins_words[i](alpha, beta, d, params);
-    if (err == EDUBOK) {
-      double cost = params[0] + params[1] + params[2];
-      if (cost < best_cost) {
-        best_word = i;
-        best_cost = cost;
-        lengths_[0] = params[0];
-        lengths_[1] = params[1];
-        lengths_[2] = params[2];
-        typeId_ = i;
-      }
-    }
-  }
-
-  if (best_word == -1) {
+  std::vector<Word> words(sortedWords(alpha, beta, d));
+  if (words.empty()) {
     hppDout(error, "Failed to build Dubins path between "
                        << initial_.transpose() << " and " << end_.transpose()
                        << ".");
     throw std::logic_error("Failed to build Dubins path");
   }
-  typeId_ = best_word;
+  typeId_ = words.front().typeId;
+  lengths_ << words.front().params[0], words.front().params[1],
+      words.front().params[2];
 }
 
-double fmodr(double x, double y) { return x - y * floor(x / y); }
-
-double mod2pi(double theta) { return fmodr(theta, 2 * M_PI); }
-
 void DubinsPath::dubins_init(vector3_t q0, vector3_t q1) {
-  int i;
-  double dx = q1[0] - q0[0];
-  double dy = q1[1] - q0[1];
-  double D = sqrt(dx * dx + dy * dy);
-  double d = D / rho_;
-  double theta = mod2pi(atan2(dy, dx));
-  double alpha = mod2pi(q0[2] - theta);
-  double beta = mod2pi(q1[2] - theta);
-  for (i = 0; i < 3; i++) {
-    qi_[i] = q0[i];
-  }
+  double alpha, beta, d;
+  normalise(q0, q1, rho_, alpha, beta, d);
+  qi_ = q0;
   dubins_init_normalised(alpha, beta, d);
+  buildSegments();
+}
+
+void DubinsPath::buildSegments() {
   // Find rank of translation and rotation in velocity vectors
   // Hypothesis: degrees of freedom all belong to a planar joint or
   // xyId_ belong to a tranlation joint, rzId_ belongs to a SO2 joint.
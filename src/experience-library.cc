@@ -0,0 +1,182 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <algorithm>
+#include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/vector.hpp>
+#include <fstream>
+#include <hpp/core/distance.hh>
+#include <hpp/core/experience-library.hh>
+#include <hpp/core/path-planner.hh>
+#include <hpp/core/path-validation.hh>
+#include <hpp/core/path-vector.hh>
+#include <hpp/core/problem.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/serialization.hh>
+#include <hpp/util/debug.hh>
+#include <hpp/util/serialization.hh>
+
+namespace hpp {
+namespace core {
+
+template <class Archive>
+void ExperienceLibrary::Experience::serialize(Archive& ar,
+                                              const unsigned int version) {
+  (void)version;
+  ar& BOOST_SERIALIZATION_NVP(path);
+  ar& BOOST_SERIALIZATION_NVP(numberUses);
+  ar& BOOST_SERIALIZATION_NVP(lastUse);
+}
+
+ExperienceLibraryPtr_t ExperienceLibrary::create(
+    const DevicePtr_t& robot, const DistancePtr_t& distance) {
+  return ExperienceLibraryPtr_t(new ExperienceLibrary(robot, distance));
+}
+
+ExperienceLibrary::ExperienceLibrary(const DevicePtr_t& robot,
+                                     const DistancePtr_t& distance)
+    : robot_(robot), distance_(distance), maxSize_(100), date_(0) {}
+
+void ExperienceLibrary::add(const PathVectorPtr_t& path) {
+  if (!path || path->length() == 0) return;
+  Experience e;
+  e.path = path;
+  e.numberUses = 0;
+  e.lastUse = ++date_;
+  experiences_.push_back(e);
+  evict();
+}
+
+void ExperienceLibrary::maxSize(const std::size_t& maxSize) {
+  maxSize_ = maxSize;
+  evict();
+}
+
+void ExperienceLibrary::evict() {
+  auto relevance = [this](const Experience& e) {
+    return value_type(e.numberUses + 1) / value_type(date_ - e.lastUse + 1);
+  };
+  while (experiences_.size() > maxSize_) {
+    Experiences_t::iterator worst(std::min_element(
+        experiences_.begin(), experiences_.end(),
+        [&relevance](const Experience& a, const Experience& b) {
+          return relevance(a) < relevance(b);
+        }));
+    experiences_.erase(worst);
+  }
+}
+
+std::vector<std::size_t> ExperienceLibrary::retrieve(ConfigurationIn_t q1,
+                                                     ConfigurationIn_t q2,
+                                                     std::size_t k) const {
+  std::vector<std::pair<value_type, std::size_t> > candidates;
+  candidates.reserve(experiences_.size());
+  const Distance& d(*distance_);
+  for (std::size_t i = 0; i < experiences_.size(); ++i) {
+    const PathVectorPtr_t& p(experiences_[i].path);
+    candidates.push_back(std::make_pair(
+        d(q1, p->initial()) + d(p->end(), q2), i));
+  }
+  k = std::min(k, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + k,
+                    candidates.end());
+  std::vector<std::size_t> res(k);
+  for (std::size_t i = 0; i < k; ++i) res[i] = candidates[i].second;
+  return res;
+}
+
+PathVectorPtr_t ExperienceLibrary::solve(const PathPlannerPtr_t& planner,
+                                         ConfigurationIn_t q1,
+                                         ConfigurationIn_t q2, std::size_t k) {
+  PathValidationPtr_t pathValidation(planner->problem()->pathValidation());
+  std::vector<std::size_t> indices(retrieve(q1, q2, k));
+  for (std::size_t index : indices) {
+    Experience& e(experiences_[index]);
+    hppDout(info, "Trying experience " << index);
+    // Connect the query endpoints to the experience
+    PathVectorPtr_t candidate(
+        PathVector::create(robot_->configSize(), robot_->numberDof()));
+    PathPtr_t start(planner->localPlan(q1, e.path->initial()));
+    if (!start) continue;
+    PathPtr_t end(planner->localPlan(e.path->end(), q2));
+    if (!end) continue;
+    PathVectorPtr_t flat(
+        PathVector::create(robot_->configSize(), robot_->numberDof()));
+    e.path->flatten(flat);
+    // Validate the experience under the current obstacles and plan again
+    // the invalid parts.
+    candidate->appendPath(start);
+    bool success = true;
+    PathPtr_t validPart;
+    PathValidationReportPtr_t report;
+    for (std::size_t i = 0; i < flat->numberPaths(); ++i) {
+      PathPtr_t path(flat->pathAtRank(i));
+      if (!pathValidation->validate(path, false, validPart, report)) {
+        hppDout(info, "Repairing path " << i << " of experience " << index);
+        path = planner->localPlan(path->initial(), path->end());
+        if (!path) {
+          success = false;
+          break;
+        }
+      }
+      candidate->appendPath(path);
+    }
+    if (!success) continue;
+    candidate->appendPath(end);
+    ++e.numberUses;
+    e.lastUse = ++date_;
+    return candidate;
+  }
+  return PathVectorPtr_t();
+}
+
+void ExperienceLibrary::save(const std::string& filename) const {
+  std::ofstream fs(filename);
+  hpp::serialization::binary_oarchive ar(fs);
+  ar.insert(robot_->name(), robot_.get());
+  ar.initialize();
+  ar& boost::serialization::make_nvp("experiences", experiences_);
+}
+
+void ExperienceLibrary::load(const std::string& filename) {
+  std::ifstream fs(filename);
+  if (!fs.good())
+    throw std::invalid_argument("Cannot open experience library file " +
+                                filename);
+  hpp::serialization::binary_iarchive ar(fs);
+  ar.insert(robot_->name(), robot_.get());
+  ar.initialize();
+  Experiences_t experiences;
+  ar& boost::serialization::make_nvp("experiences", experiences);
+  experiences_.swap(experiences);
+  date_ = 0;
+  for (const Experience& e : experiences_) date_ = std::max(date_, e.lastUse);
+  evict();
+}
+
+}  //   namespace core
+}  // namespace hpp
@@ -27,8 +27,10 @@
 // DAMAGE.
 
 #include <hpp/core/config-projector.hh>
+#include <hpp/core/configuration-layout.hh>
 #include <hpp/core/interpolated-path.hh>
 #include <hpp/core/projection-error.hh>
+#include <hpp/core/reversed-path.hh>
 #include <hpp/pinocchio/configuration.hh>
 #include <hpp/pinocchio/device.hh>
 #include <hpp/pinocchio/liegroup.hh>
@@ -144,8 +146,8 @@ bool InterpolatedPath::impl_compute(ConfigurationOut_t result,
   const value_type T = itA->first - itB->first;
   const value_type u = (param - itB->first) / T;
 
-  pinocchio::interpolate<hpp::pinocchio::RnxSOnLieGroupMap>(
-      device_, itB->second, itA->second, u, result);
+  ConfigurationLayout::get(device_)->interpolate(itB->second, itA->second, u,
+                                                 result);
   return true;
 }
 
@@ -185,8 +187,8 @@ void InterpolatedPath::impl_derivative(vectorOut_t result, const value_type& s,
     return;
   }
   if (order == 1) {
-    pinocchio::difference<hpp::pinocchio::RnxSOnLieGroupMap>(
-        device_, itA->second, itB->second, result);
+    ConfigurationLayout::get(device_)->difference(itA->second, itB->second,
+                                                  result);
     result = (1 / T) * result;
   }
 }
@@ -200,9 +202,9 @@ void InterpolatedPath::impl_velocityBound(vectorOut_t result,
 
   result.setZero();
   vector_t tmp(result.size());
+  ConfigurationLayoutPtr_t layout(ConfigurationLayout::get(device_));
   while (t1 > current->first) {
-    pinocchio::difference<hpp::pinocchio::RnxSOnLieGroupMap>(
-        device_, next->second, current->second, tmp);
+    layout->difference(next->second, current->second, tmp);
     const value_type T = next->first - current->first;
     result.noalias() = result.cwiseMax(tmp.cwiseAbs() / T);
     ++current;
@@ -247,20 +249,27 @@ PathPtr_t InterpolatedPath::impl_extract(const interval_t& subInterval) const {
 }
 
 PathPtr_t InterpolatedPath::reverse() const {
-  const value_type& l = paramLength();
-
-  InterpolatedPathPtr_t result =
-      InterpolatedPath::create(device_, end(), initial(), l, constraints());
+  // Share the interpolation points instead of copying them.
+  return ReversedPath::create(weak_.lock());
+}
 
-  if (configs_.size() > 2) {
-    InterpolationPoints_t::const_reverse_iterator it = configs_.rbegin();
-    ++it;
-    InterpolationPoints_t::const_reverse_iterator itEnd = configs_.rend();
-    --itEnd;
-    for (; it != itEnd; ++it) result->insert(l - it->first, it->second);
+bool InterpolatedPath::visitWaypoints(
+    const PathPtr_t& path,
+    const std::function<void(const Configuration_t&)>& visitor) {
+  InterpolatedPathPtr_t ip = HPP_DYNAMIC_PTR_CAST(InterpolatedPath, path);
+  if (ip) {
+    for (const InterpolationPoint_t& point : ip->configs_)
+      visitor(point.second);
+    return true;
   }
-
-  return result;
+  ReversedPathPtr_t reversed = HPP_DYNAMIC_PTR_CAST(ReversedPath, path);
+  if (!reversed) return false;
+  ip = HPP_DYNAMIC_PTR_CAST(InterpolatedPath, reversed->original());
+  if (!ip) return false;
+  for (InterpolationPoints_t::const_reverse_iterator it = ip->configs_.rbegin();
+       it != ip->configs_.rend(); ++it)
+    visitor(it->second);
+  return true;
 }
 
 DevicePtr_t InterpolatedPath::device() const { return device_; }
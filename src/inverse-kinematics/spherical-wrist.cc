@@ -0,0 +1,356 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+#include <hpp/constraints/generic-transformation.hh>
+#include <hpp/constraints/implicit.hh>
+#include <hpp/core/inverse-kinematics/spherical-wrist.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/joint-collection.hh>
+#include <hpp/pinocchio/joint.hh>
+#include <hpp/util/debug.hh>
+#include <pinocchio/algorithm/jacobian.hpp>
+#include <pinocchio/multibody/model.hpp>
+#include <pinocchio/spatial/explog.hpp>
+#include <stdexcept>
+
+namespace hpp {
+namespace core {
+namespace inverseKinematics {
+namespace {
+const value_type pi = boost::math::constants::pi<value_type>();
+/// Tolerance on the distance between axes that intersect
+const value_type axisTolerance = 1e-6;
+/// Tolerance on the position of the wrist center found by Newton iterations
+const value_type positionTolerance = 1e-10;
+const size_type maxNewtonIterations = 50;
+
+/// Axis of a revolute joint in the world frame
+struct Axis {
+  /// Unit vector
+  vector3_t direction;
+  /// A point of the axis
+  vector3_t point;
+};
+
+/// Rotation of an angle about an axis, as a rigid motion of the world
+Transform3f rotationAbout(const Axis& axis, const value_type& theta) {
+  matrix3_t R(
+      Eigen::AngleAxis<value_type>(theta, axis.direction).toRotationMatrix());
+  return Transform3f(R, axis.point - R * axis.point);
+}
+
+/// Angle of the rotation about w that maps u onto v
+/// (Paden-Kahan sub-problem 1).
+value_type subproblem1(const vector3_t& w, const vector3_t& u,
+                       const vector3_t& v) {
+  vector3_t up(u - w.dot(u) * w), vp(v - w.dot(v) * w);
+  return std::atan2(w.dot(up.cross(vp)), up.dot(vp));
+}
+
+/// Angles (theta1, theta2) such that rotating u by theta2 about w2, then by
+/// theta1 about w1 yields v (Paden-Kahan sub-problem 2).
+/// Both axes go through the origin.
+void subproblem2(const vector3_t& w1, const vector3_t& w2, const vector3_t& u,
+                 const vector3_t& v,
+                 std::vector<std::pair<value_type, value_type> >& solutions) {
+  value_type c(w1.dot(w2)), d(c * c - 1);
+  vector3_t w12(w1.cross(w2));
+  if (std::fabs(d) < axisTolerance) return;
+  value_type alpha((c * w2.dot(u) - w1.dot(v)) / d),
+      beta((c * w1.dot(v) - w2.dot(u)) / d),
+      gamma2((u.squaredNorm() - alpha * alpha - beta * beta -
+              2 * alpha * beta * c) /
+             w12.squaredNorm());
+  if (gamma2 < -axisTolerance) return;
+  value_type gamma(std::sqrt(std::max<value_type>(gamma2, 0)));
+  for (value_type g : {gamma, -gamma}) {
+    vector3_t z(alpha * w1 + beta * w2 + g * w12);
+    solutions.push_back(
+        std::make_pair(subproblem1(w1, z, v), subproblem1(w2, u, z)));
+    if (gamma == 0) break;
+  }
+}
+
+/// Angles of the rotations about an axis that bring p at distance delta
+/// of q (Paden-Kahan sub-problem 3).
+void subproblem3(const Axis& axis, const vector3_t& p, const vector3_t& q,
+                 const value_type& delta, std::vector<value_type>& solutions) {
+  const vector3_t& w(axis.direction);
+  vector3_t u(p - axis.point), v(q - axis.point);
+  vector3_t up(u - w.dot(u) * w), vp(v - w.dot(v) * w);
+  value_type theta0(std::atan2(w.dot(up.cross(vp)), up.dot(vp)));
+  value_type d2(delta * delta - std::pow(w.dot(p - q), 2));
+  value_type nu(up.norm()), nv(vp.norm());
+  if (nu < axisTolerance || nv < axisTolerance) return;
+  value_type c((nu * nu + nv * nv - d2) / (2 * nu * nv));
+  if (std::fabs(c) > 1 + axisTolerance) return;
+  value_type a(std::acos(std::min<value_type>(std::max<value_type>(c, -1), 1)));
+  solutions.push_back(theta0 + a);
+  if (a > 0) solutions.push_back(theta0 - a);
+}
+
+/// Compute the intersection of two axes
+/// \return false if the axes do not intersect.
+bool intersect(const Axis& a1, const Axis& a2, vector3_t& point) {
+  vector3_t n(a1.direction.cross(a2.direction));
+  value_type nn(n.squaredNorm());
+  if (nn < axisTolerance * axisTolerance) return false;
+  vector3_t dp(a2.point - a1.point);
+  // Closest points p1 + s1 d1 and p2 + s2 d2.
+  value_type s1(dp.cross(a2.direction).dot(n) / nn),
+      s2(dp.cross(a1.direction).dot(n) / nn);
+  vector3_t x1(a1.point + s1 * a1.direction), x2(a2.point + s2 * a2.direction);
+  if ((x1 - x2).norm() > axisTolerance) return false;
+  point = .5 * (x1 + x2);
+  return true;
+}
+
+/// Compute the axes of the joints of a chain in configuration q and the
+/// placement of the last joint.
+void computeAxes(const DevicePtr_t& robot, ConfigurationIn_t q,
+                 const std::vector<size_type>& chain, Axis axes[6],
+                 Transform3f& end) {
+  pinocchio::DeviceSync device(robot);
+  const pinocchio::Model& model(robot->model());
+  pinocchio::Data& data(device.data());
+  ::pinocchio::computeJointJacobians(model, data, q);
+  JointJacobian_t J(6, model.nv);
+  for (std::size_t i = 0; i < 6; ++i) {
+    J.setZero();
+    ::pinocchio::getJointJacobian(model, data, chain[i], ::pinocchio::WORLD,
+                                  J);
+    // Spatial velocity at the origin of the world frame: v = p x w for any
+    // point p of the axis.
+    const size_type iv(model.joints[chain[i]].idx_v());
+    vector3_t v(J.block<3, 1>(0, iv)), w(J.block<3, 1>(3, iv));
+    axes[i].direction = w.normalized();
+    axes[i].point = w.cross(v) / w.squaredNorm();
+  }
+  end = data.oMi[chain[5]];
+}
+
+/// Wrap an angle in [-pi, pi]
+value_type wrap(const value_type& theta) {
+  return std::atan2(std::sin(theta), std::cos(theta));
+}
+}  // namespace
+
+SphericalWristPtr_t SphericalWrist::create(const DevicePtr_t& robot) {
+  SphericalWrist* ptr(new SphericalWrist(robot));
+  const pinocchio::Model& model(robot->model());
+  std::vector<size_type> chain;
+  for (size_type i = 1; i < (size_type)model.njoints; ++i) {
+    if (ptr->isChain(i, chain)) {
+      ptr->endJoints_.push_back(i);
+      ptr->chains_.push_back(chain);
+    }
+  }
+  if (ptr->endJoints_.empty()) {
+    delete ptr;
+    return SphericalWristPtr_t();
+  }
+  return SphericalWristPtr_t(ptr);
+}
+
+SphericalWristPtr_t SphericalWrist::create(const DevicePtr_t& robot,
+                                           const JointPtr_t& joint) {
+  SphericalWristPtr_t ptr(new SphericalWrist(robot));
+  std::vector<size_type> chain;
+  if (!ptr->isChain(joint->index(), chain))
+    throw std::invalid_argument(
+        "Joint " + joint->name() +
+        " does not end a chain of six revolute joints with a spherical "
+        "wrist.");
+  ptr->endJoints_.push_back(joint->index());
+  ptr->chains_.push_back(chain);
+  return ptr;
+}
+
+SphericalWrist::SphericalWrist(const DevicePtr_t& robot) : robot_(robot) {}
+
+bool SphericalWrist::isChain(size_type index,
+                             std::vector<size_type>& chain) const {
+  const pinocchio::Model& model(robot_->model());
+  chain.assign(6, 0);
+  size_type j = index;
+  for (int k = 5; k >= 0; --k) {
+    if (j <= 0) return false;
+    const pinocchio::JointModel& jmodel(model.joints[j]);
+    if (jmodel.nv() != 1 || jmodel.shortname().compare(0, 11, "JointModelR"))
+      return false;
+    chain[k] = j;
+    j = model.parents[j];
+  }
+  // Check that the wrist axes intersect.
+  Axis axes[6];
+  Transform3f end;
+  computeAxes(robot_, robot_->neutralConfiguration(), chain, axes, end);
+  vector3_t center;
+  if (!intersect(axes[3], axes[4], center)) return false;
+  vector3_t d(axes[5].point - center);
+  return (d - d.dot(axes[5].direction) * axes[5].direction).norm() <
+         axisTolerance;
+}
+
+bool SphericalWrist::canSolve(
+    const constraints::ImplicitPtr_t& constraint) const {
+  constraints::TransformationPtr_t f(HPP_DYNAMIC_PTR_CAST(
+      constraints::Transformation, constraint->functionPtr()));
+  if (!f || f->joint1() || f->outputSize() != 6 || !f->joint2()) return false;
+  for (constraints::ComparisonType type : constraint->comparisonType())
+    if (type != constraints::Equality) return false;
+  return std::find(endJoints_.begin(), endJoints_.end(),
+                   (size_type)f->joint2()->index()) != endJoints_.end();
+}
+
+void SphericalWrist::solve(const constraints::ImplicitPtr_t& constraint,
+                           vectorIn_t rhs, ConfigurationIn_t q,
+                           std::vector<Configuration_t>& solutions) const {
+  constraints::TransformationPtr_t f(HPP_DYNAMIC_PTR_CAST(
+      constraints::Transformation, constraint->functionPtr()));
+  assert(f);
+  const std::vector<size_type>& chain(
+      chains_[std::find(endJoints_.begin(), endJoints_.end(),
+                        (size_type)f->joint2()->index()) -
+              endJoints_.begin()]);
+  Axis axes[6];
+  Transform3f end;
+  computeAxes(robot_, q, chain, axes, end);
+
+  // The value of the constraint is the pose of frame 2 in frame 1, as a
+  // position and the log of a rotation matrix.
+  Transform3f M(::pinocchio::exp3(vector3_t(rhs.tail<3>())),
+                vector3_t(rhs.head<3>()));
+  Transform3f target(f->frame1InJoint1() * M *
+                     f->frame2InJoint2().inverse());
+  // The motions of the joints are rotations about the axes in
+  // configuration q. The product of these rotations should be G.
+  Transform3f G(target * end.inverse());
+
+  vector3_t center;
+  intersect(axes[3], axes[4], center);
+  vector3_t Gc(G.act(center));
+
+  // Solve the position of the wrist center
+  std::vector<vector3_t> positions;
+  vector3_t shoulder;
+  if (intersect(axes[0], axes[1], shoulder)) {
+    // Rotations about the first two axes keep the distance to the shoulder.
+    std::vector<value_type> t3;
+    subproblem3(axes[2], center, shoulder, (Gc - shoulder).norm(), t3);
+    for (const value_type& theta3 : t3) {
+      vector3_t c3(rotationAbout(axes[2], theta3).act(center));
+      std::vector<std::pair<value_type, value_type> > t12;
+      subproblem2(axes[0].direction, axes[1].direction, c3 - shoulder,
+                  Gc - shoulder, t12);
+      for (const auto& t : t12)
+        positions.push_back(vector3_t(t.first, t.second, theta3));
+    }
+  } else {
+    // Newton iterations from several initial guesses
+    matrix3_t J;
+    for (value_type s1 : {0., .5 * pi, pi, -.5 * pi})
+      for (value_type s2 : {0., pi})
+        for (value_type s3 : {0., .5 * pi, pi, -.5 * pi}) {
+          vector3_t x(s1, s2, s3), error;
+          for (size_type it = 0; it < maxNewtonIterations; ++it) {
+            Transform3f T(Transform3f::Identity());
+            Transform3f Ts[3];
+            for (std::size_t k = 0; k < 3; ++k) {
+              Ts[k] = T;
+              T = T * rotationAbout(axes[k], x[k]);
+            }
+            vector3_t pc(T.act(center));
+            error = pc - Gc;
+            if (error.norm() < positionTolerance) break;
+            for (std::size_t k = 0; k < 3; ++k)
+              J.col(k) = (Ts[k].rotation() * axes[k].direction)
+                             .cross(pc - Ts[k].act(axes[k].point));
+            x -= J.completeOrthogonalDecomposition().solve(error);
+          }
+          if (error.norm() >= positionTolerance) continue;
+          for (std::size_t k = 0; k < 3; ++k) x[k] = wrap(x[k]);
+          bool found = false;
+          for (const vector3_t& p : positions)
+            if ((p - x).norm() < 1e3 * axisTolerance) found = true;
+          if (!found) positions.push_back(x);
+        }
+  }
+
+  // Solve the orientation of the wrist for each position
+  const pinocchio::Model& model(robot_->model());
+  vector3_t v(axes[5].direction.cross(vector3_t::UnitX()));
+  if (v.norm() < .1) v = axes[5].direction.cross(vector3_t::UnitY());
+  for (const vector3_t& x : positions) {
+    Transform3f T(Transform3f::Identity());
+    for (std::size_t k = 0; k < 3; ++k) T = T * rotationAbout(axes[k], x[k]);
+    matrix3_t R(T.rotation().transpose() * G.rotation());
+    std::vector<std::pair<value_type, value_type> > t45;
+    subproblem2(axes[3].direction, axes[4].direction, axes[5].direction,
+                R * axes[5].direction, t45);
+    for (const auto& t : t45) {
+      matrix3_t R45(
+          Eigen::AngleAxis<value_type>(t.first, axes[3].direction) *
+          Eigen::AngleAxis<value_type>(t.second, axes[4].direction));
+      value_type theta6(
+          subproblem1(axes[5].direction, v, R45.transpose() * R * v));
+      const value_type delta[6] = {x[0], x[1], x[2], t.first, t.second, theta6};
+      // Write the solution in the configuration
+      Configuration_t solution(q);
+      bool valid = true;
+      for (std::size_t k = 0; k < 6 && valid; ++k) {
+        const pinocchio::JointModel& jmodel(model.joints[chain[k]]);
+        const size_type iq(jmodel.idx_q());
+        if (jmodel.nq() == 2) {
+          value_type theta(std::atan2(q[iq + 1], q[iq]) + delta[k]);
+          solution[iq] = std::cos(theta);
+          solution[iq + 1] = std::sin(theta);
+          continue;
+        }
+        value_type theta(q[iq] + wrap(delta[k]));
+        valid = false;
+        for (value_type shift : {0., 2 * pi, -2 * pi}) {
+          if (theta + shift >= model.lowerPositionLimit[iq] &&
+              theta + shift <= model.upperPositionLimit[iq]) {
+            solution[iq] = theta + shift;
+            valid = true;
+            break;
+          }
+        }
+      }
+      if (valid) solutions.push_back(solution);
+    }
+  }
+  hppDout(info, solutions.size() << " solutions");
+}
+}  // namespace inverseKinematics
+}  // namespace core
+}  // namespace hpp
@@ -26,7 +26,10 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
 // DAMAGE.
 
+#include <algorithm>
+#include <cmath>
 #include <hpp/core/kinodynamic-oriented-path.hh>
+#include <hpp/core/reversed-path.hh>
 #include <hpp/pinocchio/device.hh>
 
 namespace hpp {
@@ -134,12 +137,74 @@ PathPtr_t KinodynamicOrientedPath::impl_extract(
   KinodynamicPathPtr_t kinoPath = dynamic_pointer_cast<KinodynamicPath>(path);
   if (kinoPath)
     return KinodynamicOrientedPath::create(kinoPath, ignoreZValue_);
-  else {
+  else if (subInterval.first > subInterval.second) {
+    // the profile could not be reversed in place: keep the orientation of
+    // the forward path.
+    return ReversedPath::create(
+        impl_extract(interval_t(subInterval.second, subInterval.first)));
+  } else {
     hppDout(error,
             "Error while casting path in KinodynamicOrientedPath::extract");
     return PathPtr_t();
   }
 }
 
+void KinodynamicOrientedPath::impl_velocityBound(vectorOut_t result,
+                                                 const value_type& t0,
+                                                 const value_type& t1) const {
+  parent_t::impl_velocityBound(result, t0, t1);
+  // Union of the switch times of the translation axes: on each piece, the
+  // velocity v is affine and the acceleration a is constant.
+  std::vector<value_type> times;
+  for (size_type id = 0; id < 3; ++id) {
+    std::vector<value_type> axisTimes(switchTimes(id, t0, t1));
+    times.insert(times.end(), axisTimes.begin(), axisTimes.end());
+  }
+  std::sort(times.begin(), times.end());
+  times.erase(std::unique(times.begin(), times.end()), times.end());
+
+  value_type omega = 0;
+  Eigen::Vector3d v, a;
+  for (std::size_t k = 0; k + 1 < times.size(); ++k) {
+    value_type dt = times[k + 1] - times[k];
+    for (size_type id = 0; id < 3; ++id) {
+      value_type acc;
+      translationProfile(id, times[k], v[id], acc);
+      translationProfile(id, .5 * (times[k] + times[k + 1]), acc, a[id]);
+    }
+    if (ignoreZValue_) {
+      v[2] = 0;
+      a[2] = 0;
+    }
+    // The heading v/|v| rotates at rate |v x a| / |v|^2, where v x a is
+    // constant on the piece. If it vanishes, the heading is constant.
+    value_type cross = v.cross(a).norm();
+    if (cross == 0) continue;
+    // minimal norm of the velocity on the piece
+    value_type s = std::min(std::max(-v.dot(a) / a.squaredNorm(), 0.), dt);
+    value_type vMin = (v + s * a).norm();
+    value_type rate = cross / (vMin * vMin);
+    if (!ignoreZValue_) {
+      // The rotation from the x axis to the heading adds a twist about the
+      // heading, bounded by the rate divided by cos (theta/2), where theta
+      // is the angle between the heading and the x axis.
+      Eigen::Vector3d vEnd(v + dt * a);
+      value_type vMax = std::max(v.norm(), vEnd.norm());
+      value_type c =
+          .5 * (vMin + std::min(v[0], vEnd[0])) / vMax;  // cos^2 (theta/2)
+      if (c <= 0) {
+        // The heading may cross the -x axis where the orientation jumps.
+        // Two orientations are at most pi apart: bound the rotation on the
+        // piece by the rotation of the heading plus this jump.
+        rate += M_PI / dt;
+      } else {
+        rate /= sqrt(c);
+      }
+    }
+    omega = std::max(omega, rate);
+  }
+  for (size_type i = 3; i < 6; ++i) result[i] = std::max(result[i], omega);
+}
+
 }  // namespace core
 }  // namespace hpp
@@ -26,16 +26,34 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
 // DAMAGE.
 
+#include <algorithm>
 #include <hpp/core/config-projector.hh>
 #include <hpp/core/kinodynamic-path.hh>
 #include <hpp/core/projection-error.hh>
+#include <hpp/core/reversed-path.hh>
 #include <hpp/pinocchio/configuration.hh>
 #include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/joint-collection.hh>
 #include <hpp/pinocchio/joint.hh>
 #include <hpp/util/debug.hh>
+#include <pinocchio/multibody/joint/joint-generic.hpp>
 
 namespace hpp {
 namespace core {
+namespace {
+/// Whether the coordinate at configuration rank \c rank is a translation
+bool isTranslation(const DevicePtr_t& device, size_type rank) {
+  JointPtr_t joint(device->getJointAtConfigRank(rank));
+  const std::string type(joint->jointModel().shortname());
+  size_type r(rank - joint->rankInConfiguration());
+  if (type == "JointModelTranslation") return true;
+  if (type == "JointModelFreeFlyer") return r < 3;
+  if (type == "JointModelPlanar") return r < 2;
+  // prismatic joints
+  return type.compare(0, 11, "JointModelP") == 0;
+}
+}  // namespace
+
 KinodynamicPath::KinodynamicPath(const DevicePtr_t& device,
                                  ConfigurationIn_t init, ConfigurationIn_t end,
                                  value_type length, ConfigurationIn_t a1,
@@ -66,12 +84,13 @@ KinodynamicPath::KinodynamicPath(const DevicePtr_t& device,
   assert(a1.size() == 3 && t0.size() == 3 && t1.size() == 3 && tv.size() == 3 &&
          t2.size() == 3 && vLim.size() == 3 &&
          "Inputs vector of kinodynamicPath are not of size 3");
+  // The phases of an axis may end before the path length, see the class
+  // documentation: reversing a path turns a waiting phase at the beginning
+  // into a rest phase at the end, that is not described by the phases.
   for (size_t i = 0; i < 3; i++) {
-    assert(fabs(length - (t0[i] + t1[i] + tv[i] + t2[i])) <
-               std::numeric_limits<float>::epsilon() &&
-           "Kinodynamic path : length is not coherent with switch times at "
-           "index " +
-               i);
+    assert(t0[i] + t1[i] + tv[i] + t2[i] <
+               length + std::numeric_limits<float>::epsilon() &&
+           "Kinodynamic path : length is not coherent with switch times");
   }
 }
 
@@ -106,9 +125,11 @@ KinodynamicPath::KinodynamicPath(const DevicePtr_t& device,
   assert(a1.size() == 3 && t0.size() == 3 && t1.size() == 3 && tv.size() == 3 &&
          t2.size() == 3 && vLim.size() == 3 &&
          "Inputs vector of kinodynamicPath are not of size 3");
+  // The phases of an axis may end before the path length, see the first
+  // constructor.
   for (size_t i = 0; i < 3; i++) {
-    assert(fabs(length - (t0[i] + t1[i] + tv[i] + t2[i])) <
-               Eigen::NumTraits<value_type>::dummy_precision() &&
+    assert(t0[i] + t1[i] + tv[i] + t2[i] <
+               length + Eigen::NumTraits<value_type>::dummy_precision() &&
            "Kinodynamic path : length is not coherent with switch times");
     assert(t0[i] >= 0 &&
            "Duration of the phases in kinodynamicPath must be positives.");
@@ -279,6 +300,15 @@ PathPtr_t KinodynamicPath::impl_extract(const interval_t& subInterval) const {
                                 (eval(subInterval.first, success)), 0.);
   }
 
+  if (subInterval.first > subInterval.second) {  // reversed path
+    PathPtr_t forward(KinodynamicPath::impl_extract(
+        interval_t(subInterval.second, subInterval.first)));
+    KinodynamicPathPtr_t kinoPath(
+        HPP_DYNAMIC_PTR_CAST(KinodynamicPath, forward));
+    if (!kinoPath) return ReversedPath::create(forward);
+    return kinoPath->reversed();
+  }
+
   hppDout(notice, "%% EXTRACT PATH : path interval : "
                       << timeRange().first << " ; " << timeRange().second);
   hppDout(notice, "%% EXTRACT PATH : sub  interval : "
@@ -312,13 +342,7 @@ PathPtr_t KinodynamicPath::impl_extract(const interval_t& subInterval) const {
     throw projection_error(
         "Failed to apply constraints in KinodynamicPath::extract");
 
-  if (subInterval.first > subInterval.second) {  // reversed path
-    hppDout(notice, "%% REVERSE PATH, not implemented yet !");
-    std::cout << "ERROR, you shouldn't call reverse() on a kinodynamic path"
-              << std::endl;
-    return PathPtr_t();
-  }
-  double ti, tf, oldT0, oldT2, oldT1, oldTv;
+  double ti, tf, rest, oldT0, oldT2, oldT1, oldTv;
   hppDout(notice, "%% subinterval PATH");
   // new timebounds
   Configuration_t t0(t0_);
@@ -354,6 +378,9 @@ PathPtr_t KinodynamicPath::impl_extract(const interval_t& subInterval) const {
     oldT1 = t1[i];
     oldT2 = t2[i];
     oldTv = tv[i];
+    // the end of the path may be a rest phase after the last segment
+    rest = timeRange().second - (t0_[i] + t1_[i] + tv_[i] + t2_[i]);
+    if (rest > 0) tf = std::max(tf - rest, 0.);
     t2[i] = oldT2 - tf;
     if (t2[i] <= 0) {
       t2[i] = 0;
@@ -381,5 +408,101 @@ PathPtr_t KinodynamicPath::impl_extract(const interval_t& subInterval) const {
   return result;
 }
 
+PathPtr_t KinodynamicPath::reversed() const {
+  size_type configSize =
+      device()->configSize() - device()->extraConfigSpace().dimension();
+  // Reversing time swaps the phases and negates the velocities. The
+  // acceleration of the first reversed phase is the one of the last phase.
+  Configuration_t q1(end_), q2(initial_);
+  vector_t t0(3);
+  for (size_type id = 0; id < 3; ++id) {
+    if (t0_[id] > 0 && initial_[configSize + id] != 0) {
+      hppDout(notice,
+              "Constant velocity phase at index "
+                  << id << " cannot be reversed, return a reversed view.");
+      return ReversedPath::create(weak_.lock());
+    }
+    q1[configSize + id] = -end_[configSize + id];
+    q2[configSize + id] = -initial_[configSize + id];
+    q1[configSize + 3 + id] = 0;
+    q2[configSize + 3 + id] = 0;
+    // the rest phase at the end becomes a waiting phase at the beginning.
+    t0[id] = std::max(
+        timeRange().second - (t0_[id] + t1_[id] + tv_[id] + t2_[id]), 0.);
+  }
+  // a waiting phase at the beginning becomes a rest phase at the end.
+  return KinodynamicPath::create(device_, q1, q2, timeRange().second,
+                                 vector_t(-a1_), t0, t2_, tv_, t1_,
+                                 vector_t(-vLim_), constraints());
+}
+
+void KinodynamicPath::translationProfile(size_type id, value_type t,
+                                         value_type& velocity,
+                                         value_type& acceleration) const {
+  size_type indexVel =
+      device()->configSize() - device()->extraConfigSpace().dimension() + id;
+  if (t <= t0_[id]) {
+    velocity = initial_[indexVel];
+    acceleration = 0;
+  } else if (t <= t0_[id] + t1_[id]) {
+    velocity = (t - t0_[id]) * a1_[id] + initial_[indexVel];
+    acceleration = a1_[id];
+  } else if (t <= t0_[id] + t1_[id] + tv_[id]) {
+    velocity = vLim_[id];
+    acceleration = 0;
+  } else if (t <= t0_[id] + t1_[id] + tv_[id] + t2_[id]) {
+    value_type v2;
+    if (tv_[id] > 0)
+      v2 = vLim_[id];
+    else
+      v2 = t1_[id] * a1_[id] + initial_[indexVel];
+    velocity = v2 - (t - t0_[id] - t1_[id] - tv_[id]) * a1_[id];
+    acceleration = -a1_[id];
+  } else {
+    velocity = end_[indexVel];
+    acceleration = 0;
+  }
+}
+
+std::vector<value_type> KinodynamicPath::switchTimes(
+    size_type id, const value_type& t0, const value_type& t1) const {
+  std::vector<value_type> times;
+  times.push_back(t0);
+  value_type t = 0;
+  const value_type durations[4] = {t0_[id], t1_[id], tv_[id], t2_[id]};
+  for (std::size_t i = 0; i < 4; ++i) {
+    t += durations[i];
+    if (t > t0 && t < t1) times.push_back(t);
+  }
+  times.push_back(t1);
+  return times;
+}
+
+void KinodynamicPath::impl_velocityBound(vectorOut_t result,
+                                         const value_type& t0,
+                                         const value_type& t1) const {
+  // joints other than the translation are interpolated at constant velocity
+  parent_t::impl_velocityBound(result, t0, t1);
+  size_type velocityRank =
+      device()->numberDof() - device()->extraConfigSpace().dimension();
+  value_type v, a;
+  for (size_type id = 0; id < 3; ++id) {
+    if (!isTranslation(device(), id)) continue;
+    std::vector<value_type> times(switchTimes(id, t0, t1));
+    value_type vMax = 0, aMax = 0;
+    for (std::size_t k = 0; k < times.size(); ++k) {
+      translationProfile(id, times[k], v, a);
+      vMax = std::max(vMax, fabs(v));
+      if (k + 1 < times.size()) {
+        // acceleration is constant between two switch times
+        translationProfile(id, .5 * (times[k] + times[k + 1]), v, a);
+        aMax = std::max(aMax, fabs(a));
+      }
+    }
+    result[id] = vMax;
+    result[velocityRank + id] = aMax;
+  }
+}
+
 }  //   namespace core
 }  // namespace hpp
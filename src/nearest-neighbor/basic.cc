@@ -93,14 +93,19 @@ NodePtr_t Basic::search(const NodePtr_t& node,
 
 Nodes_t Basic::KnearestSearch(const Configuration_t& q,
                               const ConnectedComponentPtr_t& connectedComponent,
-                              const std::size_t K, value_type& distance) {
+                              const std::size_t K, value_type& distance,
+                              bool reverse) {
   Queue_t ns;
   distance = std::numeric_limits<value_type>::infinity();
   const Distance& dist = *distance_;
+  value_type d;
   for (NodeVector_t::const_iterator itNode =
            connectedComponent->nodes().begin();
        itNode != connectedComponent->nodes().end(); ++itNode) {
-    value_type d = dist(*(*itNode)->configuration(), q);
+    if (reverse)
+      d = dist(q, *(*itNode)->configuration());
+    else
+      d = dist(*(*itNode)->configuration(), q);
     if (ns.size() < K)
       ns.push(DistAndNode_t(d, (*itNode)));
     else if (ns.top().first > d) {
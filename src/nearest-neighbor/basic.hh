@@ -58,7 +58,7 @@ class Basic : public NearestNeighbor {
   virtual Nodes_t KnearestSearch(
       const Configuration_t& configuration,
       const ConnectedComponentPtr_t& connectedComponent, const std::size_t K,
-      value_type& distance);
+      value_type& distance, bool reverse = false);
 
   virtual Nodes_t KnearestSearch(
       const NodePtr_t& node, const ConnectedComponentPtr_t& connectedComponent,
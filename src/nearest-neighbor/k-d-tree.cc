@@ -270,7 +270,7 @@ Nodes_t KDTree::KnearestSearch(const NodePtr_t&, const ConnectedComponentPtr_t&,
 
 Nodes_t KDTree::KnearestSearch(const Configuration_t&,
                                const ConnectedComponentPtr_t&,
-                               const std::size_t, value_type&) {
+                               const std::size_t, value_type&, bool) {
   assert(false && "K-nearest neighbor in KD-tree: unimplemented features");
 }
 
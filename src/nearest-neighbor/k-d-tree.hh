@@ -74,7 +74,7 @@ class KDTree : public NearestNeighbor {
   virtual Nodes_t KnearestSearch(
       const Configuration_t& configuration,
       const ConnectedComponentPtr_t& connectedComponent, const std::size_t K,
-      value_type& distance);
+      value_type& distance, bool reverse = false);
 
   /// Return the K nearest nodes in the whole roadmap
   /// \param configuration, the configuration to which distance is computed,
@@ -0,0 +1,317 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include "../src/nearest-neighbor/metric-tree.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <hpp/core/connected-component.hh>
+#include <hpp/core/distance.hh>
+#include <hpp/core/node.hh>
+#include <hpp/core/roadmap.hh>
+#include <limits>
+#include <queue>
+
+namespace hpp {
+namespace core {
+namespace nearestNeighbor {
+namespace {
+typedef std::pair<value_type, NodePtr_t> DistAndNode_t;
+struct DistAndNodeComp_t {
+  bool operator()(const DistAndNode_t& r, const DistAndNode_t& l) {
+    return r.first < l.first;
+  }
+};
+typedef std::priority_queue<DistAndNode_t, std::vector<DistAndNode_t>,
+                            DistAndNodeComp_t>
+    Queue_t;
+const value_type infty = std::numeric_limits<value_type>::infinity();
+}  // namespace
+
+struct MetricTree::Vertex {
+  /// Node of a leaf with its distances from and to the pivot of the leaf
+  struct Element {
+    NodePtr_t node;
+    value_type dOut, dIn;
+  };
+  Vertex(const NodePtr_t& p) : pivot(p), outRadius(0), inRadius(0) {}
+  NodePtr_t pivot;
+  /// Maximal distance from the pivot to the nodes of the subtree
+  value_type outRadius;
+  /// Maximal distance from the nodes of the subtree to the pivot
+  value_type inRadius;
+  /// Nodes of a leaf, except the pivot
+  std::vector<Element> bucket;
+  std::vector<std::unique_ptr<Vertex> > children;
+};
+
+/// Set of the K nearest nodes closer than a given distance
+struct MetricTree::Query {
+  Query(const Configuration_t& q, const ConnectedComponentPtr_t& c, bool rev,
+        std::size_t k, value_type maxD)
+      : configuration(q), cc(c), reverse(rev), K(k), maxDistance(maxD) {}
+  /// Nodes farther than the bound cannot be in the result
+  value_type bound() const {
+    return nodes.size() < K ? maxDistance : nodes.top().first;
+  }
+  bool accept(const NodePtr_t& node) const {
+    return !cc || node->connectedComponent() == cc;
+  }
+  void insert(value_type d, const NodePtr_t& node) {
+    if (!(d < bound())) return;
+    if (nodes.size() == K) nodes.pop();
+    nodes.push(DistAndNode_t(d, node));
+  }
+  /// Nodes sorted by increasing distance
+  Nodes_t result(value_type& distance) {
+    distance = nodes.empty() ? infty : nodes.top().first;
+    Nodes_t res;
+    while (!nodes.empty()) {
+      res.push_front(nodes.top().second);
+      nodes.pop();
+    }
+    return res;
+  }
+
+  const Configuration_t& configuration;
+  ConnectedComponentPtr_t cc;
+  /// If true, the distance from the configuration to the nodes is used.
+  bool reverse;
+  std::size_t K;
+  value_type maxDistance;
+  Queue_t nodes;
+};
+
+MetricTree::MetricTree(const DistancePtr_t& distance, bool symmetric,
+                       std::size_t bucketSize, std::size_t degree)
+    : distance_(distance),
+      symmetric_(symmetric),
+      bucketSize_(std::max<std::size_t>(bucketSize, 1)),
+      degree_(std::max<std::size_t>(degree, 2)) {}
+
+MetricTree::MetricTree() : symmetric_(false), bucketSize_(32), degree_(8) {}
+
+MetricTree::~MetricTree() {}
+
+void MetricTree::clear() {
+  root_.reset();
+  nodes_.clear();
+}
+
+void MetricTree::addNode(const NodePtr_t& node) {
+  nodes_.push_back(node);
+  if (!root_) {
+    root_.reset(new Vertex(node));
+    return;
+  }
+  const Distance& dist = *distance_;
+  const Configuration_t& q(*node->configuration());
+  Vertex* vertex = root_.get();
+  value_type dOut = dist(*vertex->pivot->configuration(), q);
+  while (true) {
+    value_type dIn =
+        symmetric_ ? dOut : dist(q, *vertex->pivot->configuration());
+    vertex->outRadius = std::max(vertex->outRadius, dOut);
+    vertex->inRadius = std::max(vertex->inRadius, dIn);
+    if (vertex->children.empty()) {
+      Vertex::Element element = {node, dOut, dIn};
+      vertex->bucket.push_back(element);
+      if (vertex->bucket.size() > bucketSize_) split(vertex);
+      return;
+    }
+    // Go down to the child with the closest pivot
+    Vertex* closest = NULL;
+    value_type dMin = infty;
+    for (const std::unique_ptr<Vertex>& child : vertex->children) {
+      value_type d = dist(*child->pivot->configuration(), q);
+      if (!closest || d < dMin) {
+        closest = child.get();
+        dMin = d;
+      }
+    }
+    vertex = closest;
+    dOut = dMin;
+  }
+}
+
+void MetricTree::split(Vertex* leaf) {
+  const Distance& dist = *distance_;
+  std::vector<Vertex::Element> elements;
+  elements.swap(leaf->bucket);
+  const std::size_t n = elements.size();
+  // Distance from each node to the closest pivot among the children
+  std::vector<value_type> dMin(n, infty);
+  std::vector<std::size_t> owner(n, 0);
+  std::vector<bool> isPivot(n, false);
+
+  // Farthest point sampling, starting with the node farthest from the pivot
+  // of the leaf.
+  std::size_t next = 0;
+  for (std::size_t i = 1; i < n; ++i)
+    if (elements[i].dOut > elements[next].dOut) next = i;
+  while (next < n && leaf->children.size() < degree_) {
+    isPivot[next] = true;
+    const std::size_t c = leaf->children.size();
+    leaf->children.emplace_back(new Vertex(elements[next].node));
+    const Configuration_t& p(*elements[next].node->configuration());
+    next = n;
+    for (std::size_t i = 0; i < n; ++i) {
+      if (isPivot[i]) continue;
+      value_type d = dist(p, *elements[i].node->configuration());
+      if (d < dMin[i]) {
+        dMin[i] = d;
+        owner[i] = c;
+      }
+      if (next == n || dMin[i] > dMin[next]) next = i;
+    }
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    if (isPivot[i]) continue;
+    Vertex* child = leaf->children[owner[i]].get();
+    const Configuration_t& q(*elements[i].node->configuration());
+    Vertex::Element element = {
+        elements[i].node, dMin[i],
+        symmetric_ ? dMin[i] : dist(q, *child->pivot->configuration())};
+    child->outRadius = std::max(child->outRadius, element.dOut);
+    child->inRadius = std::max(child->inRadius, element.dIn);
+    child->bucket.push_back(element);
+  }
+}
+
+value_type MetricTree::distance(const Query& query,
+                                const NodePtr_t& node) const {
+  const Distance& dist = *distance_;
+  if (query.reverse)
+    return dist(query.configuration, *node->configuration());
+  else
+    return dist(*node->configuration(), query.configuration);
+}
+
+void MetricTree::visit(const Vertex* vertex, value_type dPivot,
+                       Query& query) const {
+  if (query.accept(vertex->pivot)) query.insert(dPivot, vertex->pivot);
+  // By the triangle inequality,
+  //   d (node, q) >= d (pivot, q) - d (pivot, node)
+  //   d (q, node) >= d (q, pivot) - d (node, pivot)
+  for (const Vertex::Element& element : vertex->bucket) {
+    if (!query.accept(element.node)) continue;
+    value_type lowerBound =
+        dPivot - (query.reverse ? element.dIn : element.dOut);
+    if (lowerBound >= query.bound()) continue;
+    query.insert(distance(query, element.node), element.node);
+  }
+  if (vertex->children.empty()) return;
+  // Explore the children by increasing lower bound
+  typedef std::pair<value_type, std::pair<value_type, const Vertex*> >
+      Candidate_t;
+  std::vector<Candidate_t> candidates;
+  candidates.reserve(vertex->children.size());
+  for (const std::unique_ptr<Vertex>& child : vertex->children) {
+    value_type d = distance(query, child->pivot);
+    value_type lowerBound =
+        d - (query.reverse ? child->inRadius : child->outRadius);
+    // inf - inf: the child cannot be pruned.
+    if (std::isnan(lowerBound)) lowerBound = -infty;
+    candidates.push_back(
+        Candidate_t(lowerBound, std::make_pair(d, child.get())));
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [](const Candidate_t& a, const Candidate_t& b) {
+              return a.first < b.first;
+            });
+  for (const Candidate_t& c : candidates) {
+    if (c.first >= query.bound()) break;
+    visit(c.second.second, c.second.first, query);
+  }
+}
+
+void MetricTree::search(Query& query) const {
+  // For small connected components, a linear scan is cheaper than a search
+  // in the whole tree since pruning ignores connected components.
+  if (query.cc && (query.cc->nodes().size() <= bucketSize_ ||
+                   4 * query.cc->nodes().size() < nodes_.size())) {
+    for (const NodePtr_t& node : query.cc->nodes())
+      query.insert(distance(query, node), node);
+    return;
+  }
+  if (!root_) return;
+  visit(root_.get(), distance(query, root_->pivot), query);
+}
+
+NodePtr_t MetricTree::search(const Configuration_t& configuration,
+                             const ConnectedComponentPtr_t& connectedComponent,
+                             value_type& distance, bool reverse) {
+  Query query(configuration, connectedComponent, reverse, 1, infty);
+  search(query);
+  Nodes_t nodes(query.result(distance));
+  assert(!nodes.empty());
+  return nodes.empty() ? NodePtr_t() : nodes.front();
+}
+
+NodePtr_t MetricTree::search(const NodePtr_t& node,
+                             const ConnectedComponentPtr_t& connectedComponent,
+                             value_type& distance) {
+  return search(*node->configuration(), connectedComponent, distance, false);
+}
+
+Nodes_t MetricTree::KnearestSearch(
+    const Configuration_t& configuration,
+    const ConnectedComponentPtr_t& connectedComponent, const std::size_t K,
+    value_type& distance, bool reverse) {
+  Query query(configuration, connectedComponent, reverse, K, infty);
+  if (K > 0) search(query);
+  return query.result(distance);
+}
+
+Nodes_t MetricTree::KnearestSearch(
+    const NodePtr_t& node, const ConnectedComponentPtr_t& connectedComponent,
+    const std::size_t K, value_type& distance) {
+  return KnearestSearch(*node->configuration(), connectedComponent, K,
+                        distance);
+}
+
+Nodes_t MetricTree::KnearestSearch(const Configuration_t& configuration,
+                                   const RoadmapPtr_t&, const std::size_t K,
+                                   value_type& distance) {
+  Query query(configuration, ConnectedComponentPtr_t(), false, K, infty);
+  if (K > 0) search(query);
+  return query.result(distance);
+}
+
+NodeVector_t MetricTree::withinBall(const Configuration_t& configuration,
+                                    const ConnectedComponentPtr_t& cc,
+                                    value_type maxDistance) {
+  Query query(configuration, cc, false, std::numeric_limits<std::size_t>::max(),
+              maxDistance);
+  search(query);
+  value_type d;
+  Nodes_t nodes(query.result(d));
+  return NodeVector_t(nodes.begin(), nodes.end());
+}
+}  // namespace nearestNeighbor
+}  // namespace core
+}  // namespace hpp
@@ -0,0 +1,133 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_NEAREST_NEIGHBOR_METRIC_TREE_HH
+#define HPP_CORE_NEAREST_NEIGHBOR_METRIC_TREE_HH
+
+#include <hpp/core/fwd.hh>
+#include <hpp/core/nearest-neighbor.hh>
+#include <memory>
+
+namespace hpp {
+namespace core {
+namespace nearestNeighbor {
+/// Nearest neighbor search in a tree of metric balls
+///
+/// Each vertex of the tree holds a pivot node and the radius of a ball
+/// around the pivot containing the nodes of the subtree. Subtrees are
+/// pruned by the triangle inequality, so that only the Distance functor is
+/// used: the index is valid for distances like Reeds and Shepp or
+/// kinodynamic distances for which coordinate splits are meaningless.
+///
+/// Nodes are inserted incrementally in the subtree of the closest pivot.
+/// A leaf holding more than \c bucketSize nodes is split into \c degree
+/// children whose pivots are chosen by farthest point sampling.
+///
+/// Distances are not assumed to be symmetric: the radii of the balls are
+/// stored in both directions, which doubles the number of distance
+/// evaluations at insertion. The distance must however satisfy the triangle
+/// inequality.
+///
+/// Nodes are filtered by connected component during the search. Connected
+/// components that contain a small fraction of the roadmap are scanned
+/// linearly.
+class MetricTree : public NearestNeighbor {
+ public:
+  /// Constructor
+  /// \param distance distance between configurations,
+  /// \param symmetric whether the distance is known to be symmetric,
+  /// \param bucketSize maximal number of nodes in a leaf,
+  /// \param degree number of children of a vertex.
+  MetricTree(const DistancePtr_t& distance, bool symmetric = false,
+             std::size_t bucketSize = 32, std::size_t degree = 8);
+
+  ~MetricTree();
+
+  virtual void clear();
+
+  virtual void addNode(const NodePtr_t& node);
+
+  virtual NodePtr_t search(const NodePtr_t& node,
+                           const ConnectedComponentPtr_t& connectedComponent,
+                           value_type& distance);
+
+  virtual NodePtr_t search(const Configuration_t& configuration,
+                           const ConnectedComponentPtr_t& connectedComponent,
+                           value_type& distance, bool reverse = false);
+
+  virtual Nodes_t KnearestSearch(
+      const Configuration_t& configuration,
+      const ConnectedComponentPtr_t& connectedComponent, const std::size_t K,
+      value_type& distance, bool reverse = false);
+
+  virtual Nodes_t KnearestSearch(
+      const NodePtr_t& node, const ConnectedComponentPtr_t& connectedComponent,
+      const std::size_t K, value_type& distance);
+
+  virtual Nodes_t KnearestSearch(const Configuration_t& configuration,
+                                 const RoadmapPtr_t& roadmap,
+                                 const std::size_t K, value_type& distance);
+
+  NodeVector_t withinBall(const Configuration_t& configuration,
+                          const ConnectedComponentPtr_t& cc,
+                          value_type maxDistance);
+
+  /// Nodes are filtered by connected component at search time.
+  virtual void merge(ConnectedComponentPtr_t, ConnectedComponentPtr_t) {}
+
+  virtual DistancePtr_t distance() const { return distance_; }
+
+ private:
+  struct Vertex;
+  struct Query;
+
+  /// Distribute the nodes of a full leaf among new children
+  void split(Vertex* leaf);
+  /// Run a query from the root or by scanning a connected component
+  void search(Query& query) const;
+  /// Explore a subtree
+  /// \param dPivot distance between the query and the pivot of \c vertex.
+  void visit(const Vertex* vertex, value_type dPivot, Query& query) const;
+  /// Distance between the query and a node in the direction of the query
+  value_type distance(const Query& query, const NodePtr_t& node) const;
+
+  const DistancePtr_t distance_;
+  bool symmetric_;
+  std::size_t bucketSize_;
+  std::size_t degree_;
+  std::unique_ptr<Vertex> root_;
+  /// Nodes in the order of insertion
+  NodeVector_t nodes_;
+
+  MetricTree();
+  HPP_SERIALIZABLE();
+};  // class MetricTree
+}  // namespace nearestNeighbor
+}  // namespace core
+}  // namespace hpp
+
+#endif  // HPP_CORE_NEAREST_NEIGHBOR_METRIC_TREE_HH
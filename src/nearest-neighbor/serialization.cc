@@ -1,10 +1,12 @@
 #include "basic.hh"
 // #include "k-d-tree.hh"
+#include "metric-tree.hh"
 
 #include <hpp/core/distance.hh>
 #include <hpp/util/serialization.hh>
 
 BOOST_CLASS_EXPORT(hpp::core::nearestNeighbor::Basic)
+BOOST_CLASS_EXPORT(hpp::core::nearestNeighbor::MetricTree)
 // BOOST_CLASS_EXPORT(hpp::core::nearestNeighbor::KDTree)
 
 namespace hpp {
@@ -32,6 +34,27 @@ inline void Basic::serialize(Archive& ar, const unsigned int version) {
 
 HPP_SERIALIZATION_IMPLEMENT(Basic);
 
+template <typename Archive>
+inline void MetricTree::serialize(Archive& ar, const unsigned int version) {
+  (void)version;
+  ar& boost::serialization::make_nvp(
+      "base", boost::serialization::base_object<NearestNeighbor>(*this));
+  ar& boost::serialization::make_nvp("distance_",
+                                     const_cast<DistancePtr_t&>(distance_));
+  ar& BOOST_SERIALIZATION_NVP(symmetric_);
+  ar& BOOST_SERIALIZATION_NVP(bucketSize_);
+  ar& BOOST_SERIALIZATION_NVP(degree_);
+  // The tree is not stored but built again from the nodes.
+  ar& BOOST_SERIALIZATION_NVP(nodes_);
+  if (Archive::is_loading::value) {
+    NodeVector_t nodes;
+    nodes.swap(nodes_);
+    for (const NodePtr_t& node : nodes) addNode(node);
+  }
+}
+
+HPP_SERIALIZATION_IMPLEMENT(MetricTree);
+
 /*
 template <typename Archive>
 inline void KDTree::serialize(Archive& ar, const unsigned int version)
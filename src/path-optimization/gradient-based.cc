@@ -0,0 +1,443 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <hpp/fcl/collision.h>
+
+#include <algorithm>
+#include <cmath>
+#include <hpp/core/collision-validation-report.hh>
+#include <hpp/core/config-projector.hh>
+#include <hpp/core/constraint-set.hh>
+#include <hpp/core/path-optimization/gradient-based.hh>
+#include <hpp/core/path-optimization/quadratic-program.hh>
+#include <hpp/core/path-validation-report.hh>
+#include <hpp/core/path-validation.hh>
+#include <hpp/core/problem.hh>
+#include <hpp/core/weighed-distance.hh>
+#include <hpp/pinocchio/configuration.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/util/debug.hh>
+#include <hpp/util/timer.hh>
+#include <path-optimization/gradient-based/collision-constraints-result.hh>
+#include <path-optimization/gradient-based/path-length.hh>
+#include <pinocchio/multibody/model.hpp>
+#include <pinocchio/spatial/fcl-pinocchio-conversions.hpp>
+
+namespace hpp {
+namespace core {
+namespace pathOptimization {
+HPP_DEFINE_TIMECOUNTER(GradientBased_computeIterate);
+HPP_DEFINE_TIMECOUNTER(GradientBased_validatePath);
+
+GradientBasedPtr_t GradientBased::create(const ProblemConstPtr_t& problem) {
+  GradientBased* ptr = new GradientBased(problem);
+  return GradientBasedPtr_t(ptr);
+}
+
+GradientBased::GradientBased(const ProblemConstPtr_t& problem)
+    : PathOptimizer(problem),
+      robot_(problem->robot()),
+      configSize_(robot_->configSize()),
+      robotNumberDofs_(robot_->numberDof()),
+      robotNbNonLockedDofs_(robot_->numberDof()),
+      numberDofs_(0),
+      fSize_(0),
+      nbWaypoints_(0),
+      collision_(0, 0),
+      epsilon_(problem->getParameter("GradientBased/epsilon").floatValue()),
+      costThreshold_(
+          problem->getParameter("GradientBased/costThreshold").floatValue()),
+      alphaInit_(problem->getParameter("GradientBased/alphaInit").floatValue()),
+      alphaMax_(problem->getParameter("GradientBased/alphaMax").floatValue()) {
+  distance_ = HPP_DYNAMIC_PTR_CAST(WeighedDistance, problem->distance());
+  if (!distance_) distance_ = WeighedDistance::createFromProblem(problem);
+  steeringMethod_ = steeringMethod::Straight::create(problem);
+}
+
+GradientBased::~GradientBased() {
+  HPP_DISPLAY_TIMECOUNTER(GradientBased_computeIterate);
+  HPP_DISPLAY_TIMECOUNTER(GradientBased_validatePath);
+}
+
+void GradientBased::initialize(const PathVectorPtr_t& path) {
+  nbWaypoints_ = (size_type)path->numberPaths() - 1;
+  initial_ = path->initial();
+  end_ = path->end();
+
+  // Weights of the degrees of freedom
+  const ::pinocchio::Model& model(robot_->model());
+  vector_t weights(vector_t::Ones(robotNumberDofs_));
+  for (std::size_t i = 1; i < model.joints.size(); ++i)
+    weights.segment(model.joints[i].idx_v(), model.joints[i].nv())
+        .setConstant(distance_->getWeight(i - 1));
+  cost_ = PathLength::create(robot_, weights, initial_, end_, nbWaypoints_);
+
+  initializeProblemConstraints();
+  numberDofs_ = nbWaypoints_ * robotNbNonLockedDofs_;
+
+  H_.resize(nbWaypoints_ * robotNumberDofs_, nbWaypoints_ * robotNumberDofs_);
+  cost_->hessian(H_);
+  Hz_.resize(numberDofs_, numberDofs_);
+  compressHessian(H_, Hz_);
+
+  rgrad_.resize(1, nbWaypoints_ * robotNumberDofs_);
+  gradient_.resize(numberDofs_);
+  stepNormal_.resize(nbWaypoints_ * robotNumberDofs_);
+  collision_ = LinearConstraint(numberDofs_, 0);
+  collisionConstraints_.clear();
+}
+
+void GradientBased::initializeProblemConstraints() {
+  const ConstraintSetPtr_t& constraints(problem()->constraints());
+  configProjector_ =
+      constraints ? constraints->configProjector() : ConfigProjectorPtr_t();
+  if (configProjector_) {
+    robotNbNonLockedDofs_ = configProjector_->numberFreeVariables();
+    fSize_ = configProjector_->dimension();
+    value_.resize(configProjector_->solver().dimension());
+  } else {
+    robotNbNonLockedDofs_ = robotNumberDofs_;
+    fSize_ = 0;
+  }
+  J_ = matrix_t::Zero(nbWaypoints_ * fSize_,
+                      nbWaypoints_ * robotNbNonLockedDofs_);
+}
+
+void GradientBased::updateProblemConstraints(vectorIn_t x) {
+  if (fSize_ == 0) return;
+  // The Jacobian is block diagonal: only the diagonal blocks are written.
+  for (size_type i = 0; i < nbWaypoints_; ++i) {
+    configProjector_->computeValueAndJacobian(
+        x.segment(i * configSize_, configSize_), value_,
+        J_.block(i * fSize_, i * robotNbNonLockedDofs_, fSize_,
+                 robotNbNonLockedDofs_));
+  }
+}
+
+bool GradientBased::solveConstraints(vectorOut_t x) const {
+  if (!configProjector_) return true;
+  Configuration_t q(configSize_);
+  for (size_type i = 0; i < nbWaypoints_; ++i) {
+    q = x.segment(i * configSize_, configSize_);
+    if (!configProjector_->apply(q)) {
+      hppDout(info, "Failed to project waypoint " << i);
+      return false;
+    }
+    x.segment(i * configSize_, configSize_) = q;
+  }
+  return true;
+}
+
+void GradientBased::compressHessian(matrixIn_t normal,
+                                    matrixOut_t small) const {
+  if (!configProjector_) {
+    small = normal;
+    return;
+  }
+  const size_type n(robotNumberDofs_), m(robotNbNonLockedDofs_);
+  matrix_t block(m, m);
+  // The Hessian of the path length is block tridiagonal: other blocks are
+  // zero and remain so once compressed.
+  small.setZero();
+  for (size_type i = 0; i < nbWaypoints_; ++i)
+    for (size_type j = std::max<size_type>(i - 1, 0);
+         j < std::min(i + 2, nbWaypoints_); ++j) {
+      configProjector_->compressMatrix(normal.block(i * n, j * n, n, n), block,
+                                       true);
+      small.block(i * m, j * m, m, m) = block;
+    }
+}
+
+void GradientBased::compressVector(vectorIn_t normal, vectorOut_t small) const {
+  if (!configProjector_) {
+    small = normal;
+    return;
+  }
+  const size_type n(robotNumberDofs_), m(robotNbNonLockedDofs_);
+  for (size_type i = 0; i < nbWaypoints_; ++i)
+    configProjector_->compressVector(normal.segment(i * n, n),
+                                     small.segment(i * m, m));
+}
+
+void GradientBased::uncompressVector(vectorIn_t small,
+                                     vectorOut_t normal) const {
+  if (!configProjector_) {
+    normal = small;
+    return;
+  }
+  const size_type n(robotNumberDofs_), m(robotNbNonLockedDofs_);
+  // Degrees of freedom computed explicitly are updated by projection.
+  normal.setZero();
+  for (size_type i = 0; i < nbWaypoints_; ++i)
+    configProjector_->uncompressVector(small.segment(i * m, m),
+                                       normal.segment(i * n, n));
+}
+
+void GradientBased::integrate(vectorIn_t x0, vectorIn_t step,
+                              vectorOut_t x1) const {
+  uncompressVector(step, stepNormal_);
+  Configuration_t q(configSize_);
+  for (size_type i = 0; i < nbWaypoints_; ++i) {
+    pinocchio::integrate(robot_, x0.segment(i * configSize_, configSize_),
+                         stepNormal_.segment(i * robotNumberDofs_,
+                                             robotNumberDofs_),
+                         q);
+    x1.segment(i * configSize_, configSize_) = q;
+  }
+}
+
+bool GradientBased::computeIterate(vectorIn_t x, vectorOut_t step) {
+  HPP_SCOPE_TIMECOUNTER(GradientBased_computeIterate);
+  updateProblemConstraints(x);
+  cost_->jacobian(rgrad_, x);
+  compressVector(rgrad_.row(0).transpose(), gradient_);
+
+  // Waypoints satisfy the problem constraints: the step must stay in the
+  // tangent space of the constraints.
+  LinearConstraint equality(numberDofs_, J_.rows());
+  equality.J = J_;
+  if (!equality.decompose(true)) return false;
+
+  QuadraticProgram QP(numberDofs_);
+  QP.H = Hz_;
+  QP.b = gradient_;
+  QP.bIsZero = false;
+  QuadraticProgram QPc(QP, equality);
+  if (QPc.H.rows() == 0) {
+    step = equality.xStar;
+    return true;
+  }
+  QPc.computeLLT();
+
+  LinearConstraint collisionReduced(QPc.H.rows(), 0),
+      none(QPc.H.rows(), 0);
+  equality.reduceConstraint(collision_, collisionReduced, false);
+  value_type cost = QPc.solve(none, collisionReduced);
+  if (!std::isfinite(cost)) {
+    hppDout(info, "Linearized collision constraints are not feasible.");
+    return false;
+  }
+  equality.computeSolution(QPc.xStar);
+  step = equality.xSol;
+  return true;
+}
+
+Configuration_t GradientBased::configAtParameter(const PathVectorPtr_t& path,
+                                                 size_type rank,
+                                                 value_type s) const {
+  const PathPtr_t& segment(path->pathAtRank(rank));
+  const interval_t& range(segment->timeRange());
+  bool success;
+  Configuration_t q(segment->eval(
+      range.first + s * (range.second - range.first), success));
+  if (!success) hppDout(warning, "Failed to evaluate segment " << rank);
+  return q;
+}
+
+bool GradientBased::addCollisionConstraint(
+    const PathValidationReportPtr_t& report,
+    const PathVectorPtr_t& collisionPath, const PathVectorPtr_t& validPath) {
+  if (collision_.J.rows() + 1 >= numberDofs_) {
+    hppDout(info, "No more collision constraints can be added.");
+    return false;
+  }
+  CollisionValidationReportPtr_t collisionReport(
+      HPP_DYNAMIC_PTR_CAST(CollisionValidationReport,
+                           report->configurationReport));
+  if (!collisionReport) return false;
+  const CollisionObjectConstPtr_t& o1(collisionReport->object1);
+  const CollisionObjectConstPtr_t& o2(collisionReport->object2);
+  if (!o1 || !o2) return false;
+
+  value_type localParam;
+  size_type rank =
+      (size_type)collisionPath->rankAtParam(report->parameter, localParam);
+  const interval_t& range(collisionPath->pathAtRank(rank)->timeRange());
+  value_type s = 0;
+  if (range.second > range.first)
+    s = (localParam - range.first) / (range.second - range.first);
+  s = std::min(std::max(s, 0.), 1.);
+
+  bool success;
+  Configuration_t qColl(collisionPath->eval(report->parameter, success));
+  if (!success) return false;
+
+  // The report of the path validation may not contain the contact:
+  // recompute it.
+  fcl::CollisionResult result;
+  {
+    using ::pinocchio::toFclTransform3f;
+    pinocchio::DeviceSync device(robot_);
+    device.currentConfiguration(qColl);
+    device.computeForwardKinematics();
+    device.updateGeometryPlacements();
+    fcl::CollisionRequest request(fcl::CONTACT, 1);
+    fcl::collide(o1->geometry().get(),
+                 toFclTransform3f(o1->getTransform(device.d())),
+                 o2->geometry().get(),
+                 toFclTransform3f(o2->getTransform(device.d())), request,
+                 result);
+  }
+  if (result.numContacts() == 0) return false;
+  const fcl::Contact& contact(result.getContact(0));
+
+  CollisionConstraintsResult ccr(robot_, o1, o2, contact.pos, contact.normal,
+                                 qColl,
+                                 configAtParameter(validPath, rank, s), rank,
+                                 s);
+  if (ccr.isFixed()) return false;
+
+  // The configuration on the segment depends on both waypoints.
+  vector_t row(vector_t::Zero(nbWaypoints_ * robotNumberDofs_));
+  if (rank > 0)
+    row.segment((rank - 1) * robotNumberDofs_, robotNumberDofs_) =
+        (1 - s) * ccr.jacobian().transpose();
+  if (rank < nbWaypoints_)
+    row.segment(rank * robotNumberDofs_, robotNumberDofs_) =
+        s * ccr.jacobian().transpose();
+  vector_t compressed(numberDofs_);
+  compressVector(row, compressed);
+  if (compressed.isZero()) return false;
+
+  collision_.addRows(1);
+  collision_.J.bottomRows<1>() = compressed.transpose();
+  collision_.b[collision_.b.size() - 1] = 0;
+  collisionConstraints_.push_back(ccr);
+  hppDout(info, "Added collision constraint between "
+                    << o1->name() << " and " << o2->name() << " on segment "
+                    << rank << " at " << s);
+  return true;
+}
+
+void GradientBased::updateRightHandSide(const PathVectorPtr_t& validPath) {
+  // The step p must satisfy J p >= -c(x) so that p = 0 is feasible when
+  // the latest valid path satisfies the constraints.
+  for (std::size_t i = 0; i < collisionConstraints_.size(); ++i) {
+    const CollisionConstraintsResult& ccr(collisionConstraints_[i]);
+    collision_.b[i] =
+        -ccr.value(configAtParameter(validPath, ccr.rank, ccr.parameter));
+  }
+}
+
+PathVectorPtr_t GradientBased::optimize(const PathVectorPtr_t& path) {
+  monitorExecution();
+  PathVectorPtr_t flat(
+      PathVector::create(path->outputSize(), path->outputDerivativeSize()));
+  path->flatten(flat);
+  if (flat->numberPaths() < 2) return path;
+
+  robot_->controlComputation((pinocchio::Computation_t)(
+      robot_->computationFlag() | pinocchio::JACOBIAN));
+  initialize(flat);
+  vector_t x(nbWaypoints_ * configSize_);
+  pathToVector(flat, x);
+
+  PathValidationPtr_t pathValidation(problem()->pathValidation());
+  PathPtr_t validPart;
+  PathValidationReportPtr_t report;
+  PathVectorPtr_t validPath(vectorToPath(x));
+  if (!validPath ||
+      !pathValidation->validate(validPath, false, validPart, report)) {
+    hppDout(info, "Input path is not valid once made of straight paths.");
+    return path;
+  }
+
+  value_type cost = (*cost_)(x).vector()[0];
+  hppDout(info, "Initial cost is " << cost);
+  vector_t step(numberDofs_), x1(x.size());
+  value_type alpha = alphaInit_;
+  while (!shouldStop()) {
+    if (!computeIterate(x, step)) break;
+    if (step.norm() < epsilon_) {
+      hppDout(info, "Minimum reached.");
+      break;
+    }
+    integrate(x, alpha * step, x1);
+
+    PathVectorPtr_t candidate;
+    bool valid = solveConstraints(x1);
+    if (valid) {
+      candidate = vectorToPath(x1);
+      valid = (bool)candidate;
+    }
+    if (valid) {
+      HPP_SCOPE_TIMECOUNTER(GradientBased_validatePath);
+      valid = pathValidation->validate(candidate, false, validPart, report);
+    }
+    if (valid) {
+      value_type newCost = (*cost_)(x1).vector()[0];
+      hppDout(info, "Improved path with alpha = " << alpha
+                                                  << ", cost = " << newCost);
+      x = x1;
+      validPath = candidate;
+      updateRightHandSide(validPath);
+      bool converged = cost - newCost < costThreshold_ * cost;
+      cost = newCost;
+      if (converged) {
+        hppDout(info, "Stopping because cost improvement is small.");
+        break;
+      }
+      alpha = std::min(alphaMax_, 2 * alpha);
+    } else if (!candidate || !report ||
+               !addCollisionConstraint(report, candidate, validPath)) {
+      alpha *= .5;
+      if (alpha < alphaInit_ / (1 << 4)) {
+        hppDout(info, "Interruption because alpha became too small.");
+        break;
+      }
+    }
+    endIteration();
+  }
+  return validPath;
+}
+
+// ----------- Declare parameters ------------------------------------- //
+
+HPP_START_PARAMETER_DECLARATION(GradientBased)
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "GradientBased/alphaInit",
+    "In ]0,1]. The initial ratio of the step toward the optimum of the "
+    "linearized problem.",
+    Parameter(0.2)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "GradientBased/alphaMax",
+    "In ]0,1]. The maximal ratio of the step toward the optimum of the "
+    "linearized problem.",
+    Parameter(1.)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "GradientBased/costThreshold",
+    "Stop optimizing if the cost improves less than this ratio between two "
+    "iterations.",
+    Parameter(1e-3)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "GradientBased/epsilon",
+    "Stop optimizing when the norm of the step is below this threshold.",
+    Parameter(1e-6)));
+HPP_END_PARAMETER_DECLARATION(GradientBased)
+}  // namespace pathOptimization
+}  // namespace core
+}  // namespace hpp
@@ -0,0 +1,145 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_PATH_OPTIMIZATION_GRADIENT_BASED_COLLISION_CONSTRAINTS_RESULT_HH
+#define HPP_CORE_PATH_OPTIMIZATION_GRADIENT_BASED_COLLISION_CONSTRAINTS_RESULT_HH
+
+#include <hpp/constraints/generic-transformation.hh>
+#include <hpp/core/fwd.hh>
+#include <hpp/pinocchio/collision-object.hh>
+#include <hpp/pinocchio/device-data.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/joint.hh>
+#include <hpp/pinocchio/liegroup-element.hh>
+
+namespace hpp {
+namespace core {
+namespace pathOptimization {
+/// Collision constraint between two objects along a piecewise straight path
+///
+/// Given a contact point \f$p\f$ and normal \f$n\f$ computed in a
+/// configuration in collision, the points of each object located at
+/// \f$p\f$ in this configuration are attached to the objects. The
+/// constraint is
+/// \f[
+/// c(q) = n^T (p_2(q) - p_1(q)) - n^T (p_2(q_{free}) - p_1(q_{free})) \geq 0
+/// \f]
+/// where \f$q_{free}\f$ is the configuration at the same position along
+/// the latest valid path: the objects may not get closer than along this
+/// path.
+///
+/// The constraint applies to the configuration at parameter \f$s\f$
+/// of the segment of given rank. This configuration is approximated by
+/// \f$(1-s) q_{rank} + s q_{rank+1}\f$ to compute the Jacobian with respect
+/// to the waypoints.
+class HPP_CORE_LOCAL CollisionConstraintsResult {
+ public:
+  /// \param contact, normal contact point and normal in configuration
+  ///        qColl,
+  /// \param segment, s rank of the segment and parameter along it.
+  CollisionConstraintsResult(const DevicePtr_t& robot,
+                             const CollisionObjectConstPtr_t& object1,
+                             const CollisionObjectConstPtr_t& object2,
+                             const vector3_t& contact, const vector3_t& normal,
+                             ConfigurationIn_t qColl, ConfigurationIn_t qFree,
+                             size_type segment, value_type s)
+      : rank(segment), parameter(s), normal_(normal), reference_(0) {
+    {
+      pinocchio::DeviceSync device(robot);
+      device.currentConfiguration(qColl);
+      device.computeForwardKinematics();
+      attach(robot, device.d(), object1, contact, f1_, p1_);
+      attach(robot, device.d(), object2, contact, f2_, p2_);
+    }
+    reference_ = separation(qFree);
+    // The points coincide in qColl and are separated in qFree: orient the
+    // normal so that the separation increases from qColl to qFree.
+    if (reference_ < 0) {
+      normal_ = -normal_;
+      reference_ = -reference_;
+    }
+    J_ = rowvector_t::Zero(robot->numberDof());
+    matrix_t J(3, robot->numberDof());
+    if (f2_) {
+      f2_->jacobian(J, qFree);
+      J_ += normal_.transpose() * J;
+    }
+    if (f1_) {
+      f1_->jacobian(J, qFree);
+      J_ -= normal_.transpose() * J;
+    }
+  }
+
+  /// Value of the constraint in a configuration
+  value_type value(ConfigurationIn_t q) const {
+    return separation(q) - reference_;
+  }
+
+  /// Jacobian of the constraint in configuration \f$q_{free}\f$
+  const rowvector_t& jacobian() const { return J_; }
+
+  /// Whether the objects move with the robot
+  bool isFixed() const { return !f1_ && !f2_; }
+
+  /// Rank of the segment in the path
+  size_type rank;
+  /// Parameter in [0,1] along the segment
+  value_type parameter;
+
+ private:
+  /// Position of the point of an object at p in the configuration of d.
+  /// Obstacles do not move and f is left empty.
+  static void attach(const DevicePtr_t& robot, const pinocchio::DeviceData& d,
+                     const CollisionObjectConstPtr_t& object,
+                     const vector3_t& p, DifferentiableFunctionPtr_t& f,
+                     vector3_t& position) {
+    static const matrix3_t I3(matrix3_t::Identity());
+    position = p;
+    JointConstPtr_t joint(object->joint());
+    if (!joint || joint->index() == 0) return;
+    Transform3f M(joint->currentTransformation(d));
+    f = constraints::Position::create("", robot, joint,
+                                      Transform3f(I3, M.actInv(p)),
+                                      Transform3f::Identity());
+  }
+
+  value_type separation(ConfigurationIn_t q) const {
+    vector3_t p1(f1_ ? vector3_t((*f1_)(q).vector()) : p1_);
+    vector3_t p2(f2_ ? vector3_t((*f2_)(q).vector()) : p2_);
+    return normal_.dot(p2 - p1);
+  }
+
+  DifferentiableFunctionPtr_t f1_, f2_;
+  vector3_t p1_, p2_;
+  vector3_t normal_;
+  value_type reference_;
+  rowvector_t J_;
+};  // class CollisionConstraintsResult
+}  // namespace pathOptimization
+}  // namespace core
+}  // namespace hpp
+#endif  // HPP_CORE_PATH_OPTIMIZATION_GRADIENT_BASED_COLLISION_CONSTRAINTS_RESULT_HH
@@ -0,0 +1,133 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_PATH_OPTIMIZATION_GRADIENT_BASED_PATH_LENGTH_HH
+#define HPP_CORE_PATH_OPTIMIZATION_GRADIENT_BASED_PATH_LENGTH_HH
+
+#include <hpp/core/path-optimization/cost.hh>
+#include <hpp/pinocchio/configuration.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/liegroup-element.hh>
+
+namespace hpp {
+namespace core {
+namespace pathOptimization {
+/// Sum of the squared weighed lengths of the segments of a piecewise
+/// straight path
+///
+/// The input is the vector of waypoints, the initial and end
+/// configurations are fixed:
+/// \f[
+/// C(q_1,\cdots,q_n) = \frac{1}{2}\sum_{i=0}^{n}
+///                     \|W (q_{i+1} \ominus q_i)\|^2
+/// \f]
+/// where \f$W\f$ is the diagonal matrix of the weights of the degrees of
+/// freedom.
+///
+/// \note The derivative of the difference operator is approximated by
+/// identity, which is exact for vector spaces and SO(2).
+class HPP_CORE_LOCAL PathLength : public Cost {
+ public:
+  typedef shared_ptr<PathLength> Ptr_t;
+
+  /// \param weights weights of the degrees of freedom.
+  static Ptr_t create(const DevicePtr_t& robot, const vector_t& weights,
+                      ConfigurationIn_t initial, ConfigurationIn_t end,
+                      size_type nbWaypoints) {
+    return Ptr_t(new PathLength(robot, weights, initial, end, nbWaypoints));
+  }
+
+  /// The Hessian is constant, block tridiagonal.
+  virtual void hessian(matrixOut_t hessian) const {
+    const size_type nv(robot_->numberDof());
+    hessian.setZero();
+    for (size_type i = 0; i < nbWaypoints_; ++i) {
+      hessian.block(i * nv, i * nv, nv, nv).diagonal() = 2 * weights2_;
+      if (i + 1 < nbWaypoints_) {
+        hessian.block(i * nv, (i + 1) * nv, nv, nv).diagonal() = -weights2_;
+        hessian.block((i + 1) * nv, i * nv, nv, nv).diagonal() = -weights2_;
+      }
+    }
+  }
+
+ protected:
+  PathLength(const DevicePtr_t& robot, const vector_t& weights,
+             ConfigurationIn_t initial, ConfigurationIn_t end,
+             size_type nbWaypoints)
+      : Cost(nbWaypoints * robot->configSize(),
+             nbWaypoints * robot->numberDof(), "PathLength"),
+        robot_(robot),
+        weights2_(weights.cwiseAbs2()),
+        initial_(initial),
+        end_(end),
+        nbWaypoints_(nbWaypoints),
+        differences_(robot->numberDof(), nbWaypoints + 1) {
+    assert(weights.size() == robot->numberDof());
+  }
+
+  virtual void impl_compute(LiegroupElementRef result,
+                            vectorIn_t argument) const {
+    computeDifferences(argument);
+    result.vector()[0] =
+        .5 * (weights2_.asDiagonal() * differences_)
+                 .cwiseProduct(differences_)
+                 .sum();
+  }
+
+  virtual void impl_jacobian(matrixOut_t jacobian,
+                             vectorIn_t argument) const {
+    computeDifferences(argument);
+    const size_type nv(robot_->numberDof());
+    for (size_type i = 0; i < nbWaypoints_; ++i)
+      jacobian.middleCols(i * nv, nv) =
+          (weights2_.cwiseProduct(differences_.col(i) -
+                                  differences_.col(i + 1)))
+              .transpose();
+  }
+
+ private:
+  /// Store \f$q_{i+1} \ominus q_i\f$ in column i of differences_
+  void computeDifferences(vectorIn_t x) const {
+    const size_type nq(robot_->configSize());
+    for (size_type i = 0; i <= nbWaypoints_; ++i) {
+      Configuration_t q0(i == 0 ? initial_ : x.segment((i - 1) * nq, nq));
+      Configuration_t q1(i == nbWaypoints_ ? end_ : x.segment(i * nq, nq));
+      pinocchio::difference<pinocchio::DefaultLieGroupMap>(
+          robot_, q1, q0, differences_.col(i));
+    }
+  }
+
+  DevicePtr_t robot_;
+  vector_t weights2_;
+  Configuration_t initial_, end_;
+  size_type nbWaypoints_;
+  mutable matrix_t differences_;
+};  // class PathLength
+}  // namespace pathOptimization
+}  // namespace core
+}  // namespace hpp
+#endif  // HPP_CORE_PATH_OPTIMIZATION_GRADIENT_BASED_PATH_LENGTH_HH
@@ -33,6 +33,7 @@
 #include <hpp/core/path-optimization/spline-gradient-based-abstract.hh>
 #include <hpp/core/path-validation.hh>
 #include <hpp/core/problem.hh>
+#include <hpp/core/reversed-path.hh>
 #include <hpp/core/straight-path.hh>
 #include <hpp/pinocchio/device.hh>
 #include <hpp/util/exception-factory.hh>
@@ -173,6 +174,12 @@ void SplineGradientBasedAbstract<_PB, _SO>::appendEquivalentSpline(
     const PathVectorPtr_t& path, Splines_t& splines) const {
   for (std::size_t i = 0; i < path->numberPaths(); ++i) {
     PathPtr_t p = path->pathAtRank(i);
+    ReversedPathPtr_t reversed(HPP_DYNAMIC_PTR_CAST(ReversedPath, p));
+    if (reversed) {
+      // Reverse the original path into a path of the same type.
+      const interval_t& tr(reversed->original()->timeRange());
+      p = reversed->original()->extract(tr.second, tr.first);
+    }
     StraightPathPtr_t straight(HPP_DYNAMIC_PTR_CAST(StraightPath, p));
     PathVectorPtr_t pvect(HPP_DYNAMIC_PTR_CAST(PathVector, p));
     InterpolatedPathPtr_t intp(HPP_DYNAMIC_PTR_CAST(InterpolatedPath, p));
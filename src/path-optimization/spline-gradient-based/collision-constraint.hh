@@ -36,9 +36,11 @@
 
 #include <hpp/constraints/generic-transformation.hh>
 #include <hpp/pinocchio/configuration.hh>
+#include <hpp/pinocchio/device.hh>
 #include <hpp/pinocchio/util.hh>
 #include <hpp/util/exception-factory.hh>
 #include <pinocchio/multibody/liegroup/liegroup.hpp>
+#include <pinocchio/spatial/fcl-pinocchio-conversions.hpp>
 
 namespace hpp {
 namespace core {
@@ -128,15 +130,19 @@ class CollisionFunction : public DifferentiableFunction {
 
   fcl::CollisionResult checkCollision(const Configuration_t& q,
                                       bool enableContact) {
-    robot_->currentConfiguration(q);
-    robot_->computeForwardKinematics();
-    robot_->updateGeometryPlacements();
+    using ::pinocchio::toFclTransform3f;
+    pinocchio::DeviceSync device(robot_);
+    device.currentConfiguration(q);
+    device.computeForwardKinematics();
+    device.updateGeometryPlacements();
     fcl::CollisionResult result;
     fcl::CollisionRequestFlag flag =
         enableContact ? fcl::CONTACT : fcl::NO_REQUEST;
     fcl::CollisionRequest collisionRequest(flag, 1);
-    fcl::collide(object1_->geometry().get(), object1_->getFclTransform(),
-                 object2_->geometry().get(), object2_->getFclTransform(),
+    fcl::collide(object1_->geometry().get(),
+                 toFclTransform3f(object1_->getTransform(device.d())),
+                 object2_->geometry().get(),
+                 toFclTransform3f(object2_->getTransform(device.d())),
                  collisionRequest, result);
     return result;
   }
@@ -147,9 +153,6 @@ class CollisionFunction : public DifferentiableFunction {
     DifferentiableFunctionPtr_t f;
     vector3_t u;
 
-    robot_->currentConfiguration(qColl_);
-    robot_->computeForwardKinematics();
-
     if (!object2_->joint() || object2_->joint()->index() == 0) {
       object1_.swap(object2_);
     }
@@ -157,20 +160,29 @@ class CollisionFunction : public DifferentiableFunction {
     JointConstPtr_t joint1 = object1_->joint();
     JointConstPtr_t joint2 = object2_->joint();
     assert(joint2 && joint2->index() > 0);
-    Transform3f M2(joint2->currentTransformation());
+    bool bodyPart1 = joint1 && joint1->index() > 0;
+
+    // Joint placements in configurations qColl and qFree. The device data
+    // is released before computing the Jacobian that locks its own.
+    Transform3f M1, M2, M1Free, M2Free;
+    {
+      pinocchio::DeviceSync device(robot_);
+      device.currentConfiguration(qColl_);
+      device.computeForwardKinematics();
+      M2 = joint2->currentTransformation(device.d());
+      if (bodyPart1) M1 = joint1->currentTransformation(device.d());
+      device.currentConfiguration(qFree_);
+      device.computeForwardKinematics();
+      M2Free = joint2->currentTransformation(device.d());
+      if (bodyPart1) M1Free = joint1->currentTransformation(device.d());
+    }
     vector3_t x2_J2(M2.actInv(contactPoint_));
 
-    if (joint1 && joint1->index() > 0) {  // object1 = body part
-      Transform3f M1(joint1->currentTransformation());
+    if (bodyPart1) {  // object1 = body part
       // Position of contact point in each object local frame
       vector3_t x1_J1 = M1.actInv(contactPoint_);
-      // Compute contact points in configuration qFree
-      robot_->currentConfiguration(qFree_);
-      robot_->computeForwardKinematics();
-      M2 = joint2->currentTransformation();
-      M1 = joint1->currentTransformation();
-      // Position of x1 in local frame of joint2
-      vector3_t x1_J2(M2.actInv(M1.act(x1_J1)));
+      // Position of x1 in local frame of joint2 in configuration qFree
+      vector3_t x1_J2(M2Free.actInv(M1Free.act(x1_J1)));
       hppDout(info, "x2 in J2 = " << x2_J2.transpose());
       hppDout(info, "x1 in J2 = " << x1_J2.transpose());
 
@@ -180,12 +192,8 @@ class CollisionFunction : public DifferentiableFunction {
                                                 Transform3f(I3, x2_J2));
     } else {  // object1 = fixed obstacle and has no joint
       vector3_t x1_J1(contactPoint_);
-      // Compute contact points in configuration qFree
-      robot_->currentConfiguration(qFree_);
-      robot_->computeForwardKinematics();
-      Transform3f M2(joint2->currentTransformation());
-      // position of x2 in global frame
-      vector3_t x2_J1(M2.act(x2_J2));
+      // position of x2 in global frame in configuration qFree
+      vector3_t x2_J1(M2Free.act(x2_J2));
       hppDout(info, "x2 in J1 = " << x2_J1.transpose());
 
       u = (x2_J1 - x2_J2).normalized();
@@ -0,0 +1,247 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <algorithm>
+#include <hpp/core/constraint-set.hh>
+#include <hpp/core/distance.hh>
+#include <hpp/core/path-optimization/windowed.hh>
+#include <hpp/core/path-vector.hh>
+#include <hpp/core/problem.hh>
+#include <hpp/core/steering-method.hh>
+#include <hpp/core/task-scheduler.hh>
+#include <hpp/util/debug.hh>
+#include <stdexcept>
+
+namespace hpp {
+namespace core {
+namespace pathOptimization {
+namespace {
+/// Tolerance on the distance between the end configurations of a window
+/// and of its optimized version.
+const value_type boundaryTolerance = 1e-6;
+
+/// Append the paths of \c path of rank in [begin, end) to \c result
+void appendRange(const PathVectorPtr_t& result, const PathVectorPtr_t& path,
+                 std::size_t begin, std::size_t end) {
+  for (std::size_t i = begin; i < end; ++i)
+    result->appendPath(path->pathAtRank(i));
+}
+
+PathVectorPtr_t flatten(const PathVectorPtr_t& path) {
+  PathVectorPtr_t result(
+      PathVector::create(path->outputSize(), path->outputDerivativeSize()));
+  path->flatten(result);
+  return result;
+}
+}  // namespace
+
+WindowedPtr_t Windowed::create(const ProblemConstPtr_t& problem,
+                               const OptimizerBuilder_t& builder) {
+  Windowed* ptr = new Windowed(problem, builder);
+  return WindowedPtr_t(ptr);
+}
+
+Windowed::Windowed(const ProblemConstPtr_t& problem,
+                   const OptimizerBuilder_t& builder)
+    : PathOptimizer(problem), builder_(builder) {
+  if (!builder_)
+    throw std::invalid_argument("Windowed: the optimizer builder is empty.");
+}
+
+void Windowed::interrupt() {
+  PathOptimizer::interrupt();
+  std::lock_guard<std::mutex> lock(runningMutex_);
+  for (const PathOptimizerPtr_t& optimizer : running_) optimizer->interrupt();
+}
+
+PathVectorPtr_t Windowed::optimize(const PathVectorPtr_t& path) {
+  monitorExecution();
+
+  PathVectorPtr_t flat(flatten(path));
+  std::size_t n = flat->numberPaths();
+  std::size_t windowSize = (std::size_t)std::max<size_type>(
+      2, problem()
+             ->getParameter("PathOptimization/Windowed/WindowSize")
+             .intValue());
+  if (n == 0) return path;
+  if (n <= windowSize) return optimizeWindow(problem(), flat);
+
+  // First pass: disjoint windows.
+  PathVectors_t windows;
+  for (std::size_t begin = 0; begin < n; begin += windowSize) {
+    PathVectorPtr_t window(
+        PathVector::create(path->outputSize(), path->outputDerivativeSize()));
+    appendRange(window, flat, begin, std::min(begin + windowSize, n));
+    windows.push_back(window);
+  }
+  PathVectors_t results(optimizeWindows(windows));
+  hppDout(info, "optimized " << windows.size() << " windows");
+
+  PathVectorPtr_t result(
+      PathVector::create(path->outputSize(), path->outputDerivativeSize()));
+  if (interrupt_) {
+    for (const PathVectorPtr_t& r : results) result->concatenate(r);
+    return result;
+  }
+
+  // Second pass: windows going from the middle of a window of the first
+  // pass to the middle of the next one.
+  std::vector<std::size_t> middles(results.size());
+  for (std::size_t k = 0; k < results.size(); ++k)
+    middles[k] = results[k]->numberPaths() / 2;
+  PathVectors_t seams;
+  for (std::size_t k = 0; k + 1 < results.size(); ++k) {
+    PathVectorPtr_t seam(
+        PathVector::create(path->outputSize(), path->outputDerivativeSize()));
+    appendRange(seam, results[k], middles[k], results[k]->numberPaths());
+    appendRange(seam, results[k + 1], 0, middles[k + 1]);
+    seams.push_back(seam);
+  }
+  seams = optimizeWindows(seams);
+  hppDout(info, "optimized " << seams.size() << " seams");
+
+  appendRange(result, results.front(), 0, middles.front());
+  for (const PathVectorPtr_t& seam : seams) result->concatenate(seam);
+  appendRange(result, results.back(), middles.back(),
+              results.back()->numberPaths());
+  return result;
+}
+
+Windowed::PathVectors_t Windowed::optimizeWindows(
+    const PathVectors_t& windows) {
+  PathVectors_t results(windows);
+  if (windows.empty()) return results;
+  ProblemConstPtr_t p(problem());
+  size_type nbThreads =
+      p->getParameter("PathOptimization/Windowed/NumberThreads").intValue();
+  if (nbThreads < 1) nbThreads = (size_type)p->taskScheduler()->numberThreads();
+  nbThreads = std::min<size_type>(nbThreads, (size_type)windows.size());
+  if (p->pathProjector()) {
+    hppDout(info, "path projectors are not thread safe: use one thread.");
+    nbThreads = 1;
+  }
+
+  // Each task owns a view of the problem. Configuration and path
+  // validations use a pool of device data, make sure it is large enough.
+  std::vector<ProblemConstPtr_t> problems(nbThreads);
+  problems[0] = p;
+  for (size_type i = 1; i < nbThreads; ++i) problems[i] = threadProblem();
+  if (nbThreads > 1) {
+    DevicePtr_t robot(p->robot());
+    if (robot->numberDeviceData() < nbThreads)
+      robot->numberDeviceData(nbThreads);
+  }
+
+  if (nbThreads == 1) {
+    // Do not wake up the scheduler for sequential runs.
+    for (std::size_t i = 0; i < windows.size() && !interrupt_; ++i)
+      results[i] = optimizeWindow(p, windows[i]);
+    return results;
+  }
+  TaskGroup group(p->taskScheduler());
+  group.distribute(nbThreads, 0, windows.size(),
+                   [&](std::size_t task, std::size_t i) {
+                     if (interrupt_) {
+                       group.cancel();
+                       return;
+                     }
+                     results[i] = optimizeWindow(problems[task], windows[i]);
+                   });
+  group.wait();
+  return results;
+}
+
+PathVectorPtr_t Windowed::optimizeWindow(const ProblemConstPtr_t& problem,
+                                         const PathVectorPtr_t& window) const {
+  PathOptimizerPtr_t optimizer(builder_(problem));
+  {
+    std::lock_guard<std::mutex> lock(runningMutex_);
+    if (interrupt_) return window;
+    running_.push_back(optimizer);
+  }
+  PathVectorPtr_t result;
+  try {
+    result = optimizer->optimize(window);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(runningMutex_);
+    running_.erase(std::find(running_.begin(), running_.end(), optimizer));
+    throw;
+  }
+  {
+    std::lock_guard<std::mutex> lock(runningMutex_);
+    running_.erase(std::find(running_.begin(), running_.end(), optimizer));
+  }
+  if (!result) return window;
+  // Check that the optimized window can replace the initial one.
+  const DistancePtr_t& distance(problem->distance());
+  if ((*distance)(result->initial(), window->initial()) > boundaryTolerance ||
+      (*distance)(result->end(), window->end()) > boundaryTolerance) {
+    hppDout(warning, "optimized window does not have the same end "
+                     "configurations: discard it.");
+    return window;
+  }
+  return flatten(result);
+}
+
+ProblemPtr_t Windowed::threadProblem() const {
+  ProblemConstPtr_t p(problem());
+  // Problem::createCopy resets the distance, the steering method, the path
+  // validation and the constraints. The constraints and the steering
+  // method hold the state of their solvers and are copied.
+  ProblemPtr_t copy(Problem::createCopy(p));
+  copy->distance(p->distance());
+  copy->pathValidation(p->pathValidation());
+  copy->pathProjector(p->pathProjector());
+  if (p->constraints())
+    copy->constraints(
+        HPP_STATIC_PTR_CAST(ConstraintSet, p->constraints()->copy()));
+  copy->steeringMethod(p->steeringMethod()->copy());
+  return copy;
+}
+
+// ----------- Declare parameters ------------------------------------- //
+
+HPP_START_PARAMETER_DECLARATION(Windowed)
+Problem::declareParameter(ParameterDescription(
+    Parameter::INT, "PathOptimization/Windowed/WindowSize",
+    "Number of consecutive paths optimized together.",
+    Parameter((size_type)20)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::INT, "PathOptimization/Windowed/NumberThreads",
+    "Number of threads among which the windows are distributed. "
+    "If not positive, use the number of threads of the task scheduler of "
+    "the problem.",
+    Parameter((size_type)0)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::STRING, "PathOptimization/Windowed/Optimizer",
+    "Name of the path optimizer applied to each window when the optimizer "
+    "is created by ProblemSolver.",
+    Parameter(std::string("RandomShortcut"))));
+HPP_END_PARAMETER_DECLARATION(Windowed)
+}  // namespace pathOptimization
+}  // namespace core
+}  // namespace hpp
@@ -27,23 +27,32 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
 // DAMAGE.
 
+#include <algorithm>
+#include <atomic>
+#include <hpp/core/connected-component.hh>
+#include <hpp/core/diffusing-planner.hh>
 #include <hpp/core/edge.hh>
 #include <hpp/core/nearest-neighbor.hh>
 #include <hpp/core/node.hh>
 #include <hpp/core/path-planner.hh>
 #include <hpp/core/path-planning-failed.hh>
 #include <hpp/core/path-projector.hh>
+#include <hpp/core/path-validation-report.hh>
 #include <hpp/core/path-validation.hh>
+#include <hpp/core/path-vector.hh>
 #include <hpp/core/path.hh>
 #include <hpp/core/problem-target/goal-configurations.hh>
 #include <hpp/core/problem.hh>
 #include <hpp/core/roadmap.hh>
 #include <hpp/core/steering-method.hh>
+#include <hpp/core/task-scheduler.hh>
+#include <hpp/pinocchio/device.hh>
 #include <hpp/util/debug.hh>
 #include <hpp/util/timer.hh>
-#include <tuple>
+#include <mutex>
 
 #include "astar.hh"
+#include "nearest-neighbor/metric-tree.hh"
 
 namespace hpp {
 namespace core {
@@ -59,6 +68,12 @@ PathPlanner::PathPlanner(const ProblemConstPtr_t& problem)
       timeOut_(float_infty),
       stopWhenProblemIsSolved_(true) {
   assert(problem_.lock());
+  if (problem->getParameter("Roadmap/NearestNeighbor").stringValue() ==
+      "MetricTree")
+    roadmap_->nearestNeighbor(new nearestNeighbor::MetricTree(
+        problem->distance(),
+        problem->getParameter("Roadmap/NearestNeighbor/SymmetricDistance")
+            .boolValue()));
 }
 
 PathPlanner::PathPlanner(const ProblemConstPtr_t& problem,
@@ -82,6 +97,8 @@ ProblemConstPtr_t PathPlanner::problem() const { return problem_.lock(); }
 
 void PathPlanner::startSolve() {
   problem()->checkProblem();
+  validEdges_.clear();
+  invalidEdges_.clear();
   // Tag init and goal configurations in the roadmap
   roadmap()->resetGoalNodes();
   roadmap()->initNode(problem()->initConfig());
@@ -180,87 +197,334 @@ void PathPlanner::stopWhenProblemIsSolved(bool enable) {
 }
 
 PathVectorPtr_t PathPlanner::computePath() const {
+  if (problem()->getParameter("PathPlanner/RepairSolution").boolValue() &&
+      HPP_DYNAMIC_PTR_CAST(problemTarget::GoalConfigurations,
+                           problem()->target()))
+    return repairSolution();
   return problem()->target()->computePath(roadmap());
 }
 
+PathVectorPtr_t PathPlanner::repairSolution() const {
+  ProblemConstPtr_t p(problem());
+  PathValidationPtr_t pathValidation(p->pathValidation());
+  const size_type maxIterations(
+      p->getParameter("PathPlanner/Repair/MaxIterations").intValue());
+  // Invalid edges found since the last local replanning
+  std::vector<EdgePtr_t> broken;
+  // The search ignores the invalid edges and is resumed after each change
+  // of the roadmap.
+  Astar astar(roadmap(), p->distance(), &invalidEdges_);
+  for (size_type iter = 0; iter < maxIterations; ++iter) {
+    Astar::Edges_t edges;
+    std::vector<EdgePtr_t> newlyBroken;
+    bool found = true;
+    try {
+      edges = astar.solutionEdges();
+    } catch (const std::runtime_error&) {
+      found = false;
+    }
+    if (found) {
+      bool valid = true;
+      for (const EdgePtr_t& edge : edges) {
+        if (validEdges_.count(edge)) continue;
+        PathPtr_t validPart;
+        PathValidationReportPtr_t report;
+        if (pathValidation->validate(edge->path(), false, validPart, report)) {
+          validEdges_.insert(edge);
+        } else {
+          hppDout(info, "Edge of the solution is invalid: " << *report);
+          invalidEdges_.insert(edge);
+          broken.push_back(edge);
+          newlyBroken.push_back(edge);
+          valid = false;
+        }
+      }
+      if (valid) {
+        PathVectorPtr_t sol = PathVector::create(p->robot()->configSize(),
+                                                 p->robot()->numberDof());
+        for (const EdgePtr_t& edge : edges) sol->appendPath(edge->path());
+        // This happens when q_init == q_goal
+        if (sol->numberPaths() == 0) {
+          ConfigurationPtr_t q(roadmap()->initNode()->configuration());
+          sol->appendPath((*p->steeringMethod())(*q, *q));
+        }
+        return sol;
+      }
+      // Search again without the invalid edges.
+      astar.removeEdges(newlyBroken);
+      continue;
+    }
+    // The remaining roadmap does not connect init and goal: reconnect the
+    // endpoints of the invalid edges.
+    bool repaired = false;
+    for (const EdgePtr_t& edge : broken) {
+      PathPtr_t path(localPlan(*edge->from()->configuration(),
+                               *edge->to()->configuration()));
+      if (path) {
+        EdgePtr_t forward(roadmap()->addEdge(edge->from(), edge->to(), path));
+        EdgePtr_t backward(
+            roadmap()->addEdge(edge->to(), edge->from(), path->reverse()));
+        validEdges_.insert(forward);
+        validEdges_.insert(backward);
+        astar.addEdge(forward);
+        astar.addEdge(backward);
+        repaired = true;
+      }
+    }
+    broken.clear();
+    if (!repaired) break;
+  }
+  throw path_planning_failed("Failed to repair the solution path.");
+}
+
+PathPtr_t PathPlanner::localPlan(ConfigurationIn_t q1,
+                                 ConfigurationIn_t q2) const {
+  ProblemConstPtr_t p(problem());
+  // Try direct connection first
+  PathPtr_t path((*p->steeringMethod())(q1, q2)), projPath, validPart;
+  if (path) {
+    PathProjectorPtr_t pathProjector(p->pathProjector());
+    if (!pathProjector)
+      projPath = path;
+    else if (!pathProjector->apply(path, projPath))
+      projPath.reset();
+    PathValidationReportPtr_t report;
+    if (projPath &&
+        p->pathValidation()->validate(projPath, false, validPart, report))
+      return projPath;
+  }
+  // Plan between the two configurations
+  ProblemPtr_t sub(Problem::createCopy(p));
+  sub->initConfig(ConfigurationPtr_t(new Configuration_t(q1)));
+  sub->target(problemTarget::GoalConfigurations::create(sub));
+  sub->addGoalConfig(ConfigurationPtr_t(new Configuration_t(q2)));
+  sub->setParameter("PathPlanner/RepairSolution", Parameter(false));
+  PathPlannerPtr_t planner(DiffusingPlanner::create(sub));
+  planner->timeOut(
+      p->getParameter("PathPlanner/Repair/LocalTimeOut").floatValue());
+  try {
+    return planner->solve();
+  } catch (const path_planning_failed& exc) {
+    hppDout(info, "Local planning failed: " << exc.what());
+  }
+  return PathPtr_t();
+}
+
 PathVectorPtr_t PathPlanner::finishSolve(const PathVectorPtr_t& path) {
   return path;
 }
 
+namespace {
+/// Attempt to connect a node to a connected component of the roadmap
+struct ConnectionAttempt {
+  /// Initial or goal node
+  NodePtr_t node;
+  /// Nodes of the connected component sorted by increasing distance
+  Nodes_t candidates;
+  /// Whether the edge goes from the component to \c node
+  bool toNode;
+  /// Node of the component \c node has been connected to, if any
+  NodePtr_t near;
+  /// Path between \c node and \c near
+  PathPtr_t path;
+};
+
+/// Steering method, path projector and path validation of a task
+struct Connector {
+  SteeringMethodPtr_t steeringMethod;
+  PathProjectorPtr_t pathProjector;
+  PathValidationPtr_t pathValidation;
+  /// Locks held while using the projector or the validation of the
+  /// problem, if they cannot be copied. NULL otherwise.
+  std::mutex* projectorMutex;
+  std::mutex* validationMutex;
+};
+
+/// Try the candidates of an attempt by increasing distance
+///
+/// Stop at the first candidate that can be connected to the node.
+/// Steering, projection and validation are done without accessing the
+/// roadmap so that several attempts can be run concurrently.
+/// \param connector resources owned by the calling task.
+void tryConnect(ConnectionAttempt& attempt, const Connector& connector,
+                const std::atomic<bool>& interrupt) {
+  PathPtr_t path, projPath, validPath;
+  for (const NodePtr_t& near : attempt.candidates) {
+    if (interrupt) return;
+    const Configuration_t& q1(attempt.toNode ? *near->configuration()
+                                             : *attempt.node->configuration());
+    const Configuration_t& q2(attempt.toNode ? *attempt.node->configuration()
+                                             : *near->configuration());
+    path = (*connector.steeringMethod)(q1, q2);
+    if (!path) continue;
+    if (connector.pathProjector) {
+      std::unique_lock<std::mutex> lock;
+      if (connector.projectorMutex)
+        lock = std::unique_lock<std::mutex>(*connector.projectorMutex);
+      if (!connector.pathProjector->apply(path, projPath)) continue;
+    } else {
+      projPath = path;
+    }
+    if (!projPath) continue;
+    PathValidationReportPtr_t report;
+    bool pathValid;
+    {
+      std::unique_lock<std::mutex> lock;
+      if (connector.validationMutex)
+        lock = std::unique_lock<std::mutex>(*connector.validationMutex);
+      pathValid = connector.pathValidation->validate(projPath, false,
+                                                     validPath, report);
+    }
+    if (pathValid && validPath->length() > 0) {
+      attempt.near = near;
+      attempt.path = projPath;
+      return;
+    }
+  }
+}
+}  // namespace
+
 void PathPlanner::tryConnectInitAndGoals() {
-  // call steering method here to build a direct conexion
-  const SteeringMethodPtr_t& sm(problem()->steeringMethod());
-  PathValidationPtr_t pathValidation(problem()->pathValidation());
-  PathProjectorPtr_t pathProjector(problem()->pathProjector());
-  PathPtr_t validPath, projPath, path;
-  NodePtr_t initNode = roadmap()->initNode();
+  tryConnectNodes(NodeVector_t(1, roadmap()->initNode()),
+                  roadmap()->goalNodes());
+}
+
+void PathPlanner::tryConnectNodes(const NodeVector_t& sources,
+                                  const NodeVector_t& targets) {
+  ProblemConstPtr_t p(problem());
+  PathValidationPtr_t pathValidation(p->pathValidation());
+  PathProjectorPtr_t pathProjector(p->pathProjector());
   NearestNeighborPtr_t nn(roadmap()->nearestNeighbor());
-  // Register edges to add to roadmap and add them after iterating
-  // among the connected components.
-  typedef std::tuple<NodePtr_t, NodePtr_t, PathPtr_t> FutureEdge_t;
-  typedef std::vector<FutureEdge_t> FutureEdges_t;
-  FutureEdges_t futureEdges;
-  ConnectedComponentPtr_t initCC(initNode->connectedComponent());
-  for (ConnectedComponents_t::iterator itCC(
-           roadmap()->connectedComponents().begin());
-       itCC != roadmap()->connectedComponents().end(); ++itCC) {
-    if (*itCC != initCC) {
+  size_type nbCandidates =
+      p->getParameter("PathPlanner/ConnectInitAndGoals/NumberCandidates")
+          .intValue();
+  size_type nbThreads =
+      p->getParameter("PathPlanner/ConnectInitAndGoals/NumberThreads")
+          .intValue();
+  if (nbCandidates < 1) nbCandidates = 1;
+  if (nbThreads < 1) nbThreads = (size_type)p->taskScheduler()->numberThreads();
+
+  // Gather the candidate nodes of each connected component before starting
+  // the tasks: nearest neighbor search is not thread safe.
+  std::vector<ConnectionAttempt> attempts;
+  auto addAttempts = [&](const NodePtr_t& node, bool toNode) {
+    ConnectedComponentPtr_t nodeCC(node->connectedComponent());
+    for (const ConnectedComponentPtr_t& cc : roadmap()->connectedComponents()) {
+      if (cc == nodeCC) continue;
+      ConnectionAttempt attempt;
+      attempt.node = node;
+      attempt.toNode = toNode;
       value_type d;
-      NodePtr_t near(nn->search(*initNode->configuration(), *itCC, d, true));
-      assert(near);
-      ConfigurationPtr_t q1(initNode->configuration());
-      ConfigurationPtr_t q2(near->configuration());
-      path = (*sm)(*q1, *q2);
-      if (!path) continue;
-      if (pathProjector) {
-        if (!pathProjector->apply(path, projPath)) continue;
+      if (nbCandidates == 1) {
+        NodePtr_t near(nn->search(*node->configuration(), cc, d, !toNode));
+        assert(near);
+        attempt.candidates.push_back(near);
       } else {
-        projPath = path;
-      }
-      if (projPath) {
-        PathValidationReportPtr_t report;
-        bool pathValid =
-            pathValidation->validate(projPath, false, validPath, report);
-        if (pathValid && validPath->length() > 0) {
-          futureEdges.push_back(FutureEdge_t(initNode, near, projPath));
-        }
+        attempt.candidates = nn->KnearestSearch(
+            *node->configuration(), cc, (std::size_t)nbCandidates, d, !toNode);
       }
+      attempts.push_back(attempt);
     }
-  }
-  for (NodeVector_t::const_iterator itn = roadmap()->goalNodes().begin();
-       itn != roadmap()->goalNodes().end(); ++itn) {
-    ConnectedComponentPtr_t goalCC((*itn)->connectedComponent());
-    for (ConnectedComponents_t::iterator itCC(
-             roadmap()->connectedComponents().begin());
-         itCC != roadmap()->connectedComponents().end(); ++itCC) {
-      if (*itCC != goalCC) {
-        value_type d;
-        NodePtr_t near(nn->search(*(*itn)->configuration(), *itCC, d, false));
-        assert(near);
-        ConfigurationPtr_t q1(near->configuration());
-        ConfigurationPtr_t q2((*itn)->configuration());
-        path = (*sm)(*q1, *q2);
-        if (!path) continue;
-        if (pathProjector) {
-          if (!pathProjector->apply(path, projPath)) continue;
-        } else {
-          projPath = path;
-        }
-        if (projPath) {
-          PathValidationReportPtr_t report;
-          bool pathValid =
-              pathValidation->validate(projPath, false, validPath, report);
-          if (pathValid && validPath->length() > 0) {
-            futureEdges.push_back(FutureEdge_t(near, (*itn), projPath));
-          }
+  };
+  for (const NodePtr_t& source : sources) addAttempts(source, false);
+  for (const NodePtr_t& target : targets) addAttempts(target, true);
+  if (attempts.empty()) return;
+
+  nbThreads = std::min<size_type>(nbThreads, (size_type)attempts.size());
+  if (nbThreads == 1) {
+    // Do not wake up the scheduler for sequential runs.
+    Connector connector = {p->steeringMethod(), pathProjector, pathValidation,
+                           NULL, NULL};
+    for (ConnectionAttempt& attempt : attempts)
+      tryConnect(attempt, connector, interrupt_);
+  } else {
+    // Configuration validations use a pool of device data, make sure it is
+    // large enough.
+    DevicePtr_t robot(p->robot());
+    if (robot->numberDeviceData() < nbThreads)
+      robot->numberDeviceData(nbThreads);
+    // Each worker owns copies of the steering method, of the path projector
+    // and of the path validation. Those that cannot be copied are shared
+    // and locked.
+    std::mutex projectorMutex, validationMutex;
+    WorkerLocal<Connector> connectors(p->taskScheduler(), [&]() {
+      Connector c;
+      c.steeringMethod = p->steeringMethod()->copy();
+      c.projectorMutex = c.validationMutex = NULL;
+      if (pathProjector) {
+        c.pathProjector = pathProjector->copy();
+        if (!c.pathProjector) {
+          c.pathProjector = pathProjector;
+          c.projectorMutex = &projectorMutex;
         }
       }
-    }
+      c.pathValidation = pathValidation->copy();
+      if (!c.pathValidation) {
+        c.pathValidation = pathValidation;
+        c.validationMutex = &validationMutex;
+      }
+      return c;
+    });
+    TaskGroup group(p->taskScheduler());
+    group.distribute(nbThreads, 0, attempts.size(),
+                     [&](std::size_t, std::size_t i) {
+                       tryConnect(attempts[i], connectors.local(), interrupt_);
+                     });
+    group.wait();
+  }
+
+  // Add edges in the order of the attempts so that the resulting roadmap
+  // does not depend on thread scheduling.
+  for (const ConnectionAttempt& a : attempts) {
+    if (!a.near) continue;
+    if (a.toNode)
+      roadmap()->addEdge(a.near, a.node, a.path);
+    else
+      roadmap()->addEdge(a.node, a.near, a.path);
   }
-  // Add edges
-  for (const auto& e : futureEdges)
-    roadmap()->addEdge(std::get<0>(e), std::get<1>(e), std::get<2>(e));
 }
 
+HPP_START_PARAMETER_DECLARATION(PathPlanner)
+Problem::declareParameter(ParameterDescription(
+    Parameter::INT, "PathPlanner/ConnectInitAndGoals/NumberCandidates",
+    "Number of nearest nodes of each connected component that are tried, "
+    "by increasing distance, when connecting the initial and goal "
+    "configurations to the roadmap.",
+    Parameter((size_type)1)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::INT, "PathPlanner/ConnectInitAndGoals/NumberThreads",
+    "Number of threads used to connect the initial and goal configurations "
+    "to the connected components of the roadmap. "
+    "If not positive, use the number of threads of the task scheduler of "
+    "the problem.",
+    Parameter((size_type)1)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::STRING, "Roadmap/NearestNeighbor",
+    "Nearest neighbor search method of the roadmaps created by path planners "
+    "and by ProblemSolver::resetRoadmap: \"Basic\" (linear search) or "
+    "\"MetricTree\" (tree pruned with the triangle inequality, for "
+    "expensive distances).",
+    Parameter(std::string("Basic"))));
+Problem::declareParameter(ParameterDescription(
+    Parameter::BOOL, "Roadmap/NearestNeighbor/SymmetricDistance",
+    "Whether the distance is symmetric. If false, \"MetricTree\" evaluates "
+    "distances in both directions when inserting nodes.",
+    Parameter(false)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::BOOL, "PathPlanner/RepairSolution",
+    "Validate the solution found in the roadmap and repair it if some "
+    "edges are invalid, for instance after obstacles have moved.",
+    Parameter(false)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::INT, "PathPlanner/Repair/MaxIterations",
+    "Maximal number of graph searches when repairing the solution.",
+    Parameter((size_type)100)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "PathPlanner/Repair/LocalTimeOut",
+    "Time out (in seconds) of the planning between the endpoints of an "
+    "invalid edge.",
+    Parameter(1.)));
+HPP_END_PARAMETER_DECLARATION(PathPlanner)
+
 }  //   namespace core
 }  // namespace hpp
@@ -0,0 +1,544 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <hpp/core/config-projector.hh>
+#include <hpp/core/configuration-shooter.hh>
+#include <hpp/core/constraint-set.hh>
+#include <hpp/core/diffusing-planner.hh>
+#include <hpp/core/node.hh>
+#include <hpp/core/path-planner/prioritized.hh>
+#include <hpp/core/path-planning-failed.hh>
+#include <hpp/core/path-validation-report.hh>
+#include <hpp/core/path-validation.hh>
+#include <hpp/core/path-vector.hh>
+#include <hpp/core/problem-target/goal-configurations.hh>
+#include <hpp/core/problem.hh>
+#include <hpp/core/roadmap.hh>
+#include <hpp/core/subchain-path.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/joint-collection.hh>
+#include <hpp/util/debug.hh>
+#include <sstream>
+
+namespace hpp {
+namespace core {
+namespace pathPlanner {
+namespace {
+/// Copy some intervals of a vector into another one
+void copyIntervals(const segments_t& intervals, vectorIn_t from,
+                   vectorOut_t to) {
+  for (const segment_t& s : intervals)
+    to.segment(s.first, s.second) = from.segment(s.first, s.second);
+}
+
+/// Sample the configuration parameters of a sub-robot only
+///
+/// The other parameters are set to a reference configuration.
+class SubRobotShooter : public ConfigurationShooter {
+ public:
+  static ConfigurationShooterPtr_t create(
+      const ConfigurationShooterPtr_t& shooter, ConfigurationIn_t reference,
+      const segments_t& configIntervals) {
+    SubRobotShooter* ptr =
+        new SubRobotShooter(shooter, reference, configIntervals);
+    ConfigurationShooterPtr_t shPtr(ptr);
+    ptr->init(shPtr);
+    return shPtr;
+  }
+
+ protected:
+  SubRobotShooter(const ConfigurationShooterPtr_t& shooter,
+                  ConfigurationIn_t reference,
+                  const segments_t& configIntervals)
+      : shooter_(shooter),
+        reference_(reference),
+        configIntervals_(configIntervals) {}
+
+  virtual void impl_shoot(Configuration_t& q) const {
+    shooter_->shoot(q_);
+    q = reference_;
+    copyIntervals(configIntervals_, q_, q);
+  }
+
+ private:
+  ConfigurationShooterPtr_t shooter_;
+  Configuration_t reference_;
+  segments_t configIntervals_;
+  mutable Configuration_t q_;
+};  // class SubRobotShooter
+}  // namespace
+
+/// Simultaneous execution of the paths of several sub-robots
+///
+/// Each component moves its own configuration parameters after waiting
+/// for its delay. Other parameters keep their initial value.
+class Prioritized::CoordinatedPath : public Path {
+ public:
+  static PathPtr_t create(ConfigurationIn_t initial,
+                          const Components_t& components,
+                          size_type outputDerivativeSize) {
+    CoordinatedPath* ptr =
+        new CoordinatedPath(initial, components, outputDerivativeSize);
+    PathPtr_t shPtr(ptr);
+    ptr->init(shPtr);
+    return shPtr;
+  }
+
+  virtual PathPtr_t copy() const {
+    CoordinatedPath* ptr = new CoordinatedPath(*this);
+    PathPtr_t shPtr(ptr);
+    ptr->init(shPtr);
+    return shPtr;
+  }
+
+  virtual PathPtr_t copy(const ConstraintSetPtr_t& constraints) const {
+    CoordinatedPath* ptr = new CoordinatedPath(*this, constraints);
+    PathPtr_t shPtr(ptr);
+    ptr->init(shPtr);
+    return shPtr;
+  }
+
+  virtual Configuration_t initial() const {
+    Configuration_t q(outputSize());
+    impl_compute(q, paramRange().first);
+    return q;
+  }
+
+  virtual Configuration_t end() const {
+    Configuration_t q(outputSize());
+    impl_compute(q, paramRange().second);
+    return q;
+  }
+
+ protected:
+  CoordinatedPath(ConfigurationIn_t initial, const Components_t& components,
+                  size_type outputDerivativeSize)
+      : Path(interval_t(0, length(components)), initial.size(),
+             outputDerivativeSize),
+        initial_(initial),
+        components_(components) {
+    allocate();
+  }
+
+  CoordinatedPath(const CoordinatedPath& path)
+      : Path(path), initial_(path.initial_), components_(path.components_) {
+    allocate();
+  }
+
+  CoordinatedPath(const CoordinatedPath& path,
+                  const ConstraintSetPtr_t& constraints)
+      : Path(path, constraints),
+        initial_(path.initial_),
+        components_(path.components_) {
+    allocate();
+  }
+
+  void init(const PathPtr_t& self) { Path::init(self); }
+
+  virtual bool impl_compute(ConfigurationOut_t result,
+                            value_type param) const {
+    result = initial_;
+    for (std::size_t i = 0; i < components_.size(); ++i) {
+      const Component& c(components_[i]);
+      if (!(*c.path)(q_[i], localTime(c, param))) return false;
+      c.path->configView().lview(result) = q_[i];
+    }
+    return true;
+  }
+
+  virtual void impl_derivative(vectorOut_t result, const value_type& param,
+                               size_type order) const {
+    result.setZero();
+    for (std::size_t i = 0; i < components_.size(); ++i) {
+      const Component& c(components_[i]);
+      if (param < c.delay || param > c.delay + c.path->length()) continue;
+      c.path->derivative(v_[i], localTime(c, param), order);
+      c.path->velocityView().lview(result) = v_[i];
+    }
+  }
+
+  virtual void impl_velocityBound(vectorOut_t result, const value_type& param0,
+                                  const value_type& param1) const {
+    result.setZero();
+    for (std::size_t i = 0; i < components_.size(); ++i) {
+      const Component& c(components_[i]);
+      const value_type t0(std::max(param0 - c.delay, 0.)),
+          t1(std::min(param1 - c.delay, c.path->length()));
+      if (t0 > t1) continue;
+      const value_type tmin(c.path->timeRange().first);
+      c.path->velocityBound(v_[i], tmin + t0, tmin + t1);
+      c.path->velocityView().lview(result) = v_[i];
+    }
+  }
+
+  virtual std::ostream& print(std::ostream& os) const {
+    Path::print(os << "CoordinatedPath:") << std::endl;
+    for (const Component& c : components_)
+      os << "delay " << c.delay << ": " << *c.path << std::endl;
+    return os;
+  }
+
+ private:
+  static value_type length(const Components_t& components) {
+    value_type l(0);
+    for (const Component& c : components)
+      l = std::max(l, c.delay + c.path->length());
+    return l;
+  }
+
+  static value_type localTime(const Component& c, const value_type& param) {
+    value_type t(param - c.delay);
+    if (t < 0) t = 0;
+    if (t > c.path->length()) t = c.path->length();
+    return c.path->timeRange().first + t;
+  }
+
+  void allocate() {
+    q_.resize(components_.size());
+    v_.resize(components_.size());
+    for (std::size_t i = 0; i < components_.size(); ++i) {
+      q_[i].resize(components_[i].path->outputSize());
+      v_[i].resize(components_[i].path->outputDerivativeSize());
+    }
+  }
+
+  Configuration_t initial_;
+  Components_t components_;
+  mutable std::vector<Configuration_t> q_;
+  mutable std::vector<vector_t> v_;
+};  // class CoordinatedPath
+
+PrioritizedPtr_t Prioritized::create(const ProblemConstPtr_t& problem) {
+  PrioritizedPtr_t shPtr(new Prioritized(problem));
+  shPtr->init(shPtr);
+  return shPtr;
+}
+
+PrioritizedPtr_t Prioritized::createWithRoadmap(
+    const ProblemConstPtr_t& problem, const RoadmapPtr_t& roadmap) {
+  PrioritizedPtr_t shPtr(new Prioritized(problem, roadmap));
+  shPtr->init(shPtr);
+  return shPtr;
+}
+
+void Prioritized::addSubRobot(const segments_t& configIntervals,
+                              const segments_t& velocityIntervals) {
+  if (automaticSubRobots_) {
+    subRobots_.clear();
+    automaticSubRobots_ = false;
+  }
+  SubRobot subRobot;
+  subRobot.configIntervals = configIntervals;
+  subRobot.velocityIntervals = velocityIntervals;
+  subRobots_.push_back(subRobot);
+}
+
+void Prioritized::resetSubRobots() {
+  subRobots_.clear();
+  automaticSubRobots_ = false;
+}
+
+void Prioritized::startSolve() {
+  Parent_t::startSolve();
+  if (problem()->goalConfigs().size() != 1) {
+    throw std::runtime_error(
+        "Prioritized planner: the problem should have exactly one goal "
+        "configuration.");
+  }
+  if (automaticSubRobots_ || subRobots_.empty()) computeSubRobots();
+  current_ = 0;
+  components_.clear();
+  startTime_ = std::chrono::steady_clock::now();
+}
+
+void Prioritized::interrupt() {
+  Parent_t::interrupt();
+  std::lock_guard<std::mutex> lock(innerMutex_);
+  if (inner_) inner_->interrupt();
+}
+
+void Prioritized::oneStep() {
+  ProblemConstPtr_t p(problem());
+  const Configuration_t& qInit(*p->initConfig());
+  const Configuration_t qGoal(*p->goalConfigs()[0]);
+  if (current_ < subRobots_.size()) {
+    const SubRobot& subRobot(subRobots_[current_]);
+    Configuration_t qSubGoal(qInit);
+    copyIntervals(subRobot.configIntervals, qGoal, qSubGoal);
+    if (qSubGoal != qInit) {
+      hppDout(info, "Planning sub-robot " << current_);
+      PathVectorPtr_t path;
+      try {
+        path = plan(qInit, qSubGoal, &subRobot);
+      } catch (const path_planning_failed& exc) {
+        // The sub-robot is blocked by the initial configuration of the
+        // other ones: plan it together with the already planned sub-robots.
+        hppDout(info, "Failed to plan sub-robot " << current_ << ": "
+                                                   << exc.what());
+      }
+      if (path) {
+        Component c;
+        c.path = SubchainPath::create(path, subRobot.configIntervals,
+                                      subRobot.velocityIntervals);
+        c.delay = 0;
+        components_.push_back(c);
+        if (!coordinate() && !repair(true)) failure();
+      } else if (!repair(false)) {
+        failure();
+      }
+    }
+    ++current_;
+    return;
+  }
+  if (current_ > subRobots_.size())
+    throw path_planning_failed(
+        "Prioritized planner: the combined path does not reach the goal.");
+  ++current_;
+  PathPtr_t path(CoordinatedPath::create(qInit, components_,
+                                         p->robot()->numberDof()));
+  roadmap()->addEdge(roadmap()->initNode(), roadmap()->goalNodes()[0], path);
+}
+
+PathVectorPtr_t Prioritized::plan(ConfigurationIn_t qInit,
+                                  ConfigurationIn_t qGoal,
+                                  const SubRobot* subRobot) const {
+  ProblemConstPtr_t p(problem());
+  ProblemPtr_t sub(Problem::createCopy(p));
+  sub->initConfig(ConfigurationPtr_t(new Configuration_t(qInit)));
+  sub->target(problemTarget::GoalConfigurations::create(sub));
+  sub->addGoalConfig(ConfigurationPtr_t(new Configuration_t(qGoal)));
+  if (subRobot) {
+    sub->configurationShooter(SubRobotShooter::create(
+        p->configurationShooter(), qInit, subRobot->configIntervals));
+  }
+  DiffusingPlannerPtr_t planner(DiffusingPlanner::create(sub));
+
+  // Bound the inner planner by the remaining budget.
+  const value_type elapsed(std::chrono::duration<value_type>(
+                               std::chrono::steady_clock::now() - startTime_)
+                               .count());
+  if (elapsed >= timeOut_) {
+    std::ostringstream oss;
+    oss << "Prioritized planner: time out (" << timeOut_ << "s) reached.";
+    throw path_planning_failed(oss.str().c_str());
+  }
+  planner->timeOut(timeOut_ - elapsed);
+  const size_type innerMaxIterations(
+      p->getParameter("PrioritizedPlanner/InnerMaxIterations").intValue());
+  unsigned long int maxIterations(maxIterations_);
+  if (innerMaxIterations > 0 &&
+      (unsigned long int)innerMaxIterations < maxIterations)
+    maxIterations = (unsigned long int)innerMaxIterations;
+  planner->maxIterations(maxIterations);
+
+  {
+    std::lock_guard<std::mutex> lock(innerMutex_);
+    inner_ = planner;
+    if (interrupt_) planner->interrupt();
+  }
+  PathVectorPtr_t result;
+  try {
+    result = planner->solve();
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(innerMutex_);
+    inner_.reset();
+    throw;
+  }
+  std::lock_guard<std::mutex> lock(innerMutex_);
+  inner_.reset();
+  return result;
+}
+
+PathPtr_t Prioritized::coordinate() {
+  ProblemConstPtr_t p(problem());
+  PathValidationPtr_t pathValidation(p->pathValidation());
+  const size_type nbDelays(
+      p->getParameter("PrioritizedPlanner/NumberDelays").intValue());
+  Component& last(components_.back());
+  value_type T(0);
+  for (std::size_t i = 0; i + 1 < components_.size(); ++i)
+    T = std::max(T, components_[i].delay + components_[i].path->length());
+  const size_type nbTrials(T > 0 ? std::max<size_type>(nbDelays, 0) : 0);
+  for (size_type i = 0; i <= nbTrials; ++i) {
+    last.delay = (nbTrials > 0 ? (value_type)i * T / (value_type)nbTrials : 0);
+    PathPtr_t path(CoordinatedPath::create(*p->initConfig(), components_,
+                                           p->robot()->numberDof()));
+    PathPtr_t validPart;
+    PathValidationReportPtr_t report;
+    if (pathValidation->validate(path, false, validPart, report)) {
+      hppDout(info, "Sub-robot " << current_ << " delayed by " << last.delay);
+      return path;
+    }
+    if (interrupt_) break;
+  }
+  last.delay = 0;
+  return PathPtr_t();
+}
+
+PathPtr_t Prioritized::repair(bool keepValidParts) {
+  ProblemConstPtr_t p(problem());
+  const size_type nq(p->robot()->configSize()), nv(p->robot()->numberDof());
+  const Configuration_t& qInit(*p->initConfig());
+
+  // Sub-robot made of all the sub-robots planned so far
+  SubRobot merged;
+  for (std::size_t i = 0; i <= current_; ++i) {
+    merged.configIntervals.insert(merged.configIntervals.end(),
+                                  subRobots_[i].configIntervals.begin(),
+                                  subRobots_[i].configIntervals.end());
+    merged.velocityIntervals.insert(merged.velocityIntervals.end(),
+                                    subRobots_[i].velocityIntervals.begin(),
+                                    subRobots_[i].velocityIntervals.end());
+  }
+  Eigen::BlockIndex::sort(merged.configIntervals);
+  Eigen::BlockIndex::shrink(merged.configIntervals);
+  Eigen::BlockIndex::sort(merged.velocityIntervals);
+  Eigen::BlockIndex::shrink(merged.velocityIntervals);
+
+  PathVectorPtr_t result(PathVector::create(nq, nv));
+  Configuration_t qa(qInit), qb(qInit);
+  copyIntervals(merged.configIntervals, *p->goalConfigs()[0], qb);
+  PathPtr_t forward, backward;
+  if (keepValidParts) {
+    // Keep the valid beginning and end of the combined path and plan the
+    // coupled part in between.
+    PathValidationPtr_t pathValidation(p->pathValidation());
+    PathPtr_t path(CoordinatedPath::create(qInit, components_, nv));
+    PathValidationReportPtr_t report;
+    pathValidation->validate(path, false, forward, report);
+    pathValidation->validate(path, true, backward, report);
+    qa = forward->end();
+    qb = backward->initial();
+    if (forward->length() > 0) result->appendPath(forward);
+  }
+  hppDout(info, "Planning coupled segment of sub-robots 0 to " << current_);
+  try {
+    result->concatenate(plan(qa, qb, &merged));
+  } catch (const path_planning_failed& exc) {
+    hppDout(info, "Failed to plan sub-robots 0 to " << current_ << ": "
+                                                    << exc.what());
+    return PathPtr_t();
+  }
+  if (backward && backward->length() > 0) result->appendPath(backward);
+
+  Component c;
+  c.path = SubchainPath::create(result, merged.configIntervals,
+                                merged.velocityIntervals);
+  c.delay = 0;
+  components_.assign(1, c);
+  return CoordinatedPath::create(qInit, components_, nv);
+}
+
+void Prioritized::failure() const {
+  std::ostringstream oss;
+  oss << "Prioritized planner: failed to plan sub-robot " << current_
+      << " together with the sub-robots of higher priority.";
+  throw path_planning_failed(oss.str().c_str());
+}
+
+void Prioritized::computeSubRobots() {
+  subRobots_.clear();
+  automaticSubRobots_ = true;
+  DevicePtr_t robot(problem()->robot());
+  ConstraintSetPtr_t constraints(problem()->constraints());
+  if (constraints && constraints->configProjector()) {
+    hppDout(info, "Problem has constraints: planning the robot as a whole.");
+    SubRobot subRobot;
+    subRobot.configIntervals.push_back(segment_t(0, robot->configSize()));
+    subRobot.velocityIntervals.push_back(segment_t(0, robot->numberDof()));
+    subRobots_.push_back(subRobot);
+    return;
+  }
+  const pinocchio::Model& model(robot->model());
+  std::vector<std::size_t> subRobot(model.njoints);
+  for (pinocchio::JointIndex i = 1; i < (pinocchio::JointIndex)model.njoints;
+       ++i) {
+    if (model.parents[i] == 0) {
+      subRobot[i] = subRobots_.size();
+      subRobots_.push_back(SubRobot());
+    } else {
+      subRobot[i] = subRobot[model.parents[i]];
+    }
+    if (model.joints[i].nq() == 0) continue;
+    SubRobot& sr(subRobots_[subRobot[i]]);
+    sr.configIntervals.push_back(
+        segment_t(model.joints[i].idx_q(), model.joints[i].nq()));
+    sr.velocityIntervals.push_back(
+        segment_t(model.joints[i].idx_v(), model.joints[i].nv()));
+  }
+  // Extra degrees of freedom are planned with the first sub-robot.
+  const size_type nExtra(robot->extraConfigSpace().dimension());
+  if (nExtra > 0) {
+    if (subRobots_.empty()) subRobots_.push_back(SubRobot());
+    subRobots_[0].configIntervals.push_back(segment_t(model.nq, nExtra));
+    subRobots_[0].velocityIntervals.push_back(segment_t(model.nv, nExtra));
+  }
+  for (SubRobots_t::iterator it = subRobots_.begin(); it != subRobots_.end();) {
+    if (it->configIntervals.empty()) {
+      it = subRobots_.erase(it);
+      continue;
+    }
+    Eigen::BlockIndex::sort(it->configIntervals);
+    Eigen::BlockIndex::shrink(it->configIntervals);
+    Eigen::BlockIndex::sort(it->velocityIntervals);
+    Eigen::BlockIndex::shrink(it->velocityIntervals);
+    ++it;
+  }
+  hppDout(info, "Found " << subRobots_.size() << " sub-robots.");
+}
+
+Prioritized::Prioritized(const ProblemConstPtr_t& problem)
+    : Parent_t(problem), automaticSubRobots_(false), current_(0) {}
+
+Prioritized::Prioritized(const ProblemConstPtr_t& problem,
+                         const RoadmapPtr_t& roadmap)
+    : Parent_t(problem, roadmap), automaticSubRobots_(false), current_(0) {}
+
+void Prioritized::init(const PrioritizedWkPtr_t& weak) {
+  Parent_t::init(weak);
+  weak_ = weak;
+}
+
+// ----------- Declare parameters ------------------------------------- //
+
+HPP_START_PARAMETER_DECLARATION(Prioritized)
+Problem::declareParameter(ParameterDescription(
+    Parameter::INT, "PrioritizedPlanner/NumberDelays",
+    "Number of delays tried for a sub-robot whose path collides with the "
+    "paths of the sub-robots planned before, before planning the coupled "
+    "part in their composite configuration space.",
+    Parameter((size_type)10)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::INT, "PrioritizedPlanner/InnerMaxIterations",
+    "Maximal number of iterations of each call to the inner planner. If not "
+    "positive, the maximal number of iterations of the prioritized planner "
+    "is used.",
+    Parameter((size_type)10000)));
+HPP_END_PARAMETER_DECLARATION(Prioritized)
+}  // namespace pathPlanner
+}  // namespace core
+}  // namespace hpp
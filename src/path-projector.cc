@@ -32,11 +32,9 @@
 #include <hpp/core/path-vector.hh>
 #include <hpp/core/problem.hh>
 #include <hpp/core/steering-method.hh>
+#include <hpp/core/trace.hh>
 #include <hpp/util/pointer.hh>
 #include <hpp/util/timer.hh>
-#include <iostream>
-#include <typeinfo>
-using namespace std;
 
 namespace hpp {
 namespace core {
@@ -55,6 +53,10 @@ PathProjector::PathProjector(const DistancePtr_t& distance,
   }
 }
 
+PathProjector::PathProjector(const PathProjector& other)
+    : steeringMethod_(other.steeringMethod_->copy()),
+      distance_(other.distance_) {}
+
 PathProjector::~PathProjector() {
   HPP_DISPLAY_TIMECOUNTER(PathProjection);
   HPP_RESET_TIMECOUNTER(PathProjection);
@@ -66,9 +68,6 @@ value_type PathProjector::d(ConfigurationIn_t q1, ConfigurationIn_t q2) const {
 
 PathPtr_t PathProjector::steer(ConfigurationIn_t q1,
                                ConfigurationIn_t q2) const {
-  
-  cout << "ici \n\n\n" << endl;
-  cout << typeid(*steeringMethod_).name() << endl;
   PathPtr_t result((*steeringMethod_)(q1, q2));
   // In the case of hermite path, we want the paths to be constrained.
   // assert (!result->constraints ());
@@ -79,6 +78,7 @@ bool PathProjector::apply(const PathPtr_t& path, PathPtr_t& proj) const {
   HPP_START_TIMECOUNTER(PathProjection);
   bool ret = impl_apply(path, proj);
   HPP_STOP_TIMECOUNTER(PathProjection);
+  HPP_CORE_TRACE(PROJECT, ret, path->length());
   return ret;
 }
 
@@ -90,6 +90,18 @@ Problem::declareParameter(
                          "A bound on the norm of the hessian of the "
                          "constraints. Not considered if negative.",
                          Parameter(-1.)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::BOOL, "PathProjection/EstimateHessianBound",
+    "Whether to estimate online a bound on the norm of the hessian of the "
+    "constraints from the variation of their Jacobian along the path. If "
+    "PathProjection/HessianBound is positive, it is used as the initial "
+    "bound.",
+    Parameter(false)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "PathProjection/HessianBoundSafetyFactor",
+    "Factor by which the estimated bound on the norm of the hessian is "
+    "multiplied. See PathProjection/EstimateHessianBound.",
+    Parameter(2.)));
 Problem::declareParameter(
     ParameterDescription(Parameter::FLOAT, "PathProjection/MinimalDist",
                          "The threshold which stops the projection (distance "
@@ -30,6 +30,7 @@
 
 #include <hpp/constraints/solver/by-substitution.hh>
 #include <hpp/core/config-projector.hh>
+#include <hpp/core/configuration-layout.hh>
 #include <hpp/core/interpolated-path.hh>
 #include <hpp/core/path-vector.hh>
 #include <hpp/core/problem.hh>
@@ -43,6 +44,8 @@
 #include <queue>
 #include <stack>
 
+#include "path-projector/hessian-bound-estimator.hh"
+
 namespace hpp {
 namespace core {
 namespace pathProjector {
@@ -62,10 +65,17 @@ GlobalPtr_t Global::create(const DistancePtr_t& distance,
   value_type thr_min = steeringMethod->problem()
                            ->getParameter("PathProjection/MinimalDist")
                            .floatValue();
+  bool estimate = steeringMethod->problem()
+                      ->getParameter("PathProjection/EstimateHessianBound")
+                      .boolValue();
+  value_type safetyFactor =
+      steeringMethod->problem()
+          ->getParameter("PathProjection/HessianBoundSafetyFactor")
+          .floatValue();
   hppDout(info, "Hessian bound is " << hessianBound);
   hppDout(info, "Min Dist is " << thr_min);
-  return GlobalPtr_t(
-      new Global(distance, steeringMethod, step, thr_min, hessianBound));
+  return GlobalPtr_t(new Global(distance, steeringMethod, step, thr_min,
+                                hessianBound, estimate, safetyFactor));
 }
 
 GlobalPtr_t Global::create(const ProblemConstPtr_t& problem,
@@ -75,11 +85,14 @@ GlobalPtr_t Global::create(const ProblemConstPtr_t& problem,
 
 Global::Global(const DistancePtr_t& distance,
                const SteeringMethodPtr_t& steeringMethod, value_type step,
-               value_type threshold, value_type hessianBound)
+               value_type threshold, value_type hessianBound,
+               bool estimateHessianBound, value_type safetyFactor)
     : PathProjector(distance, steeringMethod),
       step_(step),
       hessianBound_(hessianBound),
-      thresholdMin_(threshold) {
+      thresholdMin_(threshold),
+      estimateHessianBound_(estimateHessianBound),
+      safetyFactor_(safetyFactor) {
   // TODO Only steeringMethod::Straight has been tested so far.
   assert(HPP_DYNAMIC_PTR_CAST(hpp::core::steeringMethod::Straight,
                               steeringMethod));
@@ -95,7 +108,7 @@ bool Global::impl_apply(const PathPtr_t& path, PathPtr_t& proj) const {
       proj = path;
       success = true;
     } else {
-      if (hessianBound_ <= 0)
+      if (hessianBound_ <= 0 && !estimateHessianBound_)
         success = project(path, proj);
       else
         success = project2(path, proj);
@@ -336,6 +349,8 @@ bool Global::projectOneStep(ConfigProjector& p, Datas_t& ds,
       // dq_ = p.solver().lastStep();
       _d->sigma = p.sigma();
       ++_d->Niter;
+      if (_d->projected && estimateHessianBound_)
+        p.computeValueAndJacobian(_d->q, value_, _d->J);
       allAreSatisfied = allAreSatisfied && _d->projected;
       curUpdated = true;
     }
@@ -362,12 +377,12 @@ size_type Global::reinterpolate(const DevicePtr_t& robot, Configs_t& q,
   Lengths_t::iterator itL = (l.begin());
   Configs_t::iterator itCp = (q.begin());
   Configuration_t newQ(robot->configSize());
+  ConfigurationLayoutPtr_t layout(ConfigurationLayout::get(robot));
   size_type nbNewC = 0;
   for (Configs_t::iterator it = begin; it != last; ++it) {
     if (*itL > maxDist) {
       ++nbNewC;
-      pinocchio::interpolate<pinocchio::RnxSOnLieGroupMap>(robot, *itCp, *it,
-                                                           0.5, newQ);
+      layout->interpolate(*itCp, *it, 0.5, newQ);
       // FIXME: make sure the iterator are valid after insertion
       // Insert new respective elements
       it = q.insert(it, newQ);
@@ -417,10 +432,12 @@ size_type Global::reinterpolate(const DevicePtr_t& robot, ConfigProjector& p,
   size_type nbNewC = 0;
   Data newD;
   newD.q.resize(robot->configSize());
+  ConfigurationLayoutPtr_t layout(ConfigurationLayout::get(robot));
   const std::size_t maxIter = p.maxIterations();
-  const value_type K = hessianBound_, dist_min = thresholdMin_,
-                   sigma_min = dist_min * K;
+  const value_type dist_min = thresholdMin_;
   for (Datas_t::iterator _d = begin; _d != last; ++_d) {
+    const value_type K = hessianBound(*_dPrev, *_d),
+                     sigma_min = dist_min * K;
     if (_dPrev->sigma < sigma_min || _dPrev->Niter >= maxIter) {
       hppDout(info, "Rejected sigma " << _d->sigma);
       last = _dPrev;
@@ -438,8 +455,7 @@ size_type Global::reinterpolate(const DevicePtr_t& robot, ConfigProjector& p,
       // _d->length) ) / 2;
       const value_type t = _dPrev->sigma / (K * _d->length);
       assert(t < 1 && t > 0);
-      pinocchio::interpolate<pinocchio::RnxSOnLieGroupMap>(robot, _dPrev->q,
-                                                           _d->q, t, newD.q);
+      layout->interpolate(_dPrev->q, _d->q, t, newD.q);
       hppDout(info, "Add config " << newD.q.transpose());
 
       // Insert new respective elements
@@ -573,17 +589,8 @@ bool Global::createPath(const DevicePtr_t& robot,
 }
 
 void Global::initialConfigList(const PathPtr_t& path, Configs_t& cfgs) const {
-  InterpolatedPathPtr_t ip = HPP_DYNAMIC_PTR_CAST(InterpolatedPath, path);
-  if (ip) {
-    // Get the waypoint of ip
-    const InterpolatedPath::InterpolationPoints_t& ips =
-        ip->interpolationPoints();
-    for (InterpolatedPath::InterpolationPoints_t::const_iterator it =
-             ips.begin();
-         it != ips.end(); ++it) {
-      cfgs.push_back(it->second);
-    }
-  } else {
+  if (!InterpolatedPath::visitWaypoints(
+          path, [&cfgs](const Configuration_t& q) { cfgs.push_back(q); })) {
     const value_type L = path->length();
     Configuration_t q(path->outputSize());
     cfgs.push_back(path->initial());
@@ -608,22 +615,27 @@ void Global::initialConfigList(const PathPtr_t& path, ConfigProjector& p,
   initData(newD, path->initial(), p, true, true);
   ds.push_back(newD);
 
-  InterpolatedPathPtr_t ip = HPP_DYNAMIC_PTR_CAST(InterpolatedPath, path);
-  if (ip) {
-    // Get the waypoint of ip
-    const InterpolatedPath::InterpolationPoints_t& ips =
-        ip->interpolationPoints();
-    InterpolatedPath::InterpolationPoints_t::const_iterator _ipPrev =
-        ips.begin();
-    for (InterpolatedPath::InterpolationPoints_t::const_iterator _ip =
-             ++(ips.begin());
-         _ip != ips.end(); ++_ip) {
-      initData(newD, _ip->second, p, true, false, _ipPrev->second);
-      ds.push_back(newD);
-      ++_ipPrev;
+  const Configuration_t* previous = NULL;
+  if (!InterpolatedPath::visitWaypoints(
+          path, [&](const Configuration_t& q) {
+            if (previous) {
+              initData(newD, q, p, true, false, *previous);
+              ds.push_back(newD);
+            }
+            previous = &q;
+          })) {
+    if (estimateHessianBound_) {
+      // The curvature is measured between consecutive configurations. Sample
+      // the path so that it is measured at least at the resolution of step_.
+      const value_type L = path->length();
+      Configuration_t q(path->outputSize());
+      for (value_type t = step_; t < L; t += step_ * 0.99) {
+        path->at(t, q);
+        initData(newD, q, p, true, false, ds.back().q);
+        ds.push_back(newD);
+      }
     }
-  } else {
-    initData(newD, path->end(), p, true, true, path->initial());
+    initData(newD, path->end(), p, true, true, ds.back().q);
     ds.push_back(newD);
   }
 }
@@ -638,6 +650,11 @@ void Global::initData(Data& data, const Configuration_t& q, ConfigProjector& p,
     p.solver().oneStep(q_, ls);
     // dq_ = p.solver().lastStep();
     data.sigma = p.sigma();
+    if (estimateHessianBound_) {
+      data.J.resize(p.solver().reducedDimension(), p.numberFreeVariables());
+      value_.resize(p.solver().dimension());
+      p.computeValueAndJacobian(q, value_, data.J);
+    }
   }
   data.projected = projected;
   data.alpha = LineSearch_t();
@@ -647,6 +664,15 @@ void Global::initData(Data& data, const Configuration_t& q, ConfigProjector& p,
   else
     data.length = 0;
 }
+
+value_type Global::hessianBound(const Data& prev, const Data& cur) const {
+  if (!estimateHessianBound_) return hessianBound_;
+  value_type K = HessianBoundEstimator::bound(prev.J, cur.J, cur.length,
+                                              safetyFactor_);
+  // A bound provided by the user is considered as a lower bound of the
+  // estimate.
+  return std::max(K, hessianBound_);
+}
 }  // namespace pathProjector
 }  // namespace core
 }  // namespace hpp
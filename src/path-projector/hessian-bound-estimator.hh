@@ -0,0 +1,135 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#ifndef HPP_CORE_SRC_PATH_PROJECTOR_HESSIAN_BOUND_ESTIMATOR_HH
+#define HPP_CORE_SRC_PATH_PROJECTOR_HESSIAN_BOUND_ESTIMATOR_HH
+
+#include <algorithm>
+#include <hpp/constraints/solver/by-substitution.hh>
+#include <hpp/core/config-projector.hh>
+
+namespace hpp {
+namespace core {
+namespace pathProjector {
+/// Online estimation of a bound of the Hessian of the constraints.
+///
+/// The variation of the reduced Jacobian between two configurations,
+/// divided by the distance between them, is a finite difference
+/// approximation of the norm of the Hessian along the segment. The
+/// Frobenius norm is used since it bounds the operator norm from above.
+///
+/// The estimate is multiplied by a safety factor. Previous estimates
+/// are forgotten geometrically so that the bound follows the local
+/// curvature of the constraint manifold.
+class HessianBoundEstimator {
+ public:
+  /// Constructor
+  /// \param cp the constraints,
+  /// \param safetyFactor factor applied to the measured curvature,
+  /// \param decay factor by which previous estimates are multiplied
+  ///        at each update.
+  HessianBoundEstimator(ConfigProjector& cp, value_type safetyFactor,
+                        value_type decay = .5)
+      : cp_(cp),
+        safetyFactor_(safetyFactor),
+        decay_(decay),
+        estimate_(0),
+        candidate_(0),
+        hasEstimate_(false) {
+    const size_type rows = cp.solver().reducedDimension(),
+                    cols = cp.numberFreeVariables();
+    value_.resize(cp.solver().dimension());
+    J0_.resize(rows, cols);
+    J1_.resize(rows, cols);
+  }
+
+  /// Set the reference configuration, forgetting previous estimates.
+  void reset(ConfigurationIn_t q) {
+    cp_.computeValueAndJacobian(q, value_, J0_);
+    estimate_ = candidate_ = 0;
+    hasEstimate_ = false;
+  }
+
+  /// Whether at least one segment has been accepted.
+  bool hasEstimate() const { return hasEstimate_; }
+
+  /// Compute the bound on the segment between the reference configuration
+  /// and q, without modifying the reference.
+  /// \param dist distance between the reference configuration and q.
+  value_type evaluate(ConfigurationIn_t q, value_type dist) {
+    cp_.computeValueAndJacobian(q, value_, J1_);
+    value_type local = 0;
+    if (dist > Eigen::NumTraits<value_type>::dummy_precision())
+      local = (J1_ - J0_).norm() / dist;
+    candidate_ = hasEstimate_ ? std::max(local, decay_ * estimate_) : local;
+    return bound(candidate_);
+  }
+
+  /// Make the configuration given to the last call to evaluate the
+  /// reference configuration and store the corresponding estimate.
+  void accept() {
+    J0_.swap(J1_);
+    estimate_ = candidate_;
+    hasEstimate_ = true;
+  }
+
+  /// Current bound of the norm of the Hessian.
+  value_type bound() const { return bound(estimate_); }
+
+  /// Bound of the Hessian between two configurations of which the reduced
+  /// Jacobians are known.
+  static value_type bound(matrixIn_t J0, matrixIn_t J1, value_type dist,
+                          value_type safetyFactor) {
+    if (dist <= Eigen::NumTraits<value_type>::dummy_precision())
+      return minimalBound();
+    return std::max(safetyFactor * (J1 - J0).norm() / dist, minimalBound());
+  }
+
+  /// Bound returned when the constraints look linear.
+  ///
+  /// It prevents infinite steps when the Jacobian does not vary.
+  static value_type minimalBound() {
+    return Eigen::NumTraits<value_type>::dummy_precision();
+  }
+
+ private:
+  value_type bound(const value_type& estimate) const {
+    return std::max(safetyFactor_ * estimate, minimalBound());
+  }
+
+  ConfigProjector& cp_;
+  const value_type safetyFactor_, decay_;
+  value_type estimate_, candidate_;
+  bool hasEstimate_;
+  vector_t value_;
+  matrix_t J0_, J1_;
+};  // class HessianBoundEstimator
+}  // namespace pathProjector
+}  // namespace core
+}  // namespace hpp
+
+#endif  // HPP_CORE_SRC_PATH_PROJECTOR_HESSIAN_BOUND_ESTIMATOR_HH
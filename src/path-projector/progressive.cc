@@ -43,6 +43,8 @@
 #include <queue>
 #include <stack>
 
+#include "path-projector/hessian-bound-estimator.hh"
+
 namespace hpp {
 namespace core {
 namespace pathProjector {
@@ -57,10 +59,18 @@ ProgressivePtr_t Progressive::create(const DistancePtr_t& distance,
   value_type thr_min = steeringMethod->problem()
                            ->getParameter("PathProjection/MinimalDist")
                            .floatValue();
+  bool estimate = steeringMethod->problem()
+                      ->getParameter("PathProjection/EstimateHessianBound")
+                      .boolValue();
+  value_type safetyFactor =
+      steeringMethod->problem()
+          ->getParameter("PathProjection/HessianBoundSafetyFactor")
+          .floatValue();
   hppDout(info, "Hessian bound is " << hessianBound);
   hppDout(info, "Min Dist is " << thr_min);
-  return ProgressivePtr_t(
-      new Progressive(distance, steeringMethod, step, thr_min, hessianBound));
+  return ProgressivePtr_t(new Progressive(distance, steeringMethod, step,
+                                          thr_min, hessianBound, estimate,
+                                          safetyFactor));
 }
 
 ProgressivePtr_t Progressive::create(const ProblemConstPtr_t& problem,
@@ -71,12 +81,15 @@ ProgressivePtr_t Progressive::create(const ProblemConstPtr_t& problem,
 Progressive::Progressive(const DistancePtr_t& distance,
                          const SteeringMethodPtr_t& steeringMethod,
                          value_type step, value_type thresholdMin,
-                         value_type hessianBound)
+                         value_type hessianBound, bool estimateHessianBound,
+                         value_type safetyFactor)
     : PathProjector(distance, steeringMethod),
       step_(step),
       thresholdMin_(thresholdMin),
       hessianBound_(hessianBound),
-      withHessianBound_(hessianBound > 0) {
+      withHessianBound_(hessianBound > 0),
+      estimateHessianBound_(estimateHessianBound),
+      safetyFactor_(safetyFactor) {
   steeringMethod::StraightPtr_t sm(
       HPP_DYNAMIC_PTR_CAST(steeringMethod::Straight, steeringMethod));
   if (!sm)
@@ -150,14 +163,20 @@ bool Progressive::project(const PathPtr_t& path, PathPtr_t& proj) const {
   Configuration_t qi(q1.size());
   value_type curStep, curLength, totalLength = 0;
   size_t c = 0;
-  const value_type& K = hessianBound_;  // upper bound of Hessian
-  if (withHessianBound_) cp->solver().oneStep(qtmp, lineSearch);
+  value_type K = hessianBound_;  // upper bound of Hessian
+  // Until a first segment has been measured, the estimated bound falls back
+  // to the user provided bound or to the fixed step.
+  bool useBound = withHessianBound_;
+  const bool computeSigma = withHessianBound_ || estimateHessianBound_;
+  HessianBoundEstimator estimator(*cp, safetyFactor_);
+  if (estimateHessianBound_) estimator.reset(q1);
+  if (computeSigma) cp->solver().oneStep(qtmp, lineSearch);
   value_type sigma = cp->sigma();
 
   value_type min = std::numeric_limits<value_type>::max(), max = 0;
 
   while (true) {
-    const value_type threshold = (withHessianBound_ ? sigma / K : step_);
+    const value_type threshold = (useBound ? sigma / K : step_);
     const value_type thr_min = thresholdMin_;
 
     if (toSplit->length() < threshold) {
@@ -194,7 +213,22 @@ bool Progressive::project(const PathPtr_t& path, PathPtr_t& proj) const {
     assert(curLength == d(qb, qi));
     assert(constraints->isSatisfied(qi));
 
-    if (withHessianBound_) {
+    if (estimateHessianBound_) {
+      // Check that the segment is consistent with the curvature measured
+      // along it. Otherwise, try again with the updated bound.
+      const value_type Kseg = estimator.evaluate(qi, curLength);
+      if (curLength > sigma / Kseg) {
+        K = Kseg;
+        useBound = true;
+        c++;
+        continue;
+      }
+      estimator.accept();
+      K = estimator.bound();
+      useBound = true;
+    }
+
+    if (computeSigma) {
       /// Update sigma
       qtmp = qi;
       cp->solver().oneStep(qtmp, lineSearch);
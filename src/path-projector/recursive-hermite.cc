@@ -26,9 +26,6 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
 // DAMAGE.
 
-#include <iostream>
-#include <typeinfo>
-using namespace std;
 #include "hpp/core/path-projector/recursive-hermite.hh"
 
 #include <hpp/core/config-projector.hh>
@@ -110,7 +107,6 @@ bool RecursiveHermite::impl_apply(const PathPtr_t& path,
 }
 
 bool RecursiveHermite::project(const PathPtr_t& path, PathPtr_t& proj) const {
-  cout << "done \n\n\n" << endl;
   ConstraintSetPtr_t constraints = path->constraints();
   if (!constraints) {
     proj = path;
@@ -124,7 +120,6 @@ bool RecursiveHermite::project(const PathPtr_t& path, PathPtr_t& proj) const {
     proj = path;
     return true;
   }
-  cout << "done \n\n\n" << endl;
   steeringMethod_->constraints(constraints);
 
   const value_type thr = 2 * cp->errorThreshold() / M_;
@@ -132,34 +127,23 @@ bool RecursiveHermite::project(const PathPtr_t& path, PathPtr_t& proj) const {
   std::vector<HermitePtr_t> ps;
   HermitePtr_t p = HPP_DYNAMIC_PTR_CAST(Hermite, path);
   if (!p) {
-    InterpolatedPathPtr_t ip = HPP_DYNAMIC_PTR_CAST(InterpolatedPath, path);
-    if (ip) {
-      typedef InterpolatedPath::InterpolationPoints_t IPs_t;
-      const IPs_t& ips = ip->interpolationPoints();
-      ps.reserve(ips.size() - 1);
-      IPs_t::const_iterator _ip1 = ips.begin();
-      std::advance(_ip1, 1);
-
-      for (IPs_t::const_iterator _ip0 = ips.begin(); _ip1 != ips.end();
-           ++_ip0) {
-        cout << "done \n\n\n" << endl;
-        ps.push_back(
-            HPP_DYNAMIC_PTR_CAST(Hermite, steer(_ip0->second, _ip1->second)));
-        ++_ip1;
-        cout << "done___h \n\n\n" << endl;
-      }
-    } else {
+    const Configuration_t* previous = NULL;
+    if (!InterpolatedPath::visitWaypoints(
+            path, [&](const Configuration_t& q) {
+              if (previous)
+                ps.push_back(
+                    HPP_DYNAMIC_PTR_CAST(Hermite, steer(*previous, q)));
+              previous = &q;
+            })) {
       p = HPP_DYNAMIC_PTR_CAST(Hermite, steer(path->initial(), path->end()));
       ps.push_back(p);
     }
   } else {
     ps.push_back(p);
   }
-  cout << "done \n\n\n" << endl;
   PathVectorPtr_t res =
       PathVector::create(path->outputSize(), path->outputDerivativeSize());
   bool success = true;
-  cout << "done \n\n\n" << endl;
   for (std::size_t i = 0; i < ps.size(); ++i) {
     p = ps[i];
     p->computeHermiteLength();
@@ -167,16 +151,14 @@ bool RecursiveHermite::project(const PathPtr_t& path, PathPtr_t& proj) const {
       res->appendPath(p);
       continue;
     }
-    cout << "done \n\n\n" << endl;
     PathVectorPtr_t r =
         PathVector::create(path->outputSize(), path->outputDerivativeSize());
-    std::cout << p->hermiteLength() << " / " << thr << " : "
-              << path->constraints()->name() << std::endl;
+    hppDout(info, p->hermiteLength() << " / " << thr << " : "
+                                     << path->constraints()->name());
     success = recurse(p, r, thr);
     res->concatenate(r);
     if (!success) break;
   }
-cout << "done \n\n\n" << endl;
 #if HPP_ENABLE_BENCHMARK
   value_type min = std::numeric_limits<value_type>::max(), max = 0,
              totalLength = 0;
@@ -212,7 +194,6 @@ cout << "done \n\n\n" << endl;
       break;
   }
   return false;
-  cout << "done \n\n\n" << endl;
 }
 
 bool RecursiveHermite::recurse(const HermitePtr_t& path, PathVectorPtr_t& proj,
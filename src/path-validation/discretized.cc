@@ -27,12 +27,14 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
 // DAMAGE.
 
+#include <hpp/core/arc-length-path.hh>
 #include <hpp/core/collision-path-validation-report.hh>
 #include <hpp/core/collision-validation.hh>
 #include <hpp/core/config-validations.hh>
 #include <hpp/core/path-validation/discretized.hh>
 #include <hpp/core/path.hh>
 #include <hpp/core/projection-error.hh>
+#include <hpp/core/time-parameterization/arc-length.hh>
 #include <hpp/pinocchio/device.hh>
 #include <hpp/util/debug.hh>
 
@@ -61,21 +63,33 @@ bool Discretized::validate(const PathPtr_t& path, bool reverse,
   bool valid = true;
   const value_type tmin = path->timeRange().first;
   const value_type tmax = path->timeRange().second;
+  // Step along the length of the path if a distance is set, along the time
+  // otherwise or if the path fails to project the configurations needed to
+  // measure its length. The time of a path parameterized by its length
+  // under the same distance is its length.
+  timeParameterization::ArcLengthPtr_t arcLength;
+  ArcLengthPathPtr_t alp(HPP_DYNAMIC_PTR_CAST(ArcLengthPath, path));
+  if (distance_ && !(alp && alp->arcLength()->distance() == distance_))
+    arcLength = timeParameterization::ArcLength::create(path, distance_);
+  const value_type umin = arcLength ? 0 : tmin;
+  const value_type umax = arcLength ? arcLength->length() : tmax;
   unsigned finished = 0;
   Configuration_t q(path->outputSize());
-  value_type T1, step, lastValidTime;
+  value_type u, U1, step, lastValidTime;
   if (reverse) {
     lastValidTime = tmax;
-    T1 = tmin;
+    u = umax;
+    U1 = umin;
     step = -stepSize_;
   } else {
     lastValidTime = tmin;
-    T1 = tmax;
+    u = umin;
+    U1 = umax;
     step = stepSize_;
   }
 
-  value_type t = lastValidTime;
   while (finished < 2 && valid) {
+    const value_type t = arcLength ? arcLength->value(u) : u;
     bool success = (*path)(q, t);
     if (!success) {
       validationReport = PathValidationReportPtr_t(new PathValidationReport(
@@ -87,10 +101,10 @@ bool Discretized::validate(const PathPtr_t& path, bool reverse,
       valid = false;
     } else {
       lastValidTime = t;
-      t += step;
+      u += step;
     }
-    if ((reverse && t < T1) || (!reverse && t > T1)) {
-      t = T1;
+    if ((reverse && u < U1) || (!reverse && u > U1)) {
+      u = U1;
       finished++;
     }
   }
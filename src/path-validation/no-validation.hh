@@ -53,6 +53,9 @@ class NoValidation : public PathValidation {
     NoValidationPtr_t shPtr(ptr);
     return shPtr;
   }
+  virtual PathValidationPtr_t copy() const {
+    return NoValidationPtr_t(new NoValidation());
+  }
 
  protected:
   NoValidation() {}
@@ -84,6 +84,16 @@ bool PathValidations::validate(ConfigurationIn_t q,
   return true;
 }
 
+PathValidationPtr_t PathValidations::copy() const {
+  PathValidationsPtr_t result(create());
+  for (const PathValidationPtr_t& pv : validations_) {
+    PathValidationPtr_t c(pv->copy());
+    if (!c) return PathValidationPtr_t();
+    result->addPathValidation(c);
+  }
+  return result;
+}
+
 PathValidations::PathValidations() {}
 }  // namespace core
 }  // namespace hpp
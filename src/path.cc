@@ -98,7 +98,6 @@ Path::Path(const interval_t& interval, size_type outputSize,
       outputSize_(outputSize),
       outputDerivativeSize_(outputDerivativeSize),
       constraints_() {
-  cout << "passed by path with interval, outputsizes and constrait" << endl;
   if (constraints) {
     constraints_ = HPP_STATIC_PTR_CAST(ConstraintSet, constraints->copy());
   }
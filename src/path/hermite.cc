@@ -27,6 +27,7 @@
 // DAMAGE.
 
 #include <hpp/core/config-projector.hh>
+#include <hpp/core/configuration-layout.hh>
 #include <hpp/core/path/hermite.hh>
 #include <hpp/core/projection-error.hh>
 #include <hpp/pinocchio/configuration.hh>
@@ -48,8 +49,7 @@ Hermite::Hermite(const DevicePtr_t& device, ConfigurationIn_t init,
 
   base(init);
   parameters_.row(0).setZero();
-  pinocchio::difference<hpp::pinocchio::RnxSOnLieGroupMap>(robot_, init, end,
-                                                           parameters_.row(3));
+  ConfigurationLayout::get(robot_)->difference(init, end, parameters_.row(3));
   projectVelocities(init, end);
 }
 
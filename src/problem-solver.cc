@@ -29,6 +29,8 @@
 
 #include <hpp/fcl/collision_utility.h>
 
+#include <algorithm>
+#include <exception>
 #include <hpp/constraints/differentiable-function.hh>
 #include <hpp/constraints/implicit.hh>
 #include <hpp/constraints/locked-joint.hh>
@@ -36,22 +38,35 @@
 #include <hpp/core/bi-rrt-planner.hh>
 #include <hpp/core/collision-validation.hh>
 #include <hpp/core/config-projector.hh>
+#include <hpp/core/config-validations.hh>
+#include <hpp/core/configuration-shooter/bridge.hh>
 #include <hpp/core/configuration-shooter/gaussian.hh>
+#include <hpp/core/configuration-shooter/reduced-coordinates.hh>
+#include <hpp/core/configuration-shooter/retraction.hh>
 #include <hpp/core/configuration-shooter/uniform.hh>
+#include <hpp/core/connected-component.hh>
 #include <hpp/core/constraint-set.hh>
 #include <hpp/core/continuous-validation/dichotomy.hh>
 #include <hpp/core/continuous-validation/progressive.hh>
 #include <hpp/core/diffusing-planner.hh>
 #include <hpp/core/distance-between-objects.hh>
 #include <hpp/core/distance/reeds-shepp.hh>
+#include <hpp/core/edge.hh>
+#include <hpp/core/experience-library.hh>
+#include <hpp/core/inverse-kinematics/spherical-wrist.hh>
 #include <hpp/core/joint-bound-validation.hh>
 #include <hpp/core/kinodynamic-distance.hh>
+#include <hpp/core/node.hh>
+#include <hpp/core/path-optimization/gradient-based.hh>
 #include <hpp/core/path-optimization/partial-shortcut.hh>
 #include <hpp/core/path-optimization/random-shortcut.hh>
 #include <hpp/core/path-optimization/simple-shortcut.hh>
 #include <hpp/core/path-optimization/simple-time-parameterization.hh>
+#include <hpp/core/path-optimization/windowed.hh>
+#include <hpp/core/path-planner.hh>
 #include <hpp/core/path-planner/bi-rrt-star.hh>
 #include <hpp/core/path-planner/k-prm-star.hh>
+#include <hpp/core/path-planner/prioritized.hh>
 #include <hpp/core/path-projector/dichotomy.hh>
 #include <hpp/core/path-projector/global.hh>
 #include <hpp/core/path-projector/progressive.hh>
@@ -59,11 +74,13 @@
 #include <hpp/core/path-validation-report.hh>
 #include <hpp/core/path-validation/discretized-collision-checking.hh>
 #include <hpp/core/path-validation/discretized-joint-bound.hh>
+#include <hpp/core/path-validation/discretized.hh>
 #include <hpp/core/path-vector.hh>
 #include <hpp/core/problem-solver.hh>
 #include <hpp/core/problem-target/goal-configurations.hh>
 #include <hpp/core/problem-target/task-target.hh>
 #include <hpp/core/roadmap.hh>
+#include <hpp/core/steering-method/cartesian.hh>
 #include <hpp/core/steering-method/dubins.hh>
 #include <hpp/core/steering-method/hermite.hh>
 #include <hpp/core/steering-method/reeds-shepp.hh>
@@ -71,17 +88,22 @@
 #include <hpp/core/steering-method/spline.hh>
 #include <hpp/core/steering-method/steering-kinodynamic.hh>
 #include <hpp/core/steering-method/straight.hh>
+#include <hpp/core/task-scheduler.hh>
 #include <hpp/core/visibility-prm-planner.hh>
 #include <hpp/core/weighed-distance.hh>
 #include <hpp/pinocchio/collision-object.hh>
 #include <hpp/pinocchio/joint-collection.hh>
 #include <hpp/util/debug.hh>
 #include <hpp/util/exception-factory.hh>
+#include <hpp/util/timer.hh>
 #include <iterator>
 #include <pinocchio/algorithm/frames.hpp>
 #include <pinocchio/multibody/fcl.hpp>
 #include <pinocchio/multibody/geometry.hpp>
+#include <stdexcept>
 
+#include "../src/astar.hh"
+#include "../src/nearest-neighbor/metric-tree.hh"
 #include "../src/path-validation/no-validation.hh"
 
 namespace hpp {
@@ -149,6 +171,44 @@ configurationShooter::UniformPtr_t createUniformConfigShooter(
   return ptr;
 }
 
+configurationShooter::ReducedCoordinatesPtr_t
+createReducedCoordinatesConfigShooter(const ProblemConstPtr_t& p) {
+  configurationShooter::ReducedCoordinatesPtr_t ptr(
+      configurationShooter::ReducedCoordinates::create(p->robot(),
+                                                       p->constraints()));
+  ptr->innerShooter(createUniformConfigShooter(p));
+  return ptr;
+}
+
+configurationShooter::BridgePtr_t createBridgeConfigShooter(
+    const ProblemConstPtr_t& p) {
+  configurationShooter::BridgePtr_t ptr(
+      configurationShooter::Bridge::create(p->robot(), p->configValidations()));
+  ptr->sigma(p->getParameter("ConfigurationShooter/Bridge/standardDeviation")
+                 .floatValue());
+  ptr->uniformRatio(
+      p->getParameter("ConfigurationShooter/Bridge/uniformRatio").floatValue());
+  ptr->maxTrials(
+      p->getParameter("ConfigurationShooter/Bridge/maxTrials").intValue());
+  ptr->sampleExtraDOF(
+      p->getParameter("ConfigurationShooter/sampleExtraDOF").boolValue());
+  return ptr;
+}
+
+configurationShooter::RetractionPtr_t createRetractionConfigShooter(
+    const ProblemConstPtr_t& p) {
+  configurationShooter::RetractionPtr_t ptr(
+      configurationShooter::Retraction::create(p->robot(),
+                                               p->configValidations(),
+                                               createUniformConfigShooter(p)));
+  ptr->maxIterations(
+      p->getParameter("ConfigurationShooter/Retraction/maxIterations")
+          .intValue());
+  ptr->margin(
+      p->getParameter("ConfigurationShooter/Retraction/margin").floatValue());
+  return ptr;
+}
+
 ProblemSolverPtr_t ProblemSolver::create() {
   return ProblemSolverPtr_t(new ProblemSolver());
 }
@@ -200,9 +260,15 @@ ProblemSolver::ProblemSolver()
   pathPlanners.add("BiRRTPlanner", BiRRTPlanner::createWithRoadmap);
   pathPlanners.add("kPRM*", pathPlanner::kPrmStar::createWithRoadmap);
   pathPlanners.add("BiRRT*", pathPlanner::BiRrtStar::createWithRoadmap);
+  pathPlanners.add("PrioritizedPlanner",
+                   pathPlanner::Prioritized::createWithRoadmap);
 
   configurationShooters.add("Uniform", createUniformConfigShooter);
   configurationShooters.add("Gaussian", createGaussianConfigShooter);
+  configurationShooters.add("ReducedCoordinates",
+                            createReducedCoordinatesConfigShooter);
+  configurationShooters.add("Bridge", createBridgeConfigShooter);
+  configurationShooters.add("Retraction", createRetractionConfigShooter);
 
   distances.add("Weighed", WeighedDistance::createFromProblem);
   distances.add(
@@ -224,6 +290,12 @@ ProblemSolver::ProblemSolver()
                       steeringMethod::Spline<path::BernsteinBasis, 3>::create);
   steeringMethods.add("SplineBezier5",
                       steeringMethod::Spline<path::BernsteinBasis, 5>::create);
+  steeringMethods.add(
+      "Cartesian",
+      std::bind(
+          static_cast<steeringMethod::CartesianPtr_t (*)(
+              const ProblemConstPtr_t&)>(steeringMethod::Cartesian::create),
+          std::placeholders::_1));
 
   // Store path optimization methods in map.
   pathOptimizers.add("RandomShortcut",
@@ -234,6 +306,23 @@ ProblemSolver::ProblemSolver()
                      pathOptimization::PartialShortcut::create);
   pathOptimizers.add("SimpleTimeParameterization",
                      pathOptimization::SimpleTimeParameterization::create);
+  pathOptimizers.add("GradientBased", pathOptimization::GradientBased::create);
+  pathOptimizers.add("Windowed", [this](const ProblemConstPtr_t& p) {
+    std::string inner(
+        p->getParameter("PathOptimization/Windowed/Optimizer").stringValue());
+    // Windows optimized by Windowed would be split again, without end.
+    if (inner == "Windowed")
+      throw std::invalid_argument(
+          "Windowed cannot be the inner optimizer of Windowed.");
+    return PathOptimizerPtr_t(
+        pathOptimization::Windowed::create(p, pathOptimizers.get(inner)));
+  });
+
+  // Store inverse kinematics solvers in map.
+  inverseKinematics.add("SphericalWrist", [](const DevicePtr_t& robot) {
+    return InverseKinematicsPtr_t(
+        inverseKinematics::SphericalWrist::create(robot));
+  });
 
   // Store path validation methods in map.
   pathValidations.add("NoValidation", pathValidation::NoValidation::create);
@@ -369,11 +458,23 @@ static void setObstaclesToPathValidation(const ProblemPtr_t& problem,
   }
 }
 
+// Make discretized path validation step along the length of paths
+static void setDistanceToPathValidation(const ProblemPtr_t& problem,
+                                        const PathValidationPtr_t& pv) {
+  pathValidation::DiscretizedPtr_t discretized(
+      HPP_DYNAMIC_PTR_CAST(pathValidation::Discretized, pv));
+  if (discretized &&
+      problem->getParameter("PathValidation/Discretized/ArcLength")
+          .boolValue())
+    discretized->distance(problem->distance());
+}
+
 void ProblemSolver::initPathValidation() {
   if (!problem_) throw std::runtime_error("The problem is not defined.");
   PathValidationPtr_t pathValidation = pathValidations.get(pathValidationType_)(
       robot_, pathValidationTolerance_);
   setObstaclesToPathValidation(problem_, pathValidation);
+  setDistanceToPathValidation(problem_, pathValidation);
   problem_->pathValidation(pathValidation);
 }
 
@@ -481,6 +582,7 @@ void ProblemSolver::setGoalConstraints(
       ConstraintSet::create(problem_->robot(), "goalConstraints"));
   ConfigProjectorPtr_t cp(ConfigProjector::create(
       robot_, "Goal ConfigProjector", errorThreshold_, maxIterProjection_));
+  addInverseKinematics(cp);
   cs->addConstraint(cp);
   for (auto c : constraints) {
     cp->add(c);
@@ -517,6 +619,7 @@ void ProblemSolver::addNumericalConstraintToConfigProjector(
   if (!configProjector) {
     configProjector = ConfigProjector::create(
         robot_, configProjName, errorThreshold_, maxIterProjection_);
+    addInverseKinematics(configProjector);
     constraints_->addConstraint(configProjector);
   }
   if (!numericalConstraints.has(constraintName)) {
@@ -527,6 +630,14 @@ void ProblemSolver::addNumericalConstraintToConfigProjector(
   configProjector->add(numericalConstraints.get(constraintName), priority);
 }
 
+void ProblemSolver::addInverseKinematics(
+    const ConfigProjectorPtr_t& configProjector) const {
+  for (const auto& builder : inverseKinematics.map) {
+    InverseKinematicsPtr_t ik(builder.second(robot_));
+    if (ik) configProjector->addInverseKinematics(ik);
+  }
+}
+
 void ProblemSolver::comparisonType(const std::string& name,
                                    const ComparisonTypes_t types) {
   constraints::ImplicitPtr_t nc;
@@ -659,6 +770,12 @@ void ProblemSolver::problem(ProblemPtr_t problem) { problem_ = problem; }
 void ProblemSolver::resetRoadmap() {
   if (!problem_) throw std::runtime_error("The problem is not defined.");
   roadmap_ = Roadmap::create(problem_->distance(), problem_->robot());
+  if (problem_->getParameter("Roadmap/NearestNeighbor").stringValue() ==
+      "MetricTree")
+    roadmap_->nearestNeighbor(new nearestNeighbor::MetricTree(
+        problem_->distance(),
+        problem_->getParameter("Roadmap/NearestNeighbor/SymmetricDistance")
+            .boolValue()));
 }
 
 void ProblemSolver::createPathOptimizers() {
@@ -675,6 +792,7 @@ void ProblemSolver::initDistance() {
   if (!problem_) throw std::runtime_error("The problem is not defined.");
   DistancePtr_t dist(distances.get(distanceType_)(problem_));
   problem_->distance(dist);
+  setDistanceToPathValidation(problem_, problem_->pathValidation());
 }
 
 void ProblemSolver::initSteeringMethod() {
@@ -726,9 +844,167 @@ void ProblemSolver::finishSolveStepByStep() {
 void ProblemSolver::solve() {
   initProblem();
 
+  if (experienceLibrary_ && initConf_ &&
+      HPP_DYNAMIC_PTR_CAST(problemTarget::GoalConfigurations, target_)) {
+    std::size_t k(
+        (std::size_t)problem_
+            ->getParameter("ProblemSolver/Experience/NumberRetrieved")
+            .intValue());
+    for (const ConfigurationPtr_t& goal : goalConfigurations_) {
+      PathVectorPtr_t path(
+          experienceLibrary_->solve(pathPlanner_, *initConf_, *goal, k));
+      if (path) {
+        hppDout(info, "Solution found in the experience library.");
+        paths_.push_back(path);
+        optimizePath(path);
+        return;
+      }
+    }
+    hppDout(info, "No experience could be reused, planning.");
+  }
+
   PathVectorPtr_t path = pathPlanner_->solve();
   paths_.push_back(path);
   optimizePath(path);
+  if (experienceLibrary_) experienceLibrary_->add(paths_.back());
+}
+
+ProblemSolver::QueryResults_t ProblemSolver::solveQueries(
+    const Queries_t& queries) {
+  namespace bpt = boost::posix_time;
+
+  bpt::ptime timeStart(bpt::microsec_clock::universal_time());
+  initProblem();
+  QueryResults_t results(queries.size());
+  if (queries.empty()) return results;
+  ProblemTargetPtr_t target(target_);
+  // Nodes added to the roadmap for the queries
+  NodeVector_t queryNodes;
+  // Restore the roadmap and the query of the problem, whether the queries
+  // are solved or not.
+  auto restore = [&]() {
+    roadmap_->removeNodes(queryNodes);
+    problem_->initConfig(initConf_);
+    target_ = target;
+    initProblemTarget();
+    roadmap_->resetGoalNodes();
+    if (initConf_) roadmap_->initNode(initConf_);
+    for (const ConfigurationPtr_t& goal : goalConfigurations_)
+      roadmap_->addGoalNode(goal);
+  };
+
+  NodeVector_t inits, goals;
+  std::vector<std::size_t> searches;
+  std::vector<PathVectorPtr_t> solutions(queries.size());
+  std::exception_ptr error;
+  try {
+    // Insert the endpoints of all queries in the roadmap
+    inits.reserve(queries.size());
+    goals.reserve(queries.size());
+    auto addNode = [&](const ConfigurationPtr_t& q) {
+      std::size_t nbNodes(roadmap_->nodes().size());
+      NodePtr_t node(roadmap_->addNode(q));
+      if (roadmap_->nodes().size() > nbNodes) queryNodes.push_back(node);
+      return node;
+    };
+    for (const Query_t& query : queries) {
+      inits.push_back(addNode(query.first));
+      goals.push_back(addNode(query.second));
+    }
+    // The path planner expands the roadmap for one query at a time.
+    std::size_t focus = 0;
+    auto focusOn = [&](std::size_t i) {
+      focus = i;
+      problem_->initConfig(queries[i].first);
+      problemTarget::GoalConfigurationsPtr_t gc(
+          problemTarget::GoalConfigurations::create(problem_));
+      gc->addConfiguration(queries[i].second);
+      target_ = gc;
+      initProblemTarget();
+      pathPlanner_->startSolve();
+    };
+    focusOn(0);
+    pathPlanner_->tryConnectNodes(inits, goals);
+
+    // Expand the roadmap while some queries are not solved
+    std::vector<bool> solved(queries.size(), false);
+    std::size_t nbSolved = 0;
+    unsigned long int nIter = 0;
+    while (true) {
+      value_type elapsed = 1e-6 * static_cast<value_type>(
+                                      (bpt::microsec_clock::universal_time() -
+                                       timeStart)
+                                          .total_microseconds());
+      for (std::size_t i = 0; i < queries.size(); ++i) {
+        if (solved[i] || !inits[i]->connectedComponent()->canReach(
+                             goals[i]->connectedComponent()))
+          continue;
+        solved[i] = true;
+        ++nbSolved;
+        results[i].iterations = (size_type)nIter;
+        results[i].time = elapsed;
+      }
+      if (nbSolved == queries.size()) break;
+      if (nIter >= maxIterPathPlanning_ || elapsed > timeOutPathPlanning_) {
+        hppDout(info, queries.size() - nbSolved << " queries out of "
+                                                << queries.size()
+                                                << " are not solved.");
+        break;
+      }
+      // Interleave the expansion steps between the unsolved queries.
+      std::size_t next((focus + 1) % queries.size());
+      while (solved[next]) next = (next + 1) % queries.size();
+      if (next != focus) focusOn(next);
+      pathPlanner_->oneStep();
+      ++nIter;
+    }
+
+    // Search the roadmap for each solved query. Searches only read the
+    // roadmap and the distance and can thus run concurrently.
+    for (std::size_t i = 0; i < queries.size(); ++i)
+      if (solved[i]) searches.push_back(i);
+    size_type nbThreads(
+        problem_->getParameter("ProblemSolver/Queries/NumberThreads")
+            .intValue());
+    // If not positive, use all the threads of the scheduler.
+    if (nbThreads < 1) nbThreads = 0;
+
+    DistancePtr_t distance(problem_->distance());
+    auto search = [&](std::size_t k) {
+      std::size_t i = searches[k];
+      Astar astar(roadmap_, distance, inits[i], NodeVector_t(1, goals[i]));
+      Astar::Edges_t edges(astar.solutionEdges());
+      PathVectorPtr_t path(
+          PathVector::create(robot_->configSize(), robot_->numberDof()));
+      for (const EdgePtr_t& edge : edges) path->appendPath(edge->path());
+      solutions[i] = path;
+      results[i].numberEdges = (size_type)edges.size();
+    };
+    if (nbThreads == 1 || searches.size() == 1) {
+      // Do not wake up the scheduler for sequential runs.
+      for (std::size_t k = 0; k < searches.size(); ++k) search(k);
+    } else {
+      TaskGroup group(problem_->taskScheduler());
+      group.parallelFor(0, searches.size(), search, (std::size_t)nbThreads);
+      group.wait();
+    }
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  // Restore the problem before reporting errors
+  restore();
+  if (error) std::rethrow_exception(error);
+
+  for (std::size_t i : searches) {
+    // This happens when the initial and goal configurations are equal.
+    if (solutions[i]->numberPaths() == 0)
+      solutions[i]->appendPath(
+          (*problem_->steeringMethod())(*queries[i].first, *queries[i].first));
+    results[i].success = true;
+    results[i].pathId = addPath(solutions[i]);
+  }
+  return results;
 }
 
 bool ProblemSolver::directPath(ConfigurationIn_t start, ConfigurationIn_t end,
@@ -1053,6 +1329,29 @@ Problem::declareParameter(ParameterDescription(
 Problem::declareParameter(ParameterDescription(
     Parameter::FLOAT, "ConfigurationShooter/Gaussian/standardDeviation",
     "Scale the default standard deviation with this factor.", Parameter(0.25)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "ConfigurationShooter/Bridge/standardDeviation",
+    "Scale the default standard deviation of the gaussian distribution of "
+    "the second end of the bridge with this factor.",
+    Parameter(0.05)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "ConfigurationShooter/Bridge/uniformRatio",
+    "Ratio of the configurations that are uniformly sampled.",
+    Parameter(0.2)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::INT, "ConfigurationShooter/Bridge/maxTrials",
+    "Maximal number of bridges tested before returning a uniformly sampled "
+    "configuration.",
+    Parameter((size_type)100)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::INT, "ConfigurationShooter/Retraction/maxIterations",
+    "Maximal number of steps moving a configuration in collision toward "
+    "the free space.",
+    Parameter((size_type)10)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "ConfigurationShooter/Retraction/margin",
+    "Distance added to the penetration depth at each retraction step.",
+    Parameter(1e-3)));
 Problem::declareParameter(ParameterDescription(
     Parameter::BOOL, "ConfigurationShooter/sampleExtraDOF",
     "If false, the value of the random configuration extraDOF are set to 0.",
@@ -1067,6 +1366,35 @@ Problem::declareParameter(ParameterDescription(
     "Names of revolute joints that hold directional wheels separated by "
     "commas.",
     Parameter(std::string(""))));
+Problem::declareParameter(ParameterDescription(
+    Parameter::INT, "SteeringMethod/Carlike/maxWords",
+    "Maximal number of Reeds and Shepp or Dubins words tried by increasing "
+    "length until one is valid according to the problem path validation. "
+    "If 1, only the shortest word is computed.",
+    Parameter((size_type)1)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "SteeringMethod/Carlike/maxWordLengthRatio",
+    "Words longer than the shortest one times this ratio are not tried.",
+    Parameter(3.)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::INT, "ProblemSolver/Experience/NumberRetrieved",
+    "Number of experiences of the experience library tried before "
+    "planning.",
+    Parameter((size_type)3)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::INT, "ProblemSolver/Queries/NumberThreads",
+    "Number of threads among which the graph searches of "
+    "ProblemSolver::solveQueries are distributed. "
+    "If not positive, use the number of threads of the task scheduler of "
+    "the problem.",
+    Parameter((size_type)1)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::BOOL, "PathValidation/Discretized/ArcLength",
+    "Whether discretized path validations sample paths every step of "
+    "length under the distance of the problem instead of every step of "
+    "time. Taken into account when the path validation or the distance is "
+    "initialized.",
+    Parameter(false)));
 HPP_END_PARAMETER_DECLARATION(ProblemSolver)
 }  //   namespace core
 }  // namespace hpp
@@ -37,6 +37,7 @@
 #include <hpp/core/problem-target/goal-configurations.hh>
 #include <hpp/core/problem.hh>
 #include <hpp/core/steering-method/straight.hh>
+#include <hpp/core/task-scheduler.hh>
 #include <hpp/core/weighed-distance.hh>
 #include <hpp/pinocchio/configuration.hh>
 #include <hpp/pinocchio/device.hh>
@@ -89,7 +90,9 @@ ProblemPtr_t Problem::createCopy(const ProblemConstPtr_t& other) {
 
 // ======================================================================
 Problem::Problem(DevicePtr_t robot)
-    : robot_(robot), configValidations_(ConfigValidations::create()) {}
+    : robot_(robot),
+      configValidations_(ConfigValidations::create()),
+      taskScheduler_() {}
 
 // ======================================================================
 
@@ -117,7 +120,8 @@ Problem::Problem()
       pathValidation_(),
       collisionObstacles_(),
       constraints_(),
-      configurationShooter_() {
+      configurationShooter_(),
+      taskScheduler_() {
   assert(false && "This constructor should not be used.");
 }
 
@@ -125,6 +129,13 @@ Problem::~Problem() {}
 
 // ======================================================================
 
+TaskSchedulerPtr_t Problem::taskScheduler() const {
+  if (taskScheduler_) return taskScheduler_;
+  return TaskScheduler::global();
+}
+
+// ======================================================================
+
 void Problem::initConfig(const ConfigurationPtr_t& config) {
   initConf_ = config;
 }
@@ -27,6 +27,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
 // DAMAGE.
 
+#include <algorithm>
 #include <boost/math/constants/constants.hpp>
 #include <boost/serialization/weak_ptr.hpp>
 #include <hpp/core/path-vector.hh>
@@ -46,14 +47,22 @@ namespace {
 using steeringMethod::ConstantCurvature;
 using steeringMethod::ConstantCurvaturePtr_t;
 
-struct Data {
-  Data(const value_type& rho_)
-      : rsLength(std::numeric_limits<value_type>::infinity()), rho(rho_) {}
+struct Word {
+  Word() : rsLength(std::numeric_limits<value_type>::infinity()) {}
   typedef Eigen::Matrix<value_type, 5, 1> Lengths_t;
   std::size_t typeId;
   Lengths_t lengths;
   value_type rsLength;
+  bool operator<(const Word& other) const { return rsLength < other.rsLength; }
+};  // struct Word
+
+struct Data : Word {
+  Data(const value_type& rho_) : rho(rho_), collect(false) {}
   value_type rho;
+  /// If true, every feasible word is stored in words instead of keeping
+  /// only the shortest one.
+  bool collect;
+  std::vector<Word> words;
 };  // struct Data
 
 value_type precision(sqrt(std::numeric_limits<value_type>::epsilon()));
@@ -176,57 +185,65 @@ void setupPath(Data& d, const std::size_t& typeId, double t, double u = 0,
   d.lengths(4) = x;
   d.rsLength = d.rho * d.lengths.lpNorm<1>();
   hppDout(info, "lengths = " << d.lengths.transpose());
+  if (d.collect) d.words.push_back(static_cast<const Word&>(d));
+}
+
+/// Whether a word of length L should replace the shortest word found so
+/// far, of length Lmin. When collecting, all the words are kept.
+inline bool accept(const Data& d, const value_type& Lmin,
+                   const value_type& L) {
+  return d.collect || Lmin > L;
 }
 
 void CSC(Data& d, const vector2_t& xy, const vector2_t& csPhi,
          const value_type& phi) {
   value_type t, u, v, Lmin = d.rsLength, L;
   if (LpSpLp(xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v))) {
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v))) {
     setupPath(d, 14, t, u, v);
     Lmin = L;
   }
   if (LpSpLp(xy.cwiseProduct(oneMP), csPhi.cwiseProduct(onePM), -phi, t, u,
              v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     setupPath(d, 14, -t, -u, -v);
     Lmin = L;
   }
   if (LpSpLp(xy.cwiseProduct(onePM), csPhi.cwiseProduct(onePM), -phi, t, u,
              v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     setupPath(d, 15, t, u, v);
     Lmin = L;
   }
   if (LpSpLp(-xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
   {
     setupPath(d, 15, -t, -u, -v);
     Lmin = L;
   }
   if (LpSpRp(xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v))) {
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v))) {
     setupPath(d, 12, t, u, v);
     Lmin = L;
   }
   if (LpSpRp(xy.cwiseProduct(oneMP), csPhi.cwiseProduct(onePM), -phi, t, u,
              v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     setupPath(d, 12, -t, -u, -v);
     Lmin = L;
   }
   if (LpSpRp(xy.cwiseProduct(onePM), csPhi.cwiseProduct(onePM), -phi, t, u,
              v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     setupPath(d, 13, t, u, v);
     Lmin = L;
   }
   if (LpSpRp(-xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
     setupPath(d, 13, -t, -u, -v);
 }
 // formula 8.3 / 8.4  *** TYPO IN PAPER ***
@@ -250,24 +267,24 @@ void CCC(Data& d, const vector2_t& xy, const vector2_t& csPhi,
          const value_type& phi) {
   value_type t, u, v, Lmin = d.rsLength, L;
   if (LpRmL(xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v))) {
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v))) {
     setupPath(d, 0, t, u, v);
     Lmin = L;
   }
   if (LpRmL(xy.cwiseProduct(oneMP), csPhi.cwiseProduct(onePM), -phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     setupPath(d, 0, -t, -u, -v);
     Lmin = L;
   }
   if (LpRmL(xy.cwiseProduct(onePM), csPhi.cwiseProduct(onePM), -phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     setupPath(d, 1, t, u, v);
     Lmin = L;
   }
   if (LpRmL(-xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
   {
     setupPath(d, 1, -t, -u, -v);
     Lmin = L;
@@ -280,26 +297,26 @@ void CCC(Data& d, const vector2_t& xy, const vector2_t& csPhi,
   // value_type xb = xy(0)*csPhi(0) + xy(1)*csPhi(1), yb = xy(0)*csPhi(1) -
   // xy(1)*csPhi(0);
   if (LpRmL(xyb, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v))) {
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v))) {
     setupPath(d, 0, v, u, t);
     Lmin = L;
   }
   if (LpRmL(xyb.cwiseProduct(oneMP), csPhi.cwiseProduct(onePM), -phi, t, u,
             v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     setupPath(d, 0, -v, -u, -t);
     Lmin = L;
   }
   if (LpRmL(xyb.cwiseProduct(onePM), csPhi.cwiseProduct(onePM), -phi, t, u,
             v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     setupPath(d, 1, v, u, t);
     Lmin = L;
   }
   if (LpRmL(-xyb, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
     setupPath(d, 1, -v, -u, -t);
 }
 // formula 8.7
@@ -344,52 +361,54 @@ void CCCC(Data& d, const vector2_t& xy, const vector2_t& csPhi,
           const value_type& phi) {
   value_type t, u, v, Lmin = d.rsLength, L;
   if (LpRupLumRm(xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v))) {
+      accept(d, Lmin, L = fabs(t) + 2. * fabs(u) + fabs(v))) {
     setupPath(d, 2, t, u, -u, v);
     Lmin = L;
   }
   if (LpRupLumRm(xy.cwiseProduct(oneMP), csPhi.cwiseProduct(onePM), -phi, t, u,
                  v) &&
-      Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip
+      accept(d, Lmin, L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip
   {
     setupPath(d, 2, -t, -u, u, -v);
     Lmin = L;
   }
   if (LpRupLumRm(xy.cwiseProduct(onePM), csPhi.cwiseProduct(onePM), -phi, t, u,
                  v) &&
-      Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // reflect
+      accept(d, Lmin, L = fabs(t) + 2. * fabs(u) + fabs(v)))  // reflect
   {
     setupPath(d, 3, t, u, -u, v);
     Lmin = L;
   }
   if (LpRupLumRm(-xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip + reflect
+      accept(d, Lmin,
+             L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip + reflect
   {
     setupPath(d, 3, -t, -u, u, -v);
     Lmin = L;
   }
 
   if (LpRumLumRp(xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v))) {
+      accept(d, Lmin, L = fabs(t) + 2. * fabs(u) + fabs(v))) {
     setupPath(d, 2, t, u, u, v);
     Lmin = L;
   }
   if (LpRumLumRp(xy.cwiseProduct(oneMP), csPhi.cwiseProduct(onePM), -phi, t, u,
                  v) &&
-      Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip
+      accept(d, Lmin, L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip
   {
     setupPath(d, 2, -t, -u, -u, -v);
     Lmin = L;
   }
   if (LpRumLumRp(xy.cwiseProduct(onePM), csPhi.cwiseProduct(onePM), -phi, t, u,
                  v) &&
-      Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // reflect
+      accept(d, Lmin, L = fabs(t) + 2. * fabs(u) + fabs(v)))  // reflect
   {
     setupPath(d, 3, t, u, u, v);
     Lmin = L;
   }
   if (LpRumLumRp(-xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip + reflect
+      accept(d, Lmin,
+             L = fabs(t) + 2. * fabs(u) + fabs(v)))  // timeflip + reflect
     setupPath(d, 3, -t, -u, -u, -v);
 }
 // formula 8.9
@@ -433,52 +452,52 @@ void CCSC(Data& d, const vector2_t& xy, const vector2_t& csPhi,
           const value_type& phi) {
   value_type t, u, v, Lmin = d.rsLength - .5 * pi, L;
   if (LpRmSmLm(xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v))) {
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v))) {
     setupPath(d, 4, t, -.5 * pi, u, v);
     Lmin = L;
   }
   if (LpRmSmLm(xy.cwiseProduct(oneMP), csPhi.cwiseProduct(onePM), -phi, t, u,
                v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     setupPath(d, 4, -t, .5 * pi, -u, -v);
     Lmin = L;
   }
   if (LpRmSmLm(xy.cwiseProduct(onePM), csPhi.cwiseProduct(onePM), -phi, t, u,
                v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     setupPath(d, 5, t, -.5 * pi, u, v);
     Lmin = L;
   }
   if (LpRmSmLm(-xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
   {
     setupPath(d, 5, -t, .5 * pi, -u, -v);
     Lmin = L;
   }
 
   if (LpRmSmRm(xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v))) {
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v))) {
     setupPath(d, 8, t, -.5 * pi, u, v);
     Lmin = L;
   }
   if (LpRmSmRm(xy.cwiseProduct(oneMP), csPhi.cwiseProduct(onePM), -phi, t, u,
                v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     setupPath(d, 8, -t, .5 * pi, -u, -v);
     Lmin = L;
   }
   if (LpRmSmRm(xy.cwiseProduct(onePM), csPhi.cwiseProduct(onePM), -phi, t, u,
                v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     setupPath(d, 9, t, -.5 * pi, u, v);
     Lmin = L;
   }
   if (LpRmSmRm(-xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
   {
     setupPath(d, 9, -t, .5 * pi, -u, -v);
     Lmin = L;
@@ -493,52 +512,52 @@ void CCSC(Data& d, const vector2_t& xy, const vector2_t& csPhi,
   // xy(1)*csPhi(0); std::cout << xy(0)*csPhi(0) + xy(1)*csPhi(1) << " " <<
   // xy(0)*csPhi(1) - xy(1)*csPhi(0) << std::endl;
   if (LpRmSmLm(xyb, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v))) {
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v))) {
     setupPath(d, 6, v, u, -.5 * pi, t);
     Lmin = L;
   }
   if (LpRmSmLm(xyb.cwiseProduct(oneMP), csPhi.cwiseProduct(onePM), -phi, t, u,
                v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     setupPath(d, 6, -v, -u, .5 * pi, -t);
     Lmin = L;
   }
   if (LpRmSmLm(xyb.cwiseProduct(onePM), csPhi.cwiseProduct(onePM), -phi, t, u,
                v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     setupPath(d, 7, v, u, -.5 * pi, t);
     Lmin = L;
   }
   if (LpRmSmLm(-xyb, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
   {
     setupPath(d, 7, -v, -u, .5 * pi, -t);
     Lmin = L;
   }
 
   if (LpRmSmRm(xyb, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v))) {
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v))) {
     setupPath(d, 10, v, u, -.5 * pi, t);
     Lmin = L;
   }
   if (LpRmSmRm(xyb.cwiseProduct(oneMP), csPhi.cwiseProduct(onePM), -phi, t, u,
                v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     setupPath(d, 10, -v, -u, .5 * pi, -t);
     Lmin = L;
   }
   if (LpRmSmRm(xyb.cwiseProduct(onePM), csPhi.cwiseProduct(onePM), -phi, t, u,
                v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     setupPath(d, 11, v, u, -.5 * pi, t);
     Lmin = L;
   }
   if (LpRmSmRm(-xyb, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
     setupPath(d, 11, -v, -u, .5 * pi, -t);
 }
 // formula 8.11 *** TYPO IN PAPER ***
@@ -566,26 +585,26 @@ void CCSCC(Data& d, const vector2_t& xy, const vector2_t& csPhi,
            const value_type& phi) {
   value_type t, u, v, Lmin = d.rsLength - pi, L;
   if (LpRmSLmRp(xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v))) {
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v))) {
     setupPath(d, 16, t, -.5 * pi, u, -.5 * pi, v);
     Lmin = L;
   }
   if (LpRmSLmRp(xy.cwiseProduct(oneMP), csPhi.cwiseProduct(onePM), -phi, t, u,
                 v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip
   {
     setupPath(d, 16, -t, .5 * pi, -u, .5 * pi, -v);
     Lmin = L;
   }
   if (LpRmSLmRp(xy.cwiseProduct(onePM), csPhi.cwiseProduct(onePM), -phi, t, u,
                 v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // reflect
   {
     setupPath(d, 17, t, -.5 * pi, u, -.5 * pi, v);
     Lmin = L;
   }
   if (LpRmSLmRp(-xy, csPhi, phi, t, u, v) &&
-      Lmin > (L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
+      accept(d, Lmin, L = fabs(t) + fabs(u) + fabs(v)))  // timeflip + reflect
     setupPath(d, 17, -t, .5 * pi, -u, .5 * pi, -v);
 }
 
@@ -598,6 +617,92 @@ inline value_type saturate(const value_type& v, const JointPtr_t& j,
   return std::min(j->upperBound(i), std::max(j->lowerBound(i), v));
 }
 
+/// Non zero segments of a word as curvature types and signed lengths
+std::vector<std::pair<SegmentType, value_type> > segments(const Word& w) {
+  std::vector<std::pair<SegmentType, value_type> > res;
+  for (unsigned int i = 0; i < 5; ++i) {
+    if (fabs(w.lengths[i]) > precision) {
+      if (types[w.typeId][i] == RS_NOP) break;
+      res.push_back(std::make_pair(types[w.typeId][i], w.lengths[i]));
+    }
+  }
+  return res;
+}
+
+/// Whether two words describe the same motion
+bool sameMotion(const Word& w1, const Word& w2) {
+  std::vector<std::pair<SegmentType, value_type> > s1(segments(w1)),
+      s2(segments(w2));
+  if (s1.size() != s2.size()) return false;
+  for (std::size_t i = 0; i < s1.size(); ++i)
+    if (s1[i].first != s2[i].first ||
+        fabs(s1[i].second - s2[i].second) > precision)
+      return false;
+  return true;
+}
+
+/// Build the sequence of constant curvature paths of a word
+PathVectorPtr_t buildPath(const Word& w, const value_type& rho,
+                          const DevicePtr_t& device, ConfigurationIn_t init,
+                          ConfigurationIn_t end, value_type extraLength,
+                          size_type xyId, size_type rzId, const JointPtr_t& rz,
+                          const std::vector<JointPtr_t>& wheels,
+                          const ConstraintSetPtr_t& constraints) {
+  PathVectorPtr_t res =
+      PathVector::create(device->configSize(), device->numberDof());
+  Configuration_t qInit(init), qEnd(device->configSize());
+  value_type L(w.rsLength), s(0.);
+  for (const std::pair<SegmentType, value_type>& segment : segments(w)) {
+    value_type l = rho * fabs(segment.second);
+    s += l;
+    value_type curvature;
+    switch (segment.first) {
+      case RS_LEFT:
+        curvature = 1. / rho;
+        break;
+      case RS_RIGHT:
+        curvature = -1. / rho;
+        break;
+      case RS_STRAIGHT:
+        curvature = 0;
+        break;
+      case RS_NOP:
+      default:
+        abort();
+    }
+    pinocchio::interpolate(device, init, end, s / L, qEnd);
+    ConstantCurvaturePtr_t path(ConstantCurvature::create(
+        device, qInit, qEnd, rho * segment.second, l * (1 + extraLength / L),
+        curvature, xyId, rzId, rz, wheels, constraints));
+    res->appendPath(path);
+    qInit = path->end();
+  }
+  assert(res->numberPaths() > 0);
+  return res;
+}
+
+/// Express the end configuration in the frame of the initial one, with
+/// unit turning radius.
+/// \return false if both configurations are the same for the car.
+bool normalise(ConfigurationIn_t init, ConfigurationIn_t end,
+               const value_type& rho, size_type xyId, size_type rzId,
+               vector2_t& XY, vector2_t& csPhi, value_type& phi) {
+  XY = rotate(end.segment<2>(xyId) - init.segment<2>(xyId),
+              init.segment<2>(rzId));
+  XY /= rho;
+  csPhi = rotate(end.segment<2>(rzId), init.segment<2>(rzId));
+  phi = atan2(csPhi(1), csPhi(0));
+  return XY.squaredNorm() + phi * phi >= 1e-8;
+}
+
+void computeWords(Data& d, const vector2_t& XY, const vector2_t& csPhi,
+                  const value_type& phi) {
+  CSC(d, XY, csPhi, phi);
+  CCC(d, XY, csPhi, phi);
+  CCCC(d, XY, csPhi, phi);
+  CCSC(d, XY, csPhi, phi);
+  CCSCC(d, XY, csPhi, phi);
+}
 }  // namespace
 namespace steeringMethod {
 PathVectorPtr_t reedsSheppPathOrDistance(
@@ -608,76 +713,72 @@ PathVectorPtr_t reedsSheppPathOrDistance(
   Data d(rho);
   PathVectorPtr_t res;
   distance = 0;
-  if (!computeDistance)
-    res = PathVector::create(device->configSize(), device->numberDof());
-  // Find rank of translation and rotation in velocity vectors
   // Hypothesis: degrees of freedom all belong to a planar joint or
   // xyId_ belong to a tranlation joint, rzId belongs to a SO2 joint.
-  JointPtr_t xy(device->getJointAtConfigRank(xyId));
   JointPtr_t rz(device->getJointAtConfigRank(rzId));
-  // rotate
-  vector2_t XY = rotate(end.segment<2>(xyId) - init.segment<2>(xyId),
-                        init.segment<2>(rzId));
-  XY /= d.rho;
-  vector2_t csPhi = rotate(end.segment<2>(rzId), init.segment<2>(rzId));
-  value_type phi = atan2(csPhi(1), csPhi(0));
+  vector2_t XY, csPhi;
+  value_type phi;
 
-  Configuration_t qInit(init), qEnd(device->configSize());
-
-  if (XY.squaredNorm() + phi * phi < 1e-8) {
+  if (!normalise(init, end, d.rho, xyId, rzId, XY, csPhi, phi)) {
     if (computeDistance) {
       distance = extraLength;
     } else {
+      res = PathVector::create(device->configSize(), device->numberDof());
       ConstantCurvaturePtr_t segment(
-          ConstantCurvature::create(device, qInit, end, 0, extraLength, 0, xyId,
+          ConstantCurvature::create(device, init, end, 0, extraLength, 0, xyId,
                                     rzId, rz, wheels, ConstraintSetPtr_t()));
       res->appendPath(segment);
     }
     return res;
   }
-  CSC(d, XY, csPhi, phi);
-  CCC(d, XY, csPhi, phi);
-  CCCC(d, XY, csPhi, phi);
-  CCSC(d, XY, csPhi, phi);
-  CCSCC(d, XY, csPhi, phi);
-  // build path vector
-  value_type L(d.rsLength), s(0.);
-  for (unsigned int i = 0; i < 5; ++i) {
-    if (fabs(d.lengths[i]) > precision) {
-      value_type l = d.rho * fabs(d.lengths[i]);
-      s += l;
-      if (types[d.typeId][i] == RS_NOP) break;
-      value_type curvature;
-      switch (types[d.typeId][i]) {
-        case RS_LEFT:
-          curvature = 1. / d.rho;
-          break;
-        case RS_RIGHT:
-          curvature = -1. / d.rho;
-          break;
-        case RS_STRAIGHT:
-          curvature = 0;
-          break;
-        case RS_NOP:
-        default:
-          abort();
-      }
-      pinocchio::interpolate(device, init, end, s / L, qEnd);
-      if (!computeDistance) {
-        ConstantCurvaturePtr_t segment(
-            ConstantCurvature::create(device, qInit, qEnd, d.rho * d.lengths[i],
-                                      l * (1 + extraLength / L), curvature,
-                                      xyId, rzId, rz, wheels, constraints));
-        res->appendPath(segment);
-        qInit = segment->end();
-      }
-    }
-  }
+  computeWords(d, XY, csPhi, phi);
   if (computeDistance) {
     distance = d.rsLength + extraLength;
-  } else {
-    assert(res->numberPaths() > 0);
+    return res;
+  }
+  return buildPath(d, d.rho, device, init, end, extraLength, xyId, rzId, rz,
+                   wheels, constraints);
+}
+
+std::vector<PathVectorPtr_t> reedsSheppPaths(
+    const DevicePtr_t& device, ConfigurationIn_t init, ConfigurationIn_t end,
+    value_type extraLength, value_type rho, size_type xyId, size_type rzId,
+    const std::vector<JointPtr_t> wheels, ConstraintSetPtr_t constraints,
+    size_type maxNumber, value_type maxLengthRatio) {
+  std::vector<PathVectorPtr_t> res;
+  if (maxNumber <= 0) return res;
+  Data d(rho);
+  d.collect = true;
+  JointPtr_t rz(device->getJointAtConfigRank(rzId));
+  vector2_t XY, csPhi;
+  value_type phi;
+  if (!normalise(init, end, d.rho, xyId, rzId, XY, csPhi, phi)) {
+    value_type distance;
+    res.push_back(reedsSheppPathOrDistance(device, init, end, extraLength, rho,
+                                           xyId, rzId, wheels, constraints,
+                                           false, distance));
+    return res;
+  }
+  computeWords(d, XY, csPhi, phi);
+  assert(!d.words.empty());
+  std::stable_sort(d.words.begin(), d.words.end());
+  // Different formulas may yield the same motion.
+  std::vector<Word> words;
+  for (const Word& w : d.words) {
+    if ((size_type)words.size() >= maxNumber ||
+        w.rsLength > maxLengthRatio * d.words.front().rsLength)
+      break;
+    bool duplicate(false);
+    for (const Word& other : words)
+      if (sameMotion(w, other)) {
+        duplicate = true;
+        break;
+      }
+    if (!duplicate) words.push_back(w);
   }
+  for (const Word& w : words)
+    res.push_back(buildPath(w, d.rho, device, init, end, extraLength, xyId,
+                            rzId, rz, wheels, constraints));
   return res;
 }
 }  // namespace steeringMethod
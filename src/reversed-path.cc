@@ -0,0 +1,49 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/weak_ptr.hpp>
+#include <hpp/core/reversed-path.hh>
+#include <hpp/util/serialization.hh>
+
+namespace hpp {
+namespace core {
+template <class Archive>
+void ReversedPath::serialize(Archive& ar, const unsigned int version) {
+  using namespace boost::serialization;
+  (void)version;
+  ar& make_nvp("base", base_object<Path>(*this));
+  ar& BOOST_SERIALIZATION_NVP(original_);
+  ar& BOOST_SERIALIZATION_NVP(originalRange_);
+  ar& BOOST_SERIALIZATION_NVP(weak_);
+}
+
+HPP_SERIALIZATION_IMPLEMENT(ReversedPath);
+}  // namespace core
+}  // namespace hpp
+
+BOOST_CLASS_EXPORT(hpp::core::ReversedPath)
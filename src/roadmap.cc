@@ -35,8 +35,11 @@
 #include <hpp/core/path-vector.hh>
 #include <hpp/core/path.hh>
 #include <hpp/core/roadmap.hh>
+#include <hpp/core/trace.hh>
 #include <hpp/pinocchio/configuration.hh>
 #include <hpp/util/debug.hh>
+#include <map>
+#include <set>
 #include <stdexcept>
 
 namespace hpp {
@@ -112,6 +115,7 @@ NodePtr_t Roadmap::addNode(const ConfigurationPtr_t& configuration) {
   NodePtr_t node = createNode(configuration);
   hppDout(info, "Added node: " << displayConfig(*configuration));
   push_node(node);
+  HPP_CORE_TRACE(ADD_NODE, true, 0);
   // Node constructor creates a new connected component. This new
   // connected component needs to be added in the roadmap and the
   // new node needs to be registered in the connected component.
@@ -134,6 +138,7 @@ NodePtr_t Roadmap::addNode(const ConfigurationPtr_t& configuration,
   node->connectedComponent(connectedComponent);
   hppDout(info, "Added node: " << displayConfig(*configuration));
   push_node(node);
+  HPP_CORE_TRACE(ADD_NODE, true, 0);
   // The new node needs to be registered in the connected
   // component.
   connectedComponent->addNode(node);
@@ -190,6 +195,42 @@ void Roadmap::merge(const RoadmapPtr_t& other) {
   }
 }
 
+void Roadmap::removeNodes(const NodeVector_t& nodes) {
+  std::set<NodePtr_t> removed(nodes.begin(), nodes.end());
+  if (removed.empty()) return;
+  // Save the nodes and edges that are kept before clearing the roadmap.
+  std::vector<ConfigurationPtr_t> configs;
+  std::map<NodePtr_t, std::size_t> rank;
+  for (const NodePtr_t& node : nodes_) {
+    if (removed.count(node)) continue;
+    rank[node] = configs.size();
+    configs.push_back(node->configuration());
+  }
+  std::vector<std::pair<std::size_t, std::size_t> > ends;
+  std::vector<PathPtr_t> paths;
+  for (const EdgePtr_t& edge : edges_) {
+    if (removed.count(edge->from()) || removed.count(edge->to())) continue;
+    ends.push_back(std::make_pair(rank[edge->from()], rank[edge->to()]));
+    paths.push_back(edge->path());
+  }
+  ConfigurationPtr_t init;
+  if (initNode_ && !removed.count(initNode_))
+    init = initNode_->configuration();
+  std::vector<ConfigurationPtr_t> goals;
+  for (const NodePtr_t& goal : goalNodes_)
+    if (!removed.count(goal)) goals.push_back(goal->configuration());
+
+  clear();
+  NodeVector_t kept;
+  kept.reserve(configs.size());
+  for (const ConfigurationPtr_t& config : configs)
+    kept.push_back(addNode(config));
+  for (std::size_t i = 0; i < paths.size(); ++i)
+    addEdge(kept[ends[i].first], kept[ends[i].second], paths[i]);
+  if (init) initNode(init);
+  for (const ConfigurationPtr_t& goal : goals) addGoalNode(goal);
+}
+
 void Roadmap::insertPathVector(const PathVectorPtr_t& path, bool backAndForth) {
   if (path->constraints()) {
     throw std::logic_error(
@@ -225,6 +266,7 @@ NodePtr_t Roadmap::nearestNode(const Configuration_t& configuration,
       closest = node;
     }
   }
+  HPP_CORE_TRACE(NEAREST, closest, minDistance);
   return closest;
 }
 
@@ -236,6 +278,7 @@ NodePtr_t Roadmap::nearestNode(
   assert(connectedComponent->nodes().size() != 0);
   NodePtr_t closest = nearestNeighbor_->search(
       configuration, connectedComponent, minDistance, reverse);
+  HPP_CORE_TRACE(NEAREST, closest, minDistance);
   return closest;
 }
 
@@ -317,6 +360,7 @@ void Roadmap::merge(const ConnectedComponentPtr_t& cc1,
 
 void Roadmap::impl_addEdge(const EdgePtr_t& edge) {
   edges_.push_back(edge);
+  HPP_CORE_TRACE(ADD_EDGE, true, edge->path()->length());
 
   ConnectedComponentPtr_t cc1 = edge->from()->connectedComponent();
   ConnectedComponentPtr_t cc2 = edge->to()->connectedComponent();
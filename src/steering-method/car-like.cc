@@ -27,6 +27,7 @@
 // DAMAGE.
 
 #include <boost/algorithm/string.hpp>
+#include <hpp/core/path-validation.hh>
 #include <hpp/core/problem.hh>
 #include <hpp/core/steering-method/car-like.hh>
 #include <hpp/pinocchio/device.hh>
@@ -50,6 +51,10 @@ CarLike::CarLike(const ProblemConstPtr_t& problem)
   wheels_ = getWheelsFromParameter(problem, rz_);
   turningRadius(problem->getParameter("SteeringMethod/Carlike/turningRadius")
                     .floatValue());
+  maxWords(problem->getParameter("SteeringMethod/Carlike/maxWords").intValue());
+  maxWordLengthRatio(
+      problem->getParameter("SteeringMethod/Carlike/maxWordLengthRatio")
+          .floatValue());
 }
 
 CarLike::CarLike(const ProblemConstPtr_t& problem,
@@ -68,6 +73,10 @@ CarLike::CarLike(const ProblemConstPtr_t& problem,
   } else {
     rzId_ = rz_->rankInConfiguration();
   }
+  maxWords(problem->getParameter("SteeringMethod/Carlike/maxWords").intValue());
+  maxWordLengthRatio(
+      problem->getParameter("SteeringMethod/Carlike/maxWordLengthRatio")
+          .floatValue());
 }
 
 /// Copy constructor
@@ -78,7 +87,9 @@ CarLike::CarLike(const CarLike& other)
       xy_(other.xy_),
       rz_(other.rz_),
       xyId_(other.xyId_),
-      rzId_(other.rzId_) {}
+      rzId_(other.rzId_),
+      maxWords_(other.maxWords_),
+      maxWordLengthRatio_(other.maxWordLengthRatio_) {}
 
 void CarLike::turningRadius(const value_type& rho) {
   if (rho <= 0)
@@ -86,6 +97,37 @@ void CarLike::turningRadius(const value_type& rho) {
   rho_ = rho;
 }
 
+void CarLike::maxWords(const size_type& n) {
+  if (n <= 0)
+    throw std::invalid_argument("Number of words must be strictly positive.");
+  maxWords_ = n;
+}
+
+void CarLike::maxWordLengthRatio(const value_type& ratio) {
+  if (!(ratio >= 1))
+    throw std::invalid_argument("Word length ratio must be at least 1.");
+  maxWordLengthRatio_ = ratio;
+}
+
+PathPtr_t CarLike::firstValid(const std::vector<PathPtr_t>& candidates) const {
+  if (candidates.empty()) return PathPtr_t();
+  PathValidationPtr_t validation(problem()->pathValidation());
+  if (candidates.size() == 1 || !validation) return candidates.front();
+  PathPtr_t validPart, best(candidates.front());
+  PathValidationReportPtr_t report;
+  value_type bestLength(-1);
+  for (const PathPtr_t& path : candidates) {
+    if (validation->validate(path, false, validPart, report)) return path;
+    // The caller keeps the valid part of the returned path.
+    if (validPart && validPart->length() > bestLength) {
+      best = path;
+      bestLength = validPart->length();
+    }
+  }
+  hppDout(info, "None of " << candidates.size() << " words is valid.");
+  return best;
+}
+
 std::vector<JointPtr_t> getWheelsFromParameter(const ProblemConstPtr_t& problem,
                                                const JointPtr_t& rz) {
   std::vector<JointPtr_t> wheels;
@@ -0,0 +1,292 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <Eigen/SVD>
+#include <hpp/constraints/generic-transformation.hh>
+#include <hpp/core/config-projector.hh>
+#include <hpp/core/configuration-layout.hh>
+#include <hpp/core/distance.hh>
+#include <hpp/core/interpolated-path.hh>
+#include <hpp/core/problem.hh>
+#include <hpp/core/steering-method/cartesian.hh>
+#include <hpp/pinocchio/configuration.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/joint.hh>
+#include <hpp/pinocchio/liegroup-element.hh>
+#include <limits>
+
+namespace hpp {
+namespace core {
+namespace steeringMethod {
+namespace {
+// Maximal number of Newton iterations for each waypoint.
+const size_type maxIterations = 20;
+// Initial and minimal step along the line, as a ratio of its length.
+const value_type initialStep = .125;
+const value_type minStep = 1e-4;
+
+// Incremental inverse kinematics of the pose of a frame
+struct Tracker {
+  Tracker(const DevicePtr_t& robot, const DifferentiableFunctionPtr_t& pose,
+          const value_type& errorThreshold,
+          const value_type& singularityThreshold)
+      : robot(robot),
+        layout(ConfigurationLayout::get(robot)),
+        pose(pose),
+        errorThreshold(errorThreshold),
+        singularityThreshold(singularityThreshold),
+        y(pose->outputSpace()),
+        J(pose->outputDerivativeSize(), pose->inputDerivativeSize()),
+        hasJacobian(false),
+        dq(pose->inputDerivativeSize()),
+        v(pose->inputDerivativeSize()) {}
+
+  // Compute the pseudo-inverse of the Jacobian at q and the projector on
+  // its kernel.
+  bool updateJacobian(ConfigurationIn_t q) {
+    pose->jacobian(J, q);
+    Eigen::JacobiSVD<matrix_t> svd(J,
+                                   Eigen::ComputeThinU | Eigen::ComputeThinV);
+    const vector_t& sv(svd.singularValues());
+    if (sv.size() < J.rows() || sv[sv.size() - 1] < singularityThreshold) {
+      hppDout(info, "singular Jacobian: " << sv.transpose());
+      return false;
+    }
+    Jinv.noalias() = svd.matrixV() * sv.cwiseInverse().asDiagonal() *
+                     svd.matrixU().transpose();
+    kernel = -Jinv * J;
+    kernel.diagonal().array() += 1;
+    hasJacobian = true;
+    return true;
+  }
+
+  // Move q until the frame reaches the target. The other degrees of freedom
+  // are pulled toward reference.
+  bool solve(const LiegroupElement& target, ConfigurationIn_t reference,
+             ConfigurationOut_t q) {
+    value_type previous = std::numeric_limits<value_type>::infinity();
+    for (size_type i = 0; i < maxIterations; ++i) {
+      pose->value(y, q);
+      e = y - target;
+      const value_type error = e.norm();
+      if (error < errorThreshold) return true;
+      // The pseudo-inverse of the previous iteration or waypoint is kept
+      // while the error decreases fast enough.
+      if (!hasJacobian || error > .5 * previous) {
+        if (!updateJacobian(q)) return false;
+      }
+      previous = error;
+      layout->difference(reference, q, v);
+      dq.noalias() = kernel * v;
+      dq.noalias() -= Jinv * e;
+      layout->integrate(q, dq, q);
+      pinocchio::saturate(robot, q);
+    }
+    return false;
+  }
+
+  DevicePtr_t robot;
+  ConfigurationLayoutPtr_t layout;
+  DifferentiableFunctionPtr_t pose;
+  value_type errorThreshold, singularityThreshold;
+  LiegroupElement y;
+  matrix_t J, Jinv, kernel;
+  bool hasJacobian;
+  vector_t e, dq, v;
+};  // struct Tracker
+}  // namespace
+
+CartesianPtr_t Cartesian::create(const ProblemConstPtr_t& problem) {
+  const std::string name(
+      problem->getParameter("SteeringMethod/Cartesian/Joint").stringValue());
+  if (name.empty())
+    throw std::invalid_argument(
+        "Parameter SteeringMethod/Cartesian/Joint is not set.");
+  return create(problem, problem->robot()->getJointByName(name),
+                Transform3f::Identity());
+}
+
+CartesianPtr_t Cartesian::create(const ProblemConstPtr_t& problem,
+                                 const JointPtr_t& joint,
+                                 const Transform3f& frameInJoint) {
+  Cartesian* ptr = new Cartesian(problem, joint, frameInJoint);
+  CartesianPtr_t shPtr(ptr);
+  ptr->init(shPtr);
+  return shPtr;
+}
+
+CartesianPtr_t Cartesian::createCopy(const CartesianPtr_t& other) {
+  Cartesian* ptr = new Cartesian(*other);
+  CartesianPtr_t shPtr(ptr);
+  ptr->init(shPtr);
+  return shPtr;
+}
+
+Cartesian::Cartesian(const ProblemConstPtr_t& problem, const JointPtr_t& joint,
+                     const Transform3f& frameInJoint)
+    : SteeringMethod(problem),
+      errorThreshold_(problem->getParameter("SteeringMethod/Cartesian/"
+                                            "ErrorThreshold")
+                          .floatValue()),
+      maxJointStep_(problem->getParameter("SteeringMethod/Cartesian/"
+                                          "MaxJointStep")
+                        .floatValue()),
+      singularityThreshold_(problem->getParameter("SteeringMethod/Cartesian/"
+                                                  "SingularityThreshold")
+                                .floatValue()),
+      weak_() {
+  frame(joint, frameInJoint);
+}
+
+Cartesian::Cartesian(const Cartesian& other)
+    : SteeringMethod(other),
+      joint_(other.joint_),
+      frameInJoint_(other.frameInJoint_),
+      pose_(other.pose_),
+      errorThreshold_(other.errorThreshold_),
+      maxJointStep_(other.maxJointStep_),
+      singularityThreshold_(other.singularityThreshold_),
+      weak_() {}
+
+void Cartesian::frame(const JointPtr_t& joint,
+                      const Transform3f& frameInJoint) {
+  if (!joint) throw std::invalid_argument("Cartesian: the joint is null.");
+  joint_ = joint;
+  frameInJoint_ = frameInJoint;
+  pose_ = constraints::Transformation::create(
+      "pose of " + joint->name(), problem()->robot(), joint, frameInJoint,
+      Transform3f::Identity());
+}
+
+PathPtr_t Cartesian::moveTo(ConfigurationIn_t q1,
+                            const Transform3f& pose) const {
+  vector_t target(7);
+  target.head<3>() = pose.translation();
+  target.tail<4>() = Eigen::Quaternion<value_type>(pose.rotation()).coeffs();
+  return track(q1, target, Configuration_t());
+}
+
+PathPtr_t Cartesian::impl_compute(ConfigurationIn_t q1,
+                                  ConfigurationIn_t q2) const {
+  LiegroupElement y2(pose_->outputSpace());
+  pose_->value(y2, q2);
+  return track(q1, y2.vector(), q2);
+}
+
+PathPtr_t Cartesian::track(ConfigurationIn_t q1, vectorIn_t target,
+                           ConfigurationIn_t q2) const {
+  DevicePtr_t robot(problem()->robot());
+  ConfigurationLayoutPtr_t layout(ConfigurationLayout::get(robot));
+  Tracker tracker(robot, pose_, errorThreshold_, singularityThreshold_);
+  LiegroupElement y1(pose_->outputSpace()),
+      y2(vector_t(target), pose_->outputSpace());
+  pose_->value(y1, q1);
+  const vector_t line(y2 - y1);
+
+  std::vector<Configuration_t> waypoints(1, q1);
+  Configuration_t q(q1), reference(q1);
+  vector_t v(robot->numberDof());
+  value_type s = 0, ds = initialStep;
+  while (s < 1) {
+    const value_type s1 = std::min(s + ds, value_type(1));
+    q = waypoints.back();
+    if (q2.size() > 0) layout->interpolate(q1, q2, s1, reference);
+    bool success = tracker.solve(y1 + s1 * line, reference, q);
+    if (success) {
+      layout->difference(q, waypoints.back(), v);
+      success = v.norm() <= maxJointStep_;
+    }
+    if (success) {
+      waypoints.push_back(q);
+      s = s1;
+      ds *= 2;
+    } else {
+      // The pseudo-inverse was computed at a rejected configuration.
+      tracker.hasJacobian = false;
+      ds *= .5;
+      if (ds < minStep) {
+        hppDout(info, "failed to track the line at s = " << s);
+        return PathPtr_t();
+      }
+    }
+  }
+  if (q2.size() > 0) {
+    // Redundant robots may end in another configuration with the same
+    // pose of the frame.
+    layout->difference(q2, waypoints.back(), v);
+    if (v.norm() > maxJointStep_) {
+      hppDout(info, "the inverse kinematics did not reach q2.");
+      return PathPtr_t();
+    }
+    waypoints.back() = q2;
+  }
+
+  ConstraintSetPtr_t c;
+  if (constraints() && constraints()->configProjector()) {
+    c = HPP_STATIC_PTR_CAST(ConstraintSet, constraints()->copy());
+    c->configProjector()->rightHandSideFromConfig(q1);
+  } else {
+    c = constraints();
+  }
+  const Distance& distance(*problem()->distance());
+  std::vector<value_type> times(waypoints.size(), 0);
+  for (std::size_t i = 1; i < waypoints.size(); ++i)
+    times[i] = times[i - 1] + distance(waypoints[i - 1], waypoints[i]);
+  InterpolatedPathPtr_t path(InterpolatedPath::create(
+      robot, waypoints.front(), waypoints.back(),
+      interval_t(0, times.back()), c));
+  for (std::size_t i = 1; i + 1 < waypoints.size(); ++i)
+    path->insert(times[i], waypoints[i]);
+  return path;
+}
+
+// ----------- Declare parameters ------------------------------------- //
+
+HPP_START_PARAMETER_DECLARATION(Cartesian)
+Problem::declareParameter(ParameterDescription(
+    Parameter::STRING, "SteeringMethod/Cartesian/Joint",
+    "Name of the joint that holds the frame moved by the Cartesian steering "
+    "method.",
+    Parameter(std::string(""))));
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "SteeringMethod/Cartesian/ErrorThreshold",
+    "Error on the pose of the frame at the waypoints of Cartesian paths.",
+    Parameter(1e-4)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "SteeringMethod/Cartesian/MaxJointStep",
+    "Maximal norm of the difference between consecutive waypoints of "
+    "Cartesian paths.",
+    Parameter(0.05)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::FLOAT, "SteeringMethod/Cartesian/SingularityThreshold",
+    "Minimal singular value of the Jacobian of the pose of the frame along "
+    "Cartesian paths.",
+    Parameter(1e-3)));
+HPP_END_PARAMETER_DECLARATION(Cartesian)
+}  // namespace steeringMethod
+}  // namespace core
+}  // namespace hpp
@@ -50,6 +50,12 @@ PathPtr_t Dubins::impl_compute(ConfigurationIn_t q1,
   // The length corresponding to the non RS DoF
   DistancePtr_t d(problem()->distance());
   value_type extraL = (*d)(q1, qEnd);
+  if (maxWords_ > 1) {
+    std::vector<DubinsPathPtr_t> paths(DubinsPath::createCandidates(
+        device_.lock(), q1, q2, extraL, rho_, xyId_, rzId_, wheels_,
+        constraints(), maxWords_, maxWordLengthRatio_));
+    return firstValid(std::vector<PathPtr_t>(paths.begin(), paths.end()));
+  }
   DubinsPathPtr_t path =
       DubinsPath::create(device_.lock(), q1, q2, extraL, rho_, xyId_, rzId_,
                          wheels_, constraints());
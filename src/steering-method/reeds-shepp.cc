@@ -54,6 +54,12 @@ PathPtr_t ReedsShepp::impl_compute(ConfigurationIn_t q1,
   // The length corresponding to the non RS DoF
   value_type extraL = (*weighedDistance_)(q1, qEnd);
 
+  if (maxWords_ > 1) {
+    std::vector<PathVectorPtr_t> paths(reedsSheppPaths(
+        device_.lock(), q1, q2, extraL, rho_, xyId_, rzId_, wheels_,
+        constraints(), maxWords_, maxWordLengthRatio_));
+    return firstValid(std::vector<PathPtr_t>(paths.begin(), paths.end()));
+  }
   value_type distance;
   PathVectorPtr_t path(
       reedsSheppPathOrDistance(device_.lock(), q1, q2, extraL, rho_, xyId_,
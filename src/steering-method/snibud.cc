@@ -50,6 +50,15 @@ PathPtr_t Snibud::impl_compute(ConfigurationIn_t q1,
   // The length corresponding to the non RS DoF
   DistancePtr_t d(problem()->distance());
   value_type extraL = (*d)(q1, qEnd);
+  if (maxWords_ > 1) {
+    std::vector<DubinsPathPtr_t> paths(DubinsPath::createCandidates(
+        device_.lock(), q2, q1, extraL, rho_, xyId_, rzId_, wheels_,
+        constraints(), maxWords_, maxWordLengthRatio_));
+    std::vector<PathPtr_t> reversed;
+    for (const DubinsPathPtr_t& path : paths)
+      reversed.push_back(path->reverse());
+    return firstValid(reversed);
+  }
   DubinsPathPtr_t path =
       DubinsPath::create(device_.lock(), q2, q1, extraL, rho_, xyId_, rzId_,
                          wheels_, constraints());
@@ -0,0 +1,217 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <algorithm>
+#include <hpp/core/task-scheduler.hh>
+
+namespace hpp {
+namespace core {
+namespace {
+/// Scheduler and index of the worker running the current thread
+thread_local const TaskScheduler* currentScheduler = nullptr;
+thread_local std::size_t currentIndex = 0;
+
+std::mutex globalMutex;
+TaskSchedulerPtr_t globalScheduler;
+}  // namespace
+
+TaskSchedulerPtr_t TaskScheduler::create(std::size_t nbThreads) {
+  if (nbThreads == 0)
+    nbThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+  return TaskSchedulerPtr_t(new TaskScheduler(nbThreads));
+}
+
+TaskSchedulerPtr_t TaskScheduler::global() {
+  std::lock_guard<std::mutex> lock(globalMutex);
+  if (!globalScheduler) globalScheduler = create();
+  return globalScheduler;
+}
+
+void TaskScheduler::global(const TaskSchedulerPtr_t& scheduler) {
+  std::lock_guard<std::mutex> lock(globalMutex);
+  globalScheduler = scheduler;
+}
+
+TaskScheduler::TaskScheduler(std::size_t nbThreads)
+    : nbPending_(0), stop_(false) {
+  for (std::size_t i = 0; i < nbThreads; ++i)
+    workers_.emplace_back(new Worker);
+  for (std::size_t i = 0; i < nbThreads; ++i)
+    threads_.emplace_back(&TaskScheduler::work, this, i);
+}
+
+TaskScheduler::~TaskScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wakeUp_.notify_all();
+  for (std::thread& t : threads_) t.join();
+}
+
+std::size_t TaskScheduler::workerIndex() const {
+  return currentScheduler == this ? currentIndex : numberThreads();
+}
+
+void TaskScheduler::submit(Task_t&& task) {
+  // The number of pending tasks is updated with the lock of the queue so
+  // that it is never smaller than the number of queued tasks.
+  const std::size_t index(workerIndex());
+  if (index < workers_.size()) {
+    Worker& worker(*workers_[index]);
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.tasks.push_back(std::move(task));
+    ++nbPending_;
+  } else {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shared_.push_back(std::move(task));
+    ++nbPending_;
+  }
+  // Workers check the number of pending tasks with mutex_ locked before
+  // going to sleep: locking it here prevents the notification from being
+  // lost.
+  { std::lock_guard<std::mutex> lock(mutex_); }
+  wakeUp_.notify_one();
+}
+
+bool TaskScheduler::runOne(std::size_t index) {
+  Task_t task;
+  const std::size_t n(workers_.size());
+  if (index < n) {
+    // Most recent task of the worker
+    Worker& worker(*workers_[index]);
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (!worker.tasks.empty()) {
+      task = std::move(worker.tasks.back());
+      worker.tasks.pop_back();
+      --nbPending_;
+    }
+  }
+  if (!task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!shared_.empty()) {
+      task = std::move(shared_.front());
+      shared_.pop_front();
+      --nbPending_;
+    }
+  }
+  // Steal the oldest task of another worker
+  for (std::size_t k = 1; !task && k < n; ++k) {
+    Worker& worker(*workers_[(index + k) % n]);
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (!worker.tasks.empty()) {
+      task = std::move(worker.tasks.front());
+      worker.tasks.pop_front();
+      --nbPending_;
+    }
+  }
+  if (!task) return false;
+  task();
+  return true;
+}
+
+void TaskScheduler::work(std::size_t index) {
+  currentScheduler = this;
+  currentIndex = index;
+  while (true) {
+    if (runOne(index)) continue;
+    std::unique_lock<std::mutex> lock(mutex_);
+    wakeUp_.wait(lock, [this]() { return stop_ || nbPending_ > 0; });
+    if (stop_ && nbPending_ == 0) return;
+  }
+}
+
+TaskGroup::TaskGroup(const TaskSchedulerPtr_t& scheduler)
+    : scheduler_(scheduler), nbRunning_(0), cancelled_(false) {}
+
+TaskGroup::~TaskGroup() { join(); }
+
+void TaskGroup::run(TaskScheduler::Task_t task) {
+  ++nbRunning_;
+  scheduler_->submit([this, task]() {
+    if (!cancelled_) {
+      try {
+        task();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_) error_ = std::current_exception();
+        cancelled_ = true;
+      }
+    }
+    // The group may be destroyed as soon as the counter reaches 0 and the
+    // mutex is released.
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--nbRunning_ == 0) done_.notify_all();
+  });
+}
+
+void TaskGroup::parallelFor(std::size_t begin, std::size_t end,
+                            const std::function<void(std::size_t)>& body,
+                            std::size_t maxTasks) {
+  if (maxTasks == 0) maxTasks = scheduler_->numberThreads();
+  distribute(maxTasks, begin, end,
+             [body](std::size_t, std::size_t i) { body(i); });
+}
+
+void TaskGroup::distribute(
+    std::size_t nbTasks, std::size_t begin, std::size_t end,
+    const std::function<void(std::size_t, std::size_t)>& body) {
+  if (begin >= end) return;
+  nbTasks = std::max<std::size_t>(1, std::min(nbTasks, end - begin));
+  shared_ptr<std::atomic<std::size_t> > next(
+      new std::atomic<std::size_t>(begin));
+  for (std::size_t task = 0; task < nbTasks; ++task) {
+    run([this, next, end, task, body]() {
+      for (std::size_t i = (*next)++; i < end && !cancelled_; i = (*next)++)
+        body(task, i);
+    });
+  }
+}
+
+void TaskGroup::wait() {
+  join();
+  std::exception_ptr error;
+  std::swap(error, error_);
+  if (error) std::rethrow_exception(error);
+}
+
+void TaskGroup::join() {
+  const std::size_t index(scheduler_->workerIndex());
+  if (index < scheduler_->numberThreads()) {
+    // Execute pending tasks, possibly of other groups, instead of blocking
+    // the worker.
+    while (nbRunning_ > 0)
+      if (!scheduler_->runOne(index)) std::this_thread::yield();
+    // Wait until the last task released the mutex.
+    std::lock_guard<std::mutex> lock(mutex_);
+  } else {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return nbRunning_ == 0; });
+  }
+}
+}  // namespace core
+}  // namespace hpp
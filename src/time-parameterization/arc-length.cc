@@ -0,0 +1,152 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <algorithm>
+#include <cmath>
+#include <hpp/core/distance.hh>
+#include <hpp/core/path.hh>
+#include <hpp/core/time-parameterization/arc-length.hh>
+
+namespace hpp {
+namespace core {
+namespace timeParameterization {
+namespace {
+// The time range is first split in initialIntervals intervals of same
+// duration. Each of them is bisected at most maxDepth times.
+const size_type initialIntervals = 8;
+const size_type maxDepth = 12;
+}  // namespace
+
+ArcLengthPtr_t ArcLength::create(const PathPtr_t& path,
+                                 const DistancePtr_t& distance,
+                                 const value_type& tolerance) {
+  ArcLength* ptr = new ArcLength(distance);
+  ArcLengthPtr_t shPtr(ptr);
+  const interval_t& tr(path->timeRange());
+  // Sample the path uniformly in time to estimate its length.
+  std::vector<value_type> times(initialIntervals + 1);
+  std::vector<Configuration_t> configs(initialIntervals + 1,
+                                       Configuration_t(path->outputSize()));
+  value_type estimate = 0;
+  for (size_type i = 0; i <= initialIntervals; ++i) {
+    times[i] = (i == initialIntervals
+                    ? tr.second
+                    : tr.first + (value_type)i * (tr.second - tr.first) /
+                                     (value_type)initialIntervals);
+    if (!path->eval(configs[i], times[i])) return ArcLengthPtr_t();
+    if (i > 0) estimate += (*distance)(configs[i - 1], configs[i]);
+  }
+  ptr->lengths_.push_back(0);
+  ptr->times_.push_back(tr.first);
+  for (size_type i = 0; i < initialIntervals; ++i)
+    if (!ptr->tabulate(path, *distance, times[i], configs[i], times[i + 1],
+                       configs[i + 1], tolerance * estimate, maxDepth))
+      return ArcLengthPtr_t();
+  return shPtr;
+}
+
+bool ArcLength::tabulate(const PathPtr_t& path, const Distance& distance,
+                         const value_type& t0, ConfigurationIn_t q0,
+                         const value_type& t1, ConfigurationIn_t q1,
+                         const value_type& tolerance, size_type depth) {
+  const value_type tm = .5 * (t0 + t1);
+  Configuration_t qm(q0.size());
+  if (!path->eval(qm, tm)) return false;
+  const value_type l0 = distance(q0, qm), l1 = distance(qm, q1),
+                   l = l0 + l1;
+  if (depth > 0 && (std::fabs(l0 - l1) > tolerance ||
+                    distance(q0, q1) < l - tolerance)) {
+    return tabulate(path, distance, t0, q0, tm, qm, tolerance, depth - 1) &&
+           tabulate(path, distance, tm, qm, t1, q1, tolerance, depth - 1);
+  }
+  const std::size_t n = lengths_.size();
+  if (l <= 0 && n > 1 && lengths_[n - 1] == lengths_[n - 2]) {
+    // The path does not move: extend the last interval where it does not
+    // move either.
+    times_.back() = t1;
+  } else {
+    lengths_.push_back(lengths_.back() + l);
+    times_.push_back(t1);
+  }
+  return true;
+}
+
+std::size_t ArcLength::interval(const value_type& x,
+                                const std::vector<value_type>& values) {
+  assert(values.size() > 1);
+  std::vector<value_type>::const_iterator it(
+      std::upper_bound(values.begin() + 1, values.end() - 1, x));
+  return (std::size_t)(it - values.begin()) - 1;
+}
+
+value_type ArcLength::slope(std::size_t i) const {
+  const value_type ds = lengths_[i + 1] - lengths_[i];
+  if (ds <= 0) return 0;
+  return (times_[i + 1] - times_[i]) / ds;
+}
+
+value_type ArcLength::value(const value_type& s) const {
+  const std::size_t i = interval(s, lengths_);
+  const value_type ds = lengths_[i + 1] - lengths_[i];
+  if (ds <= 0) return times_[i];
+  const value_type alpha =
+      std::min(std::max((s - lengths_[i]) / ds, value_type(0)), value_type(1));
+  return times_[i] + alpha * (times_[i + 1] - times_[i]);
+}
+
+value_type ArcLength::lengthAtTime(const value_type& t) const {
+  const std::size_t i = interval(t, times_);
+  const value_type dt = times_[i + 1] - times_[i];
+  if (dt <= 0) return lengths_[i];
+  const value_type alpha =
+      std::min(std::max((t - times_[i]) / dt, value_type(0)), value_type(1));
+  return lengths_[i] + alpha * (lengths_[i + 1] - lengths_[i]);
+}
+
+value_type ArcLength::derivative(const value_type& s,
+                                 const size_type& order) const {
+  switch (order) {
+    case 0:
+      return value(s);
+    case 1:
+      return slope(interval(s, lengths_));
+    default:
+      return 0;
+  }
+}
+
+value_type ArcLength::derivativeBound(const value_type& low,
+                                      const value_type& up) const {
+  const std::size_t i1 = interval(up, lengths_);
+  value_type res = 0;
+  for (std::size_t i = interval(low, lengths_); i <= i1; ++i)
+    res = std::max(res, slope(i));
+  return res;
+}
+}  // namespace timeParameterization
+}  // namespace core
+}  // namespace hpp
@@ -0,0 +1,179 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <hpp/core/trace.hh>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+namespace hpp {
+namespace core {
+namespace trace {
+namespace {
+static_assert((bufferSize & (bufferSize - 1)) == 0,
+              "trace::bufferSize must be a power of two");
+
+const char magic[8] = {'H', 'P', 'P', 'T', 'R', 'A', 'C', 'E'};
+const std::uint32_t version = 1;
+
+struct Buffer {
+  Buffer(std::uint32_t rank) : thread(rank), records(bufferSize), next(0) {}
+  const std::uint32_t thread;
+  std::vector<Record> records;
+  /// Total number of events recorded by the thread. Only modified by the
+  /// owning thread.
+  std::atomic<std::uint64_t> next;
+};
+typedef std::shared_ptr<Buffer> BufferPtr_t;
+
+struct Registry {
+  typedef std::chrono::steady_clock Clock_t;
+
+  Registry() : epoch(Clock_t::now()) {}
+
+  static Registry& instance() {
+    static Registry registry;
+    return registry;
+  }
+
+  Buffer& threadBuffer() {
+    // The registry keeps the buffer alive after the thread ends so that its
+    // events can still be dumped.
+    thread_local BufferPtr_t buffer;
+    if (!buffer) {
+      std::lock_guard<std::mutex> lock(mutex);
+      buffer.reset(new Buffer((std::uint32_t)buffers.size()));
+      buffers.push_back(buffer);
+    }
+    return *buffer;
+  }
+
+  const Clock_t::time_point epoch;
+  std::mutex mutex;
+  std::vector<BufferPtr_t> buffers;
+};
+}  // namespace
+
+const char* eventName(std::uint8_t event) {
+  static const char* names[NB_EVENTS] = {
+      "sample",   "nearest",  "steer",    "project",
+      "validate", "add-node", "add-edge", "optimizer-step"};
+  if (event >= NB_EVENTS) return "unknown";
+  return names[event];
+}
+
+void record(Event event, bool success, double value) {
+  Registry& registry(Registry::instance());
+  Buffer& buffer(registry.threadBuffer());
+  const std::uint64_t i = buffer.next.load(std::memory_order_relaxed);
+  Record& r(buffer.records[i & (bufferSize - 1)]);
+  r.time = (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               Registry::Clock_t::now() - registry.epoch)
+               .count();
+  r.thread = buffer.thread;
+  r.event = (std::uint8_t)event;
+  r.success = success;
+  r.reserved = 0;
+  r.value = value;
+  buffer.next.store(i + 1, std::memory_order_release);
+}
+
+std::vector<Record> records() {
+  Registry& registry(Registry::instance());
+  std::vector<Record> result;
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const BufferPtr_t& buffer : registry.buffers) {
+    const std::uint64_t n = buffer->next.load(std::memory_order_acquire);
+    const std::uint64_t first = (n > bufferSize ? n - bufferSize : 0);
+    for (std::uint64_t i = first; i < n; ++i)
+      result.push_back(buffer->records[i & (bufferSize - 1)]);
+  }
+  std::stable_sort(result.begin(), result.end(),
+                   [](const Record& a, const Record& b) {
+                     return a.time < b.time;
+                   });
+  return result;
+}
+
+void clear() {
+  Registry& registry(Registry::instance());
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const BufferPtr_t& buffer : registry.buffers)
+    buffer->next.store(0, std::memory_order_release);
+}
+
+bool dump(const std::string& filename) {
+  const std::vector<Record> rs(records());
+  std::ofstream file(filename.c_str(), std::ios::out | std::ios::binary);
+  if (!file.is_open()) return false;
+  const std::uint32_t recordSize = sizeof(Record);
+  const std::uint64_t n = rs.size();
+  file.write(magic, sizeof(magic));
+  file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  file.write(reinterpret_cast<const char*>(&recordSize), sizeof(recordSize));
+  file.write(reinterpret_cast<const char*>(&n), sizeof(n));
+  if (n > 0)
+    file.write(reinterpret_cast<const char*>(rs.data()),
+               (std::streamsize)(n * sizeof(Record)));
+  return file.good();
+}
+
+bool load(const std::string& filename, std::vector<Record>& rs) {
+  std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+  if (!file.is_open()) return false;
+  char m[sizeof(magic)];
+  std::uint32_t v, recordSize;
+  std::uint64_t n;
+  file.read(m, sizeof(m));
+  file.read(reinterpret_cast<char*>(&v), sizeof(v));
+  file.read(reinterpret_cast<char*>(&recordSize), sizeof(recordSize));
+  file.read(reinterpret_cast<char*>(&n), sizeof(n));
+  if (!file.good() || std::memcmp(m, magic, sizeof(magic)) != 0 ||
+      v != version || recordSize != sizeof(Record))
+    return false;
+  rs.resize((std::size_t)n);
+  if (n > 0)
+    file.read(reinterpret_cast<char*>(rs.data()),
+              (std::streamsize)(n * sizeof(Record)));
+  return file.good();
+}
+
+std::ostream& replay(std::ostream& os, const std::vector<Record>& rs) {
+  for (const Record& r : rs) {
+    os << r.time << '\t' << r.thread << '\t' << eventName(r.event) << '\t'
+       << (r.success ? "ok" : "failed") << '\t' << r.value << '\n';
+  }
+  return os;
+}
+}  // namespace trace
+}  // namespace core
+}  // namespace hpp
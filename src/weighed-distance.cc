@@ -28,6 +28,13 @@
 // DAMAGE.
 
 #include <Eigen/SVD>
+#include <boost/archive/archive_exception.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <cmath>
+#include <fstream>
+#include <hpp/core/configuration-layout.hh>
+#include <hpp/core/configuration-shooter/uniform.hh>
 #include <hpp/core/problem.hh>
 #include <hpp/core/weighed-distance.hh>
 #include <hpp/pinocchio/device.hh>
@@ -36,9 +43,12 @@
 #include <hpp/pinocchio/liegroup.hh>
 #include <hpp/pinocchio/util.hh>
 #include <hpp/util/debug.hh>
+#include <hpp/util/exception-factory.hh>
+#include <hpp/util/serialization.hh>
 #include <limits>
 #include <pinocchio/algorithm/jacobian.hpp>
 #include <pinocchio/algorithm/joint-configuration.hpp>
+#include <pinocchio/algorithm/kinematics.hpp>
 #include <pinocchio/multibody/geometry.hpp>
 
 namespace hpp {
@@ -152,6 +162,29 @@ struct SquaredDistanceStep
                                       jmodel.jointConfigSelector(q1), w);
   }
 };
+
+typedef decltype(pinocchio::Data::oMi) Placements_t;
+
+/// Largest displacement of the bounding spheres of the bodies of the
+/// subtree of joint i between placements oMi and the placements stored in
+/// data.
+value_type bodyDisplacement(const pinocchio::Data& data,
+                            const pinocchio::GeomData& geomData,
+                            const Placements_t& oMi,
+                            pinocchio::JointIndex i) {
+  value_type res = 0;
+  for (pinocchio::JointIndex j = i;
+       j <= (pinocchio::JointIndex)data.lastChild[i]; ++j) {
+    value_type angle = Eigen::AngleAxis<value_type>(
+                           oMi[j].rotation().transpose() *
+                           data.oMi[j].rotation())
+                           .angle();
+    value_type d = (data.oMi[j].translation() - oMi[j].translation()).norm() +
+                   geomData.radius[j] * angle;
+    if (res < d) res = d;
+  }
+  return res;
+}
 }  // namespace
 
 WeighedDistancePtr_t WeighedDistance::create(const DevicePtr_t& robot) {
@@ -256,6 +289,140 @@ void WeighedDistance::computeWeights() {
   hppDout(info, "The weights are " << weights_);
 }
 
+void WeighedDistance::calibrate(size_type nbSamples, value_type step) {
+  if (nbSamples <= 0)
+    throw std::invalid_argument("Number of samples should be positive.");
+  if (!(step > 0)) throw std::invalid_argument("Step should be positive.");
+  const pinocchio::Model& model = robot_->model();
+  if (model.joints.size() <= 1) return;
+  pinocchio::DeviceSync device(robot_);
+  pinocchio::Data& data = device.data();
+  const pinocchio::GeomData& geomData = robot_->geomData();
+  ConfigurationLayoutPtr_t layout(ConfigurationLayout::get(robot_));
+  ConfigurationShooterPtr_t shooter(
+      configurationShooter::Uniform::create(robot_));
+  const Configuration_t& neutral(robot_->neutralConfiguration());
+
+  // Least square fit of weight^2 * |v|^2 = D^2 for each joint, where v is
+  // the motion of the joint and D the displacement of the bodies.
+  vector_t num(vector_t::Zero(model.joints.size() - 1)),
+      den(vector_t::Zero(model.joints.size() - 1));
+  Configuration_t q, q1(robot_->configSize());
+  vector_t v(robot_->numberDof());
+  Placements_t oMi;
+  const value_type v2(step * step);
+  for (size_type n = 0; n < nbSamples; ++n) {
+    shooter->shoot(q);
+    // Infinite bounds, on the root translation for instance, do not
+    // change the relative motion of the bodies.
+    for (size_type k = 0; k < q.size(); ++k)
+      if (!std::isfinite(q[k])) q[k] = neutral[k];
+    ::pinocchio::forwardKinematics(model, data, q.head(model.nq));
+    oMi = data.oMi;
+    for (pinocchio::JointIndex i = 1; i < model.joints.size(); ++i) {
+      const size_type iv(model.joints[i].idx_v()), nv(model.joints[i].nv());
+      v.setZero();
+      v.segment(iv, nv).setRandom();
+      v *= step / v.norm();
+      layout->integrate(q, v, q1);
+      ::pinocchio::forwardKinematics(model, data, q1.head(model.nq));
+      value_type D(bodyDisplacement(data, geomData, oMi, i));
+      num[i - 1] += D * D * v2;
+      den[i - 1] += v2 * v2;
+    }
+  }
+  value_type minWeight = std::numeric_limits<value_type>::infinity();
+  for (size_type i = 0; i < num.size(); ++i) {
+    weights_[i] = sqrt(num[i] / den[i]);
+    if (minWeight > weights_[i] && weights_[i] > 0) minWeight = weights_[i];
+  }
+  // Joints that do not move any body keep a positive weight so that the
+  // distance remains a metric.
+  if (minWeight == std::numeric_limits<value_type>::infinity()) minWeight = 1;
+  for (size_type i = 0; i < num.size(); ++i)
+    if (!(weights_[i] > 0)) weights_[i] = minWeight;
+  hppDout(info, "The calibrated weights are " << weights_.transpose());
+}
+
+bool WeighedDistance::calibrateOrLoad(const std::string& filename,
+                                      size_type nbSamples) {
+  if (load(filename)) return true;
+  calibrate(nbSamples);
+  save(filename);
+  return false;
+}
+
+std::vector<std::string> WeighedDistance::key() const {
+  const pinocchio::Model& model = robot_->model();
+  std::vector<std::string> res;
+  res.reserve(model.names.size());
+  res.push_back(robot_->name());
+  for (std::size_t i = 1; i < model.names.size(); ++i)
+    res.push_back(model.names[i]);
+  return res;
+}
+
+std::vector<value_type> WeighedDistance::geometryKey() const {
+  const pinocchio::Model& model = robot_->model();
+  const pinocchio::GeomModel& geomModel = robot_->geomModel();
+  const pinocchio::GeomData& geomData = robot_->geomData();
+  std::vector<value_type> res;
+  res.reserve(12 * (model.jointPlacements.size() +
+                    geomModel.geometryObjects.size()) +
+              2 * geomData.radius.size());
+  for (std::size_t i = 1; i < model.jointPlacements.size(); ++i) {
+    const Transform3f& M(model.jointPlacements[i]);
+    for (int k = 0; k < 3; ++k) res.push_back(M.translation()[k]);
+    for (int k = 0; k < 9; ++k) res.push_back(M.rotation().data()[k]);
+  }
+  for (std::size_t i = 0; i < geomModel.geometryObjects.size(); ++i) {
+    const Transform3f& M(geomModel.geometryObjects[i].placement);
+    res.push_back((value_type)geomModel.geometryObjects[i].parentJoint);
+    for (int k = 0; k < 3; ++k) res.push_back(M.translation()[k]);
+    for (int k = 0; k < 9; ++k) res.push_back(M.rotation().data()[k]);
+  }
+  res.insert(res.end(), geomData.radius.begin(), geomData.radius.end());
+  return res;
+}
+
+void WeighedDistance::save(const std::string& filename) const {
+  std::ofstream fs(filename.c_str(), std::ios::binary);
+  if (!fs.is_open())
+    HPP_THROW(std::runtime_error, "Could not open " << filename);
+  hpp::serialization::binary_oarchive ar(fs);
+  std::vector<std::string> k(key());
+  std::vector<value_type> g(geometryKey());
+  std::vector<value_type> w(weights_.data(), weights_.data() + weights_.size());
+  ar& boost::serialization::make_nvp("key", k);
+  ar& boost::serialization::make_nvp("geometry", g);
+  ar& boost::serialization::make_nvp("weights", w);
+}
+
+bool WeighedDistance::load(const std::string& filename) {
+  std::ifstream fs(filename.c_str(), std::ios::binary);
+  if (!fs.is_open()) return false;
+  std::vector<std::string> k;
+  std::vector<value_type> g, w;
+  try {
+    hpp::serialization::binary_iarchive ar(fs);
+    ar& boost::serialization::make_nvp("key", k);
+    ar& boost::serialization::make_nvp("geometry", g);
+    if (k != key() || g != geometryKey()) {
+      hppDout(info, "Weights in " << filename
+                                  << " were computed for another robot.");
+      return false;
+    }
+    ar& boost::serialization::make_nvp("weights", w);
+  } catch (const boost::archive::archive_exception& exc) {
+    // Truncated file or file written in an older format.
+    hppDout(info, "Could not read " << filename << ": " << exc.what());
+    return false;
+  }
+  if ((size_type)w.size() != weights_.size()) return false;
+  weights_ = Eigen::Map<const vector_t>(w.data(), (size_type)w.size());
+  return true;
+}
+
 WeighedDistance::WeighedDistance(const DevicePtr_t& robot)
     : robot_(robot), weights_() {
   computeWeights();
@@ -264,6 +431,16 @@ WeighedDistance::WeighedDistance(const DevicePtr_t& robot)
 WeighedDistance::WeighedDistance(const ProblemConstPtr_t& problem)
     : robot_(problem->robot()), weights_() {
   computeWeights();
+  size_type nbSamples(
+      problem->getParameter("WeighedDistance/Calibration/NumberOfSamples")
+          .intValue());
+  if (nbSamples <= 0) return;
+  std::string filename(
+      problem->getParameter("WeighedDistance/Calibration/File").stringValue());
+  if (filename.empty())
+    calibrate(nbSamples);
+  else
+    calibrateOrLoad(filename, nbSamples);
 }
 
 WeighedDistance::WeighedDistance(const DevicePtr_t& robot,
@@ -293,5 +470,21 @@ value_type WeighedDistance::impl_distance(ConfigurationIn_t q1,
   res += (q1 - q2).tail(robot_->extraConfigSpace().dimension()).squaredNorm();
   return sqrt(res);
 }
+
+// ----------- Declare parameters ------------------------------------- //
+
+HPP_START_PARAMETER_DECLARATION(WeighedDistance)
+Problem::declareParameter(ParameterDescription(
+    Parameter::INT, "WeighedDistance/Calibration/NumberOfSamples",
+    "Number of random configurations used to fit the weights to the "
+    "displacement of the robot bodies. If 0, the weights are bounds "
+    "computed from the kinematic chain.",
+    Parameter((size_type)0)));
+Problem::declareParameter(ParameterDescription(
+    Parameter::STRING, "WeighedDistance/Calibration/File",
+    "File in which calibrated weights are saved for the robot model. If "
+    "empty, the weights are calibrated each time the distance is created.",
+    Parameter(std::string())));
+HPP_END_PARAMETER_DECLARATION(WeighedDistance)
 }  //   namespace core
 }  // namespace hpp
@@ -0,0 +1,148 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#define BOOST_TEST_MODULE bi - rrt - planner
+#include <boost/test/included/unit_test.hpp>
+#include <hpp/constraints/differentiable-function.hh>
+#include <hpp/constraints/implicit.hh>
+#include <hpp/core/bi-rrt-planner.hh>
+#include <hpp/core/config-projector.hh>
+#include <hpp/core/constraint-set.hh>
+#include <hpp/core/node.hh>
+#include <hpp/core/path.hh>
+#include <hpp/core/problem.hh>
+#include <hpp/core/roadmap.hh>
+#include <hpp/core/steering-method.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/joint.hh>
+#include <hpp/pinocchio/urdf/util.hh>
+#include <pinocchio/fwd.hpp>
+
+using hpp::constraints::EqualToZero;
+using hpp::constraints::Implicit;
+
+using namespace hpp::core;
+using namespace hpp::pinocchio;
+
+// Unit sphere in the space of the translations of a point.
+class Sphere : public DifferentiableFunction {
+ public:
+  Sphere() : DifferentiableFunction(3, 3, LiegroupSpace::R1(), "Sphere") {}
+
+ protected:
+  void impl_compute(LiegroupElementRef result, vectorIn_t argument) const {
+    result.vector()[0] = argument.squaredNorm() - 1;
+  }
+  void impl_jacobian(matrixOut_t jacobian, vectorIn_t arg) const {
+    jacobian.row(0) = 2 * arg.transpose();
+  }
+};
+
+// Give access to the extension of the planner.
+class AtlasPlanner : public BiRRTPlanner {
+ public:
+  static std::shared_ptr<AtlasPlanner> create(const ProblemConstPtr_t& p) {
+    std::shared_ptr<AtlasPlanner> ptr(new AtlasPlanner(p));
+    ptr->init(ptr);
+    return ptr;
+  }
+  using BiRRTPlanner::extendInternal;
+
+ protected:
+  AtlasPlanner(const ProblemConstPtr_t& problem) : BiRRTPlanner(problem) {}
+};
+
+ProblemPtr_t pointOnSphere() {
+  const char* urdfString = "<robot name='foo'><link name='base_link'/></robot>";
+  DevicePtr_t robot = Device::create("point");
+  urdf::loadModelFromString(robot, 0, "", "translation3d", urdfString, "");
+  for (size_type i = 0; i < 3; ++i) {
+    robot->rootJoint()->lowerBound(i, -2);
+    robot->rootJoint()->upperBound(i, 2);
+  }
+  ProblemPtr_t problem(Problem::create(robot));
+
+  ConfigProjectorPtr_t proj(ConfigProjector::create(robot, "proj", 1e-6, 40));
+  proj->add(Implicit::create(DifferentiableFunctionPtr_t(new Sphere),
+                             ComparisonTypes_t(1, EqualToZero)));
+  ConstraintSetPtr_t constraints(ConstraintSet::create(robot, "constraints"));
+  constraints->addConstraint(proj);
+  problem->constraints(constraints);
+  problem->steeringMethod()->constraints(constraints);
+
+  ConfigurationPtr_t qinit(new Configuration_t(robot->configSize()));
+  ConfigurationPtr_t qgoal(new Configuration_t(robot->configSize()));
+  *qinit << 1, 0, 0;
+  *qgoal << 0, 0, 1;
+  problem->initConfig(qinit);
+  problem->addGoalConfig(qgoal);
+  return problem;
+}
+
+// Extension in the chart of the nearest node is bounded by the chart radius
+// and stays on the constraints.
+BOOST_AUTO_TEST_CASE(atlas) {
+  ProblemPtr_t problem(pointOnSphere());
+  const value_type radius = 0.2;
+  problem->setParameter("BiRRTPlanner/Atlas/ChartRadius", Parameter(radius));
+  SteeringMethodPtr_t sm(problem->steeringMethod());
+  ConstraintSetPtr_t constraints(problem->constraints());
+  Configuration_t target(3), qProj(3);
+  target << 0, 2, 0;
+
+  for (int atlas = 0; atlas < 2; ++atlas) {
+    problem->setParameter("BiRRTPlanner/Atlas", Parameter(atlas == 1));
+    std::shared_ptr<AtlasPlanner> planner(AtlasPlanner::create(problem));
+    planner->startSolve();
+    NodePtr_t near(planner->roadmap()->initNode());
+    const Configuration_t& q0(*near->configuration());
+
+    PathPtr_t path(planner->extendInternal(sm, qProj, near, target));
+    BOOST_REQUIRE(path);
+    BOOST_CHECK(constraints->isSatisfied(qProj));
+    BOOST_CHECK(path->end().isApprox(qProj));
+    BOOST_CHECK_GT((qProj - q0).dot(target - q0), 0);
+    if (atlas == 0) {
+      // The whole step toward the target is projected.
+      BOOST_CHECK_GT((qProj - q0).norm(), 1);
+      continue;
+    }
+    BOOST_CHECK_LE((qProj - q0).norm(), radius + 1e-6);
+    BOOST_CHECK_GT((qProj - q0).norm(), radius / 2);
+
+    // Extending again from the same node reuses its chart.
+    Configuration_t q1(qProj);
+    path = planner->extendInternal(sm, qProj, near, target);
+    BOOST_REQUIRE(path);
+    BOOST_CHECK(qProj.isApprox(q1));
+
+    // Extension backward ends at the node.
+    path = planner->extendInternal(sm, qProj, near, target, true);
+    BOOST_REQUIRE(path);
+    BOOST_CHECK(path->end().isApprox(q0));
+  }
+}
@@ -0,0 +1,129 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <chrono>
+#include <hpp/core/problem.hh>
+#include <hpp/core/steering-method/cartesian.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/joint.hh>
+#include <hpp/pinocchio/urdf/util.hh>
+#include <sstream>
+
+#define BOOST_TEST_MODULE cartesian - steering - method
+#include <boost/test/included/unit_test.hpp>
+
+using namespace hpp::core;
+using namespace hpp::pinocchio;
+
+namespace {
+// Six revolute joint arm
+DevicePtr_t createArm() {
+  std::ostringstream urdf;
+  const char* joints[6][3] = {{"a1", "0 0 0", "0 0 1"},
+                              {"a2", "0 0 0.815", "0 1 0"},
+                              {"a3", "0 0 0.85", "0 1 0"},
+                              {"a4", "0 0 0.145", "1 0 0"},
+                              {"a5", "0.8 0 0", "0 1 0"},
+                              {"a6", "0 0 0", "1 0 0"}};
+  urdf << "<robot name='arm'><link name='base_link'/>";
+  for (std::size_t i = 0; i < 6; ++i) {
+    std::string parent(i == 0 ? "base_link" : std::string("link_") +
+                                                  joints[i - 1][0]);
+    urdf << "<link name='link_" << joints[i][0] << "'/>"
+         << "<joint name='" << joints[i][0] << "' type='revolute'>"
+         << "<parent link='" << parent << "'/>"
+         << "<child link='link_" << joints[i][0] << "'/>"
+         << "<origin xyz='" << joints[i][1] << "'/>"
+         << "<axis xyz='" << joints[i][2] << "'/>"
+         << "<limit lower='-3.1' upper='3.1' effort='1' velocity='1'/>"
+         << "</joint>";
+  }
+  urdf << "</robot>";
+  DevicePtr_t robot = Device::create("arm");
+  urdf::loadModelFromString(robot, 0, "", "anchor", urdf.str(), "");
+  robot->controlComputation((Computation_t)(JOINT_POSITION | JACOBIAN));
+  return robot;
+}
+
+Transform3f endEffectorPose(const DevicePtr_t& robot, ConfigurationIn_t q) {
+  robot->currentConfiguration(q);
+  robot->computeForwardKinematics();
+  return robot->getJointByName("a6")->currentTransformation();
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(straight_line) {
+  DevicePtr_t robot(createArm());
+  ProblemPtr_t problem(Problem::create(robot));
+  steeringMethod::CartesianPtr_t sm(steeringMethod::Cartesian::create(
+      problem, robot->getJointByName("a6"), Transform3f::Identity()));
+  Configuration_t q1(6), q(6);
+  q1 << 0.2, -0.4, 0.9, 0.3, 0.6, -0.2;
+  const Transform3f M1(endEffectorPose(robot, q1));
+  const vector3_t translation(0.1, -0.15, -0.2);
+  const Transform3f M2(M1.rotation(), M1.translation() + translation);
+
+  std::chrono::steady_clock::time_point start(std::chrono::steady_clock::now());
+  PathPtr_t path(sm->moveTo(q1, M2));
+  BOOST_TEST_MESSAGE(
+      "moveTo: " << std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start)
+                        .count()
+                 << "us");
+  BOOST_REQUIRE(path);
+  BOOST_CHECK(path->initial().isApprox(q1));
+
+  // The end-effector moves along the line with a constant orientation.
+  const vector3_t u(translation.normalized());
+  for (int i = 0; i <= 100; ++i) {
+    BOOST_CHECK(path->eval(q, path->length() * i / 100));
+    const Transform3f M(endEffectorPose(robot, q));
+    const vector3_t d(M.translation() - M1.translation());
+    BOOST_CHECK_SMALL((d - d.dot(u) * u).norm(), 1e-3);
+    BOOST_CHECK(M.rotation().isApprox(M1.rotation(), 1e-2));
+  }
+  const Transform3f M(endEffectorPose(robot, path->end()));
+  BOOST_CHECK_SMALL((M.translation() - M2.translation()).norm(), 1e-3);
+
+  // Steering between configurations ends at the second configuration.
+  const Configuration_t q2(path->end());
+  PathPtr_t path2(sm->steer(q1, q2));
+  BOOST_REQUIRE(path2);
+  BOOST_CHECK(path2->end().isApprox(q2));
+}
+
+BOOST_AUTO_TEST_CASE(unreachable) {
+  DevicePtr_t robot(createArm());
+  ProblemPtr_t problem(Problem::create(robot));
+  steeringMethod::CartesianPtr_t sm(steeringMethod::Cartesian::create(
+      problem, robot->getJointByName("a6"), Transform3f::Identity()));
+  Configuration_t q1(6);
+  q1 << 0.2, -0.4, 0.9, 0.3, 0.6, -0.2;
+  const Transform3f M1(endEffectorPose(robot, q1));
+  const Transform3f M2(M1.rotation(), M1.translation() + vector3_t(5, 0, 0));
+  BOOST_CHECK(!sm->moveTo(q1, M2));
+}
@@ -0,0 +1,109 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#define BOOST_TEST_MODULE configuration_layout
+#include <boost/test/included/unit_test.hpp>
+#include <hpp/core/configuration-layout.hh>
+#include <hpp/core/configuration-shooter/uniform.hh>
+#include <hpp/pinocchio/configuration.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/liegroup.hh>
+#include <hpp/pinocchio/simple-device.hh>
+#include <pinocchio/fwd.hpp>
+
+using hpp::pinocchio::DevicePtr_t;
+using hpp::pinocchio::RnxSOnLieGroupMap;
+using namespace hpp::core;
+
+namespace pin_test = hpp::pinocchio::unittest;
+
+const value_type eps = 1e-8;
+
+void compare(const DevicePtr_t& robot) {
+  ConfigurationLayoutPtr_t layout(ConfigurationLayout::get(robot));
+  BOOST_REQUIRE(layout->supported());
+  BOOST_CHECK_EQUAL(layout->nq(), robot->configSize());
+  BOOST_CHECK_EQUAL(layout->nv(), robot->numberDof());
+  // Layouts are cached per robot.
+  BOOST_CHECK(ConfigurationLayout::get(robot) == layout);
+
+  ConfigurationShooterPtr_t shooter(
+      configurationShooter::Uniform::create(robot));
+  Configuration_t q0, q1, q(robot->configSize()), qExp(robot->configSize());
+  vector_t v(robot->numberDof()), vExp(robot->numberDof());
+  vector_t u(5);
+  u << 0, .25, .5, .75, 1;
+  matrix_t qs(robot->configSize(), u.size());
+  for (int i = 0; i < 20; ++i) {
+    shooter->shoot(q0);
+    shooter->shoot(q1);
+
+    layout->difference(q1, q0, v);
+    hpp::pinocchio::difference<RnxSOnLieGroupMap>(robot, q1, q0, vExp);
+    BOOST_CHECK_MESSAGE((v - vExp).norm() < eps,
+                        "difference: " << v.transpose() << " instead of "
+                                       << vExp.transpose());
+
+    layout->integrate(q0, v, q);
+    hpp::pinocchio::difference<RnxSOnLieGroupMap>(robot, q, q1, vExp);
+    BOOST_CHECK_MESSAGE(vExp.norm() < eps, "integrate: " << q.transpose()
+                                                         << " instead of "
+                                                         << q1.transpose());
+
+    layout->interpolate(q0, q1, u, qs);
+    for (size_type j = 0; j < u.size(); ++j) {
+      layout->interpolate(q0, q1, u[j], q);
+      BOOST_CHECK((qs.col(j) - q).norm() < eps);
+      hpp::pinocchio::interpolate<RnxSOnLieGroupMap>(robot, q0, q1, u[j],
+                                                     qExp);
+      hpp::pinocchio::difference<RnxSOnLieGroupMap>(robot, q, qExp, vExp);
+      BOOST_CHECK_MESSAGE(vExp.norm() < eps,
+                          "interpolate at " << u[j] << ": " << q.transpose()
+                                            << " instead of "
+                                            << qExp.transpose());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(humanoid) {
+  DevicePtr_t robot = pin_test::makeDevice(pin_test::HumanoidSimple);
+  robot->setDimensionExtraConfigSpace(2);
+  compare(robot);
+}
+
+BOOST_AUTO_TEST_CASE(carLike) {
+  DevicePtr_t robot = pin_test::makeDevice(pin_test::CarLike);
+  compare(robot);
+
+  // Vector space joints are merged and rotations get their own segments.
+  ConfigurationLayoutPtr_t layout(ConfigurationLayout::get(robot));
+  const ConfigurationLayout::Segments_t& segments(layout->segments());
+  for (std::size_t i = 1; i < segments.size(); ++i) {
+    BOOST_CHECK(segments[i].type != ConfigurationLayout::VECTOR_SPACE ||
+                segments[i - 1].type != ConfigurationLayout::VECTOR_SPACE);
+  }
+}
@@ -27,12 +27,25 @@
 // DAMAGE.
 
 #define BOOST_TEST_MODULE configuration_shooters
+#include <hpp/fcl/shape/geometric_shapes.h>
+
 #include <boost/test/included/unit_test.hpp>
+#include <hpp/constraints/locked-joint.hh>
+#include <hpp/core/collision-validation.hh>
+#include <hpp/core/config-projector.hh>
+#include <hpp/core/config-validation.hh>
+#include <hpp/core/configuration-shooter/bridge.hh>
 #include <hpp/core/configuration-shooter/gaussian.hh>
+#include <hpp/core/configuration-shooter/reduced-coordinates.hh>
+#include <hpp/core/configuration-shooter/retraction.hh>
 #include <hpp/core/configuration-shooter/uniform.hh>
+#include <hpp/core/constraint-set.hh>
+#include <hpp/core/problem-solver.hh>
 #include <hpp/pinocchio/configuration.hh>
 #include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/joint.hh>
 #include <hpp/pinocchio/simple-device.hh>
+#include <hpp/pinocchio/urdf/util.hh>
 #include <pinocchio/fwd.hpp>
 
 using hpp::pinocchio::DevicePtr_t;
@@ -71,3 +84,147 @@ BOOST_AUTO_TEST_CASE(gaussian) {
   cs->shoot(q);
   BOOST_CHECK(q.isApprox(cs->center()));
 }
+
+BOOST_AUTO_TEST_CASE(reducedCoordinates) {
+  using hpp::constraints::LockedJoint;
+  using hpp::core::ConfigProjector;
+  using hpp::core::ConfigProjectorPtr_t;
+  using hpp::core::ConstraintSet;
+  using hpp::core::ConstraintSetPtr_t;
+  using hpp::pinocchio::JointPtr_t;
+  using hpp::pinocchio::LiegroupElement;
+
+  DevicePtr_t robot = pin_test::makeDevice(pin_test::HumanoidSimple);
+  ConstraintSetPtr_t constraints = ConstraintSet::create(robot, "constraints");
+  ConfigProjectorPtr_t proj =
+      ConfigProjector::create(robot, "projector", 1e-4, 20);
+  constraints->addConstraint(proj);
+
+  // Lock the last joint in its neutral configuration.
+  JointPtr_t joint = robot->jointAt(robot->nbJoints() - 1);
+  LiegroupElement value(joint->configurationSpace());
+  value.vector() = robot->neutralConfiguration().segment(
+      joint->rankInConfiguration(), joint->configSize());
+  proj->add(LockedJoint::create(joint, value));
+
+  ReducedCoordinatesPtr_t cs = ReducedCoordinates::create(robot, constraints);
+  basic_test(cs, robot);
+
+  hpp::core::Configuration_t q;
+  for (int i = 0; i < 10; ++i) {
+    cs->shoot(q);
+    BOOST_CHECK(q.segment(joint->rankInConfiguration(), joint->configSize())
+                    .isApprox(value.vector()));
+    BOOST_CHECK(constraints->isSatisfied(q));
+  }
+}
+
+// Configurations are valid in a thin slab of the root translation only.
+class SlabValidation : public hpp::core::ConfigValidation {
+ public:
+  virtual bool validate(const hpp::core::Configuration_t& q,
+                        hpp::core::ValidationReportPtr_t&) {
+    return std::fabs(q[0]) < 0.05;
+  }
+};
+
+BOOST_AUTO_TEST_CASE(bridge) {
+  DevicePtr_t robot = pin_test::makeDevice(pin_test::HumanoidSimple);
+  robot->rootJoint()->lowerBound(0, -1);
+  robot->rootJoint()->upperBound(0, 1);
+  hpp::core::ConfigValidationPtr_t validation(new SlabValidation);
+
+  BridgePtr_t cs = Bridge::create(robot, validation);
+  basic_test(cs, robot);
+
+  cs->uniformRatio(0);
+  cs->maxTrials(10000);
+  cs->resetStatistics();
+  hpp::core::Configuration_t q;
+  hpp::core::ValidationReportPtr_t report;
+  for (int i = 0; i < 10; ++i) {
+    cs->shoot(q);
+    BOOST_CHECK(validation->validate(q, report));
+  }
+  BOOST_CHECK_EQUAL(cs->numberBridgeSamples(), 10);
+  BOOST_CHECK_EQUAL(cs->numberUniformSamples(), 0);
+  BOOST_CHECK(cs->numberTrials() >= 10);
+  BOOST_CHECK_CLOSE(cs->acceptanceRate(), 10. / (double)cs->numberTrials(),
+                    1e-8);
+}
+
+BOOST_AUTO_TEST_CASE(retraction) {
+  DevicePtr_t robot = pin_test::makeDevice(pin_test::HumanoidSimple);
+  robot->rootJoint()->lowerBound(0, -1);
+  robot->rootJoint()->upperBound(0, 1);
+  hpp::core::ConfigValidationPtr_t validation(new SlabValidation);
+
+  RetractionPtr_t cs =
+      Retraction::create(robot, validation, Uniform::create(robot));
+  basic_test(cs, robot);
+
+  // Configurations out of the slab are not in collision and cannot be
+  // retracted: they are returned as is.
+  cs->resetStatistics();
+  hpp::core::Configuration_t q;
+  hpp::core::ValidationReportPtr_t report;
+  std::size_t nbValid = 0;
+  for (int i = 0; i < 100; ++i) {
+    cs->shoot(q);
+    if (validation->validate(q, report)) ++nbValid;
+  }
+  BOOST_CHECK_EQUAL(cs->numberSamples(), 100);
+  BOOST_CHECK_EQUAL(cs->numberRetracted(), 0);
+  BOOST_CHECK_EQUAL(cs->numberFailures(), 100 - nbValid);
+}
+
+BOOST_AUTO_TEST_CASE(retractionFromBox) {
+  using hpp::core::CollisionValidation;
+  using hpp::core::CollisionValidationPtr_t;
+  using hpp::core::ProblemSolver;
+  using hpp::core::ProblemSolverPtr_t;
+  using hpp::pinocchio::CollisionGeometryPtr_t;
+  using hpp::pinocchio::matrix3_t;
+  using hpp::pinocchio::vector3_t;
+
+  // A sphere moving in translation around a box.
+  const char* urdfString =
+      "<robot name='foo'><link name='base_link'>"
+      "<collision><geometry><sphere radius='0.05'/></geometry></collision>"
+      "</link></robot>";
+  DevicePtr_t robot = hpp::pinocchio::Device::create("point");
+  hpp::pinocchio::urdf::loadModelFromString(robot, 0, "", "translation3d",
+                                            urdfString, "");
+  for (hpp::core::size_type i = 0; i < 3; ++i) {
+    robot->rootJoint()->lowerBound(i, -1);
+    robot->rootJoint()->upperBound(i, 1);
+  }
+  ProblemSolverPtr_t ps(ProblemSolver::create());
+  ps->robot(robot);
+  CollisionGeometryPtr_t boxGeom(new hpp::fcl::Box(0.4, 0.4, 0.4));
+  ps->addObstacle("box", boxGeom,
+                  hpp::pinocchio::SE3(matrix3_t::Identity(),
+                                      vector3_t(0.2, 0, 0)),
+                  true, true);
+  CollisionValidationPtr_t validation(CollisionValidation::create(robot));
+  validation->addObstacle(ps->obstacle("box"));
+
+  // Sample around the center of the box so that most samples collide.
+  GaussianPtr_t gaussian = Gaussian::create(robot);
+  gaussian->center(vector3_t(0.2, 0, 0));
+  gaussian->sigmas(vector3_t::Constant(0.1));
+  RetractionPtr_t cs = Retraction::create(robot, validation, gaussian);
+
+  hpp::core::Configuration_t q;
+  hpp::core::ValidationReportPtr_t report;
+  hpp::core::size_type nbValid = 0;
+  for (int i = 0; i < 100; ++i) {
+    cs->shoot(q);
+    if (validation->validate(q, report)) ++nbValid;
+  }
+  BOOST_CHECK_EQUAL(cs->numberSamples(), 100);
+  BOOST_CHECK_GT(cs->numberRetracted(), 50);
+  BOOST_CHECK_EQUAL(nbValid, 100 - cs->numberFailures());
+  BOOST_CHECK_EQUAL(cs->numberFailures(), 0);
+  delete ps;
+}
@@ -0,0 +1,146 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <hpp/fcl/shape/geometric_shapes.h>
+
+#include <cstdio>
+#include <hpp/core/collision-validation.hh>
+#include <hpp/core/configuration-shooter/uniform.hh>
+#include <hpp/core/distance-field.hh>
+#include <hpp/core/problem-solver.hh>
+#include <hpp/pinocchio/body.hh>
+#include <hpp/pinocchio/collision-object.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/joint.hh>
+#include <hpp/pinocchio/urdf/util.hh>
+#include <limits>
+
+#define BOOST_TEST_MODULE distance - field
+#include <boost/test/included/unit_test.hpp>
+
+using namespace hpp::core;
+using namespace hpp::pinocchio;
+
+struct PointInBox {
+  ProblemSolverPtr_t ps;
+  DevicePtr_t robot;
+  CollisionObjectPtr_t box;
+
+  PointInBox() : ps(ProblemSolver::create()) {
+    const char* urdfString =
+        "<robot name='foo'><link name='base_link'>"
+        "<collision><geometry><sphere radius='0.05'/></geometry></collision>"
+        "</link></robot>";
+    robot = Device::create("point");
+    urdf::loadModelFromString(robot, 0, "", "translation3d", urdfString, "");
+    for (size_type i = 0; i < 3; ++i) {
+      robot->rootJoint()->lowerBound(i, -1);
+      robot->rootJoint()->upperBound(i, 1);
+    }
+    ps->robot(robot);
+    CollisionGeometryPtr_t boxGeom(new hpp::fcl::Box(0.4, 0.4, 0.4));
+    SE3 boxTf(matrix3_t::Identity(), vector3_t(0.2, 0, 0));
+    ps->addObstacle("box", boxGeom, boxTf, true, true);
+    box = ps->obstacle("box");
+  }
+
+  ~PointInBox() { delete ps; }
+
+  DistanceFieldPtr_t field() const {
+    DistanceFieldPtr_t res(DistanceField::create(vector3_t::Constant(-1.5),
+                                                 vector3_t::Constant(1.5),
+                                                 0.05));
+    res->addObstacle(box);
+    return res;
+  }
+};
+
+BOOST_AUTO_TEST_CASE(lower_bound) {
+  PointInBox p;
+  DistanceFieldPtr_t field(p.field());
+  field->compute();
+
+  // Points along the x axis, in front of the face at x = 0.4.
+  for (value_type x = 0.5; x < 1.4; x += 0.13) {
+    value_type lb = field->distanceLowerBound(vector3_t(x, 0.01, -0.02));
+    BOOST_CHECK_LE(lb, x - 0.4);
+    BOOST_CHECK_GE(lb, x - 0.4 - 0.05 * std::sqrt(3.));
+  }
+  BOOST_CHECK_EQUAL(field->distanceLowerBound(vector3_t(2, 0, 0)),
+                    -std::numeric_limits<value_type>::infinity());
+
+  DistanceField::Spheres_t spheres(DistanceField::sphereDecomposition(
+      p.robot->rootJoint()->linkedBody()->innerObjectAt(0)));
+  BOOST_REQUIRE(!spheres.empty());
+  for (const DistanceField::Sphere& s : spheres)
+    BOOST_CHECK_GE(s.radius, 0.05);
+}
+
+BOOST_AUTO_TEST_CASE(collision_validation) {
+  PointInBox p;
+  CollisionValidationPtr_t exact(CollisionValidation::create(p.robot));
+  exact->addObstacle(p.box);
+  CollisionValidationPtr_t fast(CollisionValidation::create(p.robot));
+  fast->addObstacle(p.box);
+  DistanceFieldPtr_t field(p.field());
+  field->compute();
+  fast->distanceField(field);
+
+  configurationShooter::UniformPtr_t shooter(
+      configurationShooter::Uniform::create(p.robot));
+  ValidationReportPtr_t report;
+  Configuration_t q;
+  int nCollisions = 0;
+  for (int i = 0; i < 1000; ++i) {
+    shooter->shoot(q);
+    bool valid = exact->validate(q, report);
+    BOOST_CHECK_EQUAL(fast->validate(q, report), valid);
+    if (!valid) ++nCollisions;
+  }
+  BOOST_CHECK(nCollisions > 0);
+}
+
+BOOST_AUTO_TEST_CASE(cache) {
+  PointInBox p;
+  const char* filename = "distance-field.bin";
+  std::remove(filename);
+  DistanceFieldPtr_t field(p.field());
+  BOOST_CHECK(!field->computeOrLoad(filename));
+
+  DistanceFieldPtr_t loaded(p.field());
+  BOOST_CHECK(loaded->computeOrLoad(filename));
+  vector3_t point(0.7, 0.3, -0.1);
+  BOOST_CHECK_EQUAL(loaded->distanceLowerBound(point),
+                    field->distanceLowerBound(point));
+
+  // A field with another resolution does not use the file.
+  DistanceFieldPtr_t other(DistanceField::create(
+      vector3_t::Constant(-1.5), vector3_t::Constant(1.5), 0.1));
+  other->addObstacle(p.box);
+  BOOST_CHECK(!other->load(filename));
+  std::remove(filename);
+}
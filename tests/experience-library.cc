@@ -0,0 +1,194 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <hpp/fcl/shape/geometric_shapes.h>
+
+#include <cstdio>
+#include <hpp/core/diffusing-planner.hh>
+#include <hpp/core/experience-library.hh>
+#include <hpp/core/path-validation.hh>
+#include <hpp/core/path-vector.hh>
+#include <hpp/core/problem-solver.hh>
+#include <hpp/core/problem.hh>
+#include <hpp/core/steering-method.hh>
+#include <hpp/core/weighed-distance.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/urdf/util.hh>
+
+#define BOOST_TEST_MODULE experience - library
+#include <boost/test/included/unit_test.hpp>
+
+using namespace hpp::core;
+using namespace hpp::pinocchio;
+
+DevicePtr_t createRobot() {
+  std::string urdf(
+      "<robot name='test'>"
+      "<link name='link1'/>"
+      "<link name='link2'/>"
+      "<link name='link3'>"
+      "<collision><geometry><sphere radius='0.1'/></geometry></collision>"
+      "</link>"
+      "<joint name='tx' type='prismatic'>"
+      "<parent link='link1'/>"
+      "<child  link='link2'/>"
+      "<limit effort='30' velocity='1.0' lower='-3' upper='3'/>"
+      "</joint>"
+      "<joint name='ty' type='prismatic'>"
+      "<axis xyz='0 1 0'/>"
+      "<parent link='link2'/>"
+      "<child  link='link3'/>"
+      "<limit effort='30' velocity='1.0' lower='-3' upper='3'/>"
+      "</joint>"
+      "</robot>");
+
+  DevicePtr_t robot = Device::create("test");
+  urdf::loadModelFromString(robot, 0, "", "anchor", urdf, "");
+  return robot;
+}
+
+Configuration_t config(value_type x, value_type y) {
+  Configuration_t q(2);
+  q << x, y;
+  return q;
+}
+
+PathVectorPtr_t makePath(const ProblemPtr_t& p, ConfigurationIn_t q1,
+                         ConfigurationIn_t q2) {
+  PathVectorPtr_t pv(PathVector::create(2, 2));
+  pv->appendPath((*p->steeringMethod())(q1, q2));
+  return pv;
+}
+
+BOOST_AUTO_TEST_CASE(retrieveAndEvict) {
+  DevicePtr_t robot = createRobot();
+  ProblemPtr_t p = Problem::create(robot);
+  ExperienceLibraryPtr_t library(
+      ExperienceLibrary::create(robot, p->distance()));
+
+  library->add(makePath(p, config(-2, -2), config(2, 2)));
+  library->add(makePath(p, config(-2, 2), config(2, -2)));
+  library->add(makePath(p, config(0, -2), config(0, 2)));
+  BOOST_CHECK_EQUAL(library->size(), 3);
+
+  std::vector<std::size_t> indices(
+      library->retrieve(config(-1.9, 2), config(2, -1.9), 2));
+  BOOST_REQUIRE_EQUAL(indices.size(), 2);
+  BOOST_CHECK_EQUAL(indices[0], 1);
+
+  // Reuse the first experience: the second one is the least relevant.
+  PathPlannerPtr_t planner(DiffusingPlanner::create(p));
+  PathVectorPtr_t path(
+      library->solve(planner, config(-2.1, -2), config(2, 2.1), 1));
+  BOOST_REQUIRE(path);
+  BOOST_CHECK(path->initial().isApprox(config(-2.1, -2)));
+  BOOST_CHECK(path->end().isApprox(config(2, 2.1)));
+  BOOST_CHECK_EQUAL(library->experiences()[0].numberUses, 1);
+
+  library->maxSize(2);
+  BOOST_REQUIRE_EQUAL(library->size(), 2);
+  BOOST_CHECK(library->experiences()[0].path->initial().isApprox(
+      config(-2, -2)));
+  BOOST_CHECK(
+      library->experiences()[1].path->initial().isApprox(config(0, -2)));
+}
+
+BOOST_AUTO_TEST_CASE(forgetUnusedExperiences) {
+  DevicePtr_t robot = createRobot();
+  ProblemPtr_t p = Problem::create(robot);
+  ExperienceLibraryPtr_t library(
+      ExperienceLibrary::create(robot, p->distance()));
+  library->maxSize(2);
+
+  library->add(makePath(p, config(-2, -2), config(2, 2)));
+  PathPlannerPtr_t planner(DiffusingPlanner::create(p));
+  for (int i = 0; i < 3; ++i)
+    BOOST_REQUIRE(library->solve(planner, config(-2.1, -2), config(2, 2.1), 1));
+  BOOST_CHECK_EQUAL(library->experiences()[0].numberUses, 3);
+
+  // Experiences that are not reused anymore are eventually replaced by new
+  // ones, however often they were reused before.
+  for (int i = 0; i < 8; ++i) {
+    value_type x = -2 + .5 * i;
+    library->add(makePath(p, config(x, -2), config(x, 2)));
+  }
+  BOOST_REQUIRE_EQUAL(library->size(), 2);
+  for (const ExperienceLibrary::Experience& e : library->experiences())
+    BOOST_CHECK_EQUAL(e.numberUses, 0);
+}
+
+BOOST_AUTO_TEST_CASE(repair) {
+  ProblemSolverPtr_t ps = ProblemSolver::create();
+  DevicePtr_t robot = createRobot();
+  ps->robot(robot);
+  ProblemPtr_t p(ps->problem());
+  ExperienceLibraryPtr_t library(
+      ExperienceLibrary::create(robot, p->distance()));
+  library->add(makePath(p, config(-2, 0), config(2, 0)));
+
+  // The experience goes through an obstacle added afterwards.
+  CollisionGeometryPtr_t boxGeom(new hpp::fcl::Box(0.5, 0.5, 0.5));
+  ps->addObstacle("box", boxGeom, SE3::Identity(), true, true);
+  PathPtr_t validPart;
+  PathValidationReportPtr_t report;
+  BOOST_CHECK(!p->pathValidation()->validate(
+      library->experiences()[0].path, false, validPart, report));
+
+  PathPlannerPtr_t planner(DiffusingPlanner::create(p));
+  PathVectorPtr_t path(
+      library->solve(planner, config(-2, 0.1), config(2, 0.1), 1));
+  BOOST_REQUIRE(path);
+  BOOST_CHECK(path->initial().isApprox(config(-2, 0.1)));
+  BOOST_CHECK(path->end().isApprox(config(2, 0.1)));
+  BOOST_CHECK(p->pathValidation()->validate(path, false, validPart, report));
+  BOOST_CHECK_EQUAL(library->experiences()[0].numberUses, 1);
+  delete ps;
+}
+
+BOOST_AUTO_TEST_CASE(saveAndLoad) {
+  DevicePtr_t robot = createRobot();
+  ProblemPtr_t p = Problem::create(robot);
+  ExperienceLibraryPtr_t library(
+      ExperienceLibrary::create(robot, p->distance()));
+  library->add(makePath(p, config(-2, -2), config(2, 2)));
+  library->add(makePath(p, config(0, -2), config(0, 2)));
+  library->save("experience-library.bin");
+
+  ExperienceLibraryPtr_t loaded(
+      ExperienceLibrary::create(robot, p->distance()));
+  loaded->load("experience-library.bin");
+  BOOST_REQUIRE_EQUAL(loaded->size(), 2);
+  for (std::size_t i = 0; i < 2; ++i) {
+    const PathVectorPtr_t& p1(library->experiences()[i].path);
+    const PathVectorPtr_t& p2(loaded->experiences()[i].path);
+    BOOST_CHECK(p1->initial().isApprox(p2->initial()));
+    BOOST_CHECK(p1->end().isApprox(p2->end()));
+    BOOST_CHECK_EQUAL(library->experiences()[i].lastUse,
+                      loaded->experiences()[i].lastUse);
+  }
+  std::remove("experience-library.bin");
+}
@@ -0,0 +1,206 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <chrono>
+#include <cmath>
+#include <hpp/constraints/generic-transformation.hh>
+#include <hpp/constraints/implicit.hh>
+#include <hpp/core/config-projector.hh>
+#include <hpp/core/configuration-shooter/uniform.hh>
+#include <hpp/core/inverse-kinematics/spherical-wrist.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/joint.hh>
+#include <hpp/pinocchio/urdf/util.hh>
+#include <sstream>
+
+#define BOOST_TEST_MODULE inverse - kinematics
+#include <boost/test/included/unit_test.hpp>
+
+using namespace hpp::core;
+using namespace hpp::pinocchio;
+using hpp::constraints::ComparisonTypes_t;
+using hpp::constraints::Equality;
+using hpp::constraints::Implicit;
+using hpp::constraints::ImplicitPtr_t;
+using hpp::constraints::Transformation;
+
+namespace {
+// Six revolute joint arm with a spherical wrist.
+// If shoulderOffset is not zero, the first two axes do not intersect.
+DevicePtr_t createArm(const value_type& shoulderOffset) {
+  std::ostringstream urdf;
+  const char* joints[6][3] = {{"a1", "0 0 0", "0 0 1"},
+                              {"a2", "", "0 1 0"},
+                              {"a3", "0 0 0.85", "0 1 0"},
+                              {"a4", "0 0 0.145", "1 0 0"},
+                              {"a5", "0.8 0 0", "0 1 0"},
+                              {"a6", "0 0 0", "1 0 0"}};
+  urdf << "<robot name='arm'><link name='base_link'/>";
+  for (std::size_t i = 0; i < 6; ++i) {
+    std::ostringstream origin;
+    if (i == 1)
+      origin << shoulderOffset << " 0 0.815";
+    else
+      origin << joints[i][1];
+    std::string parent(i == 0 ? "base_link" : std::string("link_") +
+                                                  joints[i - 1][0]);
+    urdf << "<link name='link_" << joints[i][0] << "'/>"
+         << "<joint name='" << joints[i][0] << "' type='revolute'>"
+         << "<parent link='" << parent << "'/>"
+         << "<child link='link_" << joints[i][0] << "'/>"
+         << "<origin xyz='" << origin.str() << "'/>"
+         << "<axis xyz='" << joints[i][2] << "'/>"
+         << "<limit lower='-3.1' upper='3.1' effort='1' velocity='1'/>"
+         << "</joint>";
+  }
+  urdf << "</robot>";
+  DevicePtr_t robot = Device::create("arm");
+  urdf::loadModelFromString(robot, 0, "", "anchor", urdf.str(), "");
+  BOOST_REQUIRE_EQUAL(robot->configSize(), 6);
+  return robot;
+}
+
+// Constraint on the pose of the last joint in configuration q
+ImplicitPtr_t createPoseConstraint(const DevicePtr_t& robot,
+                                   ConfigurationIn_t q) {
+  JointPtr_t joint(robot->getJointByName("a6"));
+  robot->currentConfiguration(q);
+  robot->computeForwardKinematics();
+  return Implicit::create(
+      Transformation::create("pose", robot, joint,
+                             joint->currentTransformation()),
+      ComparisonTypes_t(6, Equality));
+}
+
+ConfigProjectorPtr_t createProjector(const DevicePtr_t& robot,
+                                     const ImplicitPtr_t& constraint) {
+  ConfigProjectorPtr_t projector(
+      ConfigProjector::create(robot, "projector", 1e-6, 40));
+  projector->add(constraint);
+  return projector;
+}
+
+// Distance between configurations of the arm, modulo 2 pi
+value_type angularDistance(ConfigurationIn_t q1, ConfigurationIn_t q2) {
+  value_type d = 0;
+  for (size_type i = 0; i < q1.size(); ++i) {
+    value_type delta(q1[i] - q2[i]);
+    d += std::pow(std::atan2(std::sin(delta), std::cos(delta)), 2);
+  }
+  return std::sqrt(d);
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(chain_detection) {
+  DevicePtr_t robot(createArm(0.35));
+  inverseKinematics::SphericalWristPtr_t ik(
+      inverseKinematics::SphericalWrist::create(robot));
+  BOOST_REQUIRE(ik);
+  BOOST_REQUIRE_EQUAL(ik->endJoints().size(), 1);
+  BOOST_CHECK_EQUAL(ik->endJoints()[0],
+                    (size_type)robot->getJointByName("a6")->index());
+  BOOST_CHECK_THROW(inverseKinematics::SphericalWrist::create(
+                        robot, robot->getJointByName("a5")),
+                    std::invalid_argument);
+}
+
+// The solutions satisfy the constraint and include the configuration used to
+// define it.
+BOOST_AUTO_TEST_CASE(solutions) {
+  for (value_type offset : {0., 0.35}) {
+    DevicePtr_t robot(createArm(offset));
+    InverseKinematicsPtr_t ik(inverseKinematics::SphericalWrist::create(robot));
+    BOOST_REQUIRE(ik);
+    configurationShooter::UniformPtr_t shooter(
+        configurationShooter::Uniform::create(robot));
+    Configuration_t q, q0;
+    size_type nbFound = 0;
+    const size_type N = 100;
+    for (size_type i = 0; i < N; ++i) {
+      shooter->shoot(q);
+      shooter->shoot(q0);
+      ImplicitPtr_t constraint(createPoseConstraint(robot, q));
+      BOOST_REQUIRE(ik->canSolve(constraint));
+      ConfigProjectorPtr_t projector(createProjector(robot, constraint));
+      std::vector<Configuration_t> solutions;
+      ik->solve(constraint, vector_t::Zero(6), q0, solutions);
+      bool found = false;
+      for (const Configuration_t& s : solutions) {
+        BOOST_CHECK(projector->isSatisfied(s));
+        if (angularDistance(s, q) < 1e-6) found = true;
+      }
+      if (found) ++nbFound;
+    }
+    // With a shoulder offset, the initial guesses of the Newton iterations
+    // may miss some branches.
+    BOOST_CHECK_GE(nbFound, offset == 0 ? N : 9 * N / 10);
+  }
+}
+
+// Compare the projection with and without the analytical solver from
+// random configurations.
+BOOST_AUTO_TEST_CASE(benchmark) {
+  DevicePtr_t robot(createArm(0.35));
+  robot->controlComputation((Computation_t)(JOINT_POSITION | JACOBIAN));
+  InverseKinematicsPtr_t ik(inverseKinematics::SphericalWrist::create(robot));
+  configurationShooter::UniformPtr_t shooter(
+      configurationShooter::Uniform::create(robot));
+  const size_type N = 200;
+  size_type nbSuccesses[2] = {0, 0};
+  std::chrono::steady_clock::duration durations[2] = {
+      std::chrono::steady_clock::duration::zero(),
+      std::chrono::steady_clock::duration::zero()};
+  Configuration_t q, q0;
+  for (size_type i = 0; i < N; ++i) {
+    shooter->shoot(q);
+    shooter->shoot(q0);
+    ImplicitPtr_t constraint(createPoseConstraint(robot, q));
+    for (std::size_t k = 0; k < 2; ++k) {
+      ConfigProjectorPtr_t projector(createProjector(robot, constraint));
+      if (k == 1) projector->addInverseKinematics(ik);
+      Configuration_t qProj(q0);
+      std::chrono::steady_clock::time_point start(
+          std::chrono::steady_clock::now());
+      bool success = projector->apply(qProj);
+      durations[k] += std::chrono::steady_clock::now() - start;
+      if (success) {
+        BOOST_CHECK(projector->isSatisfied(qProj));
+        ++nbSuccesses[k];
+      }
+    }
+  }
+  for (std::size_t k = 0; k < 2; ++k)
+    BOOST_TEST_MESSAGE(
+        (k == 0 ? "Newton:     " : "analytical: ")
+        << nbSuccesses[k] << "/" << N << " successes, "
+        << std::chrono::duration_cast<std::chrono::microseconds>(durations[k])
+                   .count() /
+               N
+        << " us per projection");
+  BOOST_CHECK_GE(nbSuccesses[1], nbSuccesses[0]);
+  BOOST_CHECK_GE(nbSuccesses[1], 9 * N / 10);
+}
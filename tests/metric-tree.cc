@@ -0,0 +1,161 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <hpp/core/connected-component.hh>
+#include <hpp/core/distance.hh>
+#include <hpp/core/node.hh>
+#include <hpp/core/problem.hh>
+#include <hpp/core/roadmap.hh>
+#include <hpp/core/steering-method/straight.hh>
+#include <hpp/core/weighed-distance.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/urdf/util.hh>
+
+#include "../src/nearest-neighbor/basic.hh"
+#include "../src/nearest-neighbor/metric-tree.hh"
+
+#define BOOST_TEST_MODULE metric - tree
+#include <boost/test/included/unit_test.hpp>
+
+using namespace hpp::core;
+using namespace hpp::pinocchio;
+
+using hpp::core::steeringMethod::Straight;
+using hpp::core::steeringMethod::StraightPtr_t;
+
+DevicePtr_t createRobot() {
+  std::string urdf(
+      "<robot name='test'>"
+      "<link name='link1'/>"
+      "<link name='link2'/>"
+      "<link name='link3'/>"
+      "<joint name='tx' type='prismatic'>"
+      "<parent link='link1'/>"
+      "<child  link='link2'/>"
+      "<limit effort='30' velocity='1.0' lower='-3' upper='3'/>"
+      "</joint>"
+      "<joint name='ty' type='prismatic'>"
+      "<axis xyz='0 1 0'/>"
+      "<parent link='link2'/>"
+      "<child  link='link3'/>"
+      "<limit effort='30' velocity='1.0' lower='-3' upper='3'/>"
+      "</joint>"
+      "</robot>");
+
+  DevicePtr_t robot = Device::create("test");
+  urdf::loadModelFromString(robot, 0, "", "anchor", urdf, "");
+  return robot;
+}
+
+// Distance that is not symmetric but satisfies the triangle inequality:
+// moving along x in the positive direction is more expensive.
+class AsymmetricDistance : public Distance {
+ public:
+  AsymmetricDistance(const DistancePtr_t& distance) : distance_(distance) {}
+  virtual DistancePtr_t clone() const {
+    return DistancePtr_t(new AsymmetricDistance(*this));
+  }
+
+ protected:
+  virtual value_type impl_distance(ConfigurationIn_t q1,
+                                   ConfigurationIn_t q2) const {
+    return (*distance_)(q1, q2) + std::max(0., q2[0] - q1[0]);
+  }
+
+ private:
+  DistancePtr_t distance_;
+};
+
+void checkSameResults(NearestNeighbor& tree, NearestNeighbor& basic,
+                      const RoadmapPtr_t& roadmap,
+                      const std::vector<NodePtr_t>& roots) {
+  for (int i = 0; i < 50; ++i) {
+    Configuration_t q(3 * vector_t::Random(2));
+    for (const NodePtr_t& root : roots) {
+      ConnectedComponentPtr_t cc(root->connectedComponent());
+      value_type d1, d2;
+      for (bool reverse : {false, true}) {
+        tree.search(q, cc, d1, reverse);
+        basic.search(q, cc, d2, reverse);
+        BOOST_CHECK_EQUAL(d1, d2);
+      }
+      Nodes_t n1(tree.KnearestSearch(q, cc, 5, d1));
+      Nodes_t n2(basic.KnearestSearch(q, cc, 5, d2));
+      BOOST_CHECK_EQUAL(d1, d2);
+      BOOST_CHECK_EQUAL(n1.size(), n2.size());
+      BOOST_CHECK_EQUAL(tree.withinBall(q, cc, 1.).size(),
+                        basic.withinBall(q, cc, 1.).size());
+    }
+    value_type d1, d2;
+    tree.KnearestSearch(q, roadmap, 10, d1);
+    basic.KnearestSearch(q, roadmap, 10, d2);
+    BOOST_CHECK_EQUAL(d1, d2);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(test_hpp_core)
+
+BOOST_AUTO_TEST_CASE(metricTree) {
+  DevicePtr_t robot = createRobot();
+  ProblemPtr_t p = Problem::create(robot);
+  StraightPtr_t sm = Straight::create(p);
+  DistancePtr_t weighed(
+      WeighedDistance::createWithWeight(robot, vector_t::Ones(2)));
+
+  for (bool symmetric : {true, false}) {
+    DistancePtr_t distance(
+        symmetric ? weighed : DistancePtr_t(new AsymmetricDistance(weighed)));
+    RoadmapPtr_t r = Roadmap::create(distance, robot);
+    nearestNeighbor::MetricTree* tree =
+        new nearestNeighbor::MetricTree(distance, symmetric, 8, 4);
+    r->nearestNeighbor(tree);
+    nearestNeighbor::Basic basic(distance);
+
+    // Three large connected components and a small one.
+    std::vector<NodePtr_t> roots;
+    const int sizes[] = {300, 300, 300, 10};
+    for (int size : sizes) {
+      ConfigurationPtr_t q(new Configuration_t(3 * vector_t::Random(2)));
+      NodePtr_t root(r->addNode(q));
+      roots.push_back(root);
+      for (int j = 1; j < size; ++j) {
+        q.reset(new Configuration_t(3 * vector_t::Random(2)));
+        r->addNodeAndEdges(root, q, (*sm)(*root->configuration(), *q));
+      }
+    }
+    checkSameResults(*tree, basic, r, roots);
+
+    // Merge two connected components
+    r->addEdges(roots[0], roots[1],
+                (*sm)(*roots[0]->configuration(), *roots[1]->configuration()));
+    BOOST_CHECK(roots[0]->connectedComponent() ==
+                roots[1]->connectedComponent());
+    checkSameResults(*tree, basic, r, roots);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -49,8 +49,10 @@
 #include <hpp/core/path-projector/global.hh>
 #include <hpp/core/path-projector/progressive.hh>
 #include <hpp/core/path-projector/recursive-hermite.hh>
+#include <hpp/core/path-vector.hh>
 #include <hpp/core/path/hermite.hh>
 #include <hpp/core/problem.hh>
+#include <hpp/core/reversed-path.hh>
 #include <hpp/core/steering-method/hermite.hh>
 #include <hpp/core/steering-method/straight.hh>
 #include <hpp/core/straight-path.hh>
@@ -331,13 +333,16 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(projectors, traits, test_types) {
   problem->steeringMethod(traits::SM_t::create(problem));
   problem->steeringMethod()->constraints(c);
 
-  for (int c = 0; c < 2; ++c) {
-    if (c == 0)
+  for (int c = 0; c < 3; ++c) {
+    if (c == 1)
       problem->setParameter("PathProjection/HessianBound",
-                            Parameter((value_type)-1));
+                            Parameter(traits::K));
     else
       problem->setParameter("PathProjection/HessianBound",
-                            Parameter(traits::K));
+                            Parameter((value_type)-1));
+    // Last run: the bound of the hessian is estimated online.
+    problem->setParameter("PathProjection/EstimateHessianBound",
+                          Parameter(c == 2));
 
     typename traits::ProjPtr_t projector =
         traits::Proj_t::create(problem, traits::projection_step);
@@ -368,3 +373,63 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(projectors, traits, test_types) {
     }
   }
 }
+
+// Whether configuration q is close to one of the configurations of qs
+template <typename Configs_t>
+bool contains(const Configs_t& qs, ConfigurationIn_t q) {
+  for (const Configuration_t& qq : qs)
+    if ((qq - q).norm() < 1e-8) return true;
+  return false;
+}
+
+// The waypoints of a reversed interpolated path are reused by the
+// projectors.
+BOOST_AUTO_TEST_CASE(reversed_interpolated_path) {
+  DevicePtr_t dev = createRobot();
+  BOOST_REQUIRE(dev);
+  ProblemPtr_t problem = Problem::create(dev);
+
+  ConstraintSetPtr_t c = createConstraints(dev);
+  DifferentiableFunctionPtr_t func = traits_circle::func(dev);
+  c->configProjector()->add(Implicit::create(
+      func, ComparisonTypes_t(func->outputSpace()->nv(), EqualToZero)));
+
+  // Waypoint on the circle, away from the projection of the chord middle
+  Configuration_t q1(dev->configSize()), q2(dev->configSize()),
+      qm(dev->configSize());
+  q1 << 1, 0;
+  q2 << 0, 1;
+  qm << cos(M_PI / 9), sin(M_PI / 9);
+  InterpolatedPathPtr_t forward(InterpolatedPath::create(dev, q1, q2, 2., c));
+  forward->insert(.5, qm);
+  PathPtr_t path(forward->reverse());
+  BOOST_REQUIRE(HPP_DYNAMIC_PTR_CAST(ReversedPath, path));
+
+  problem->steeringMethod(steeringMethod::Straight::create(problem));
+  problem->steeringMethod()->constraints(c);
+  PathPtr_t projection;
+  BOOST_CHECK(pathProjector::Global::create(problem, 0.1)
+                  ->apply(path, projection));
+  InterpolatedPathPtr_t ip(
+      HPP_DYNAMIC_PTR_CAST(InterpolatedPath, projection));
+  BOOST_REQUIRE(ip);
+  std::vector<Configuration_t> qs;
+  for (const auto& point : ip->interpolationPoints())
+    qs.push_back(point.second);
+  BOOST_CHECK(contains(qs, qm));
+  BOOST_CHECK(projection->initial().isApprox(q2));
+
+  problem->steeringMethod(steeringMethod::Hermite::create(problem));
+  problem->steeringMethod()->constraints(c);
+  BOOST_CHECK(pathProjector::RecursiveHermite::create(problem, 2)
+                  ->apply(path, projection));
+  PathVectorPtr_t pv(HPP_DYNAMIC_PTR_CAST(PathVector, projection));
+  BOOST_REQUIRE(pv);
+  PathVectorPtr_t flat(
+      PathVector::create(pv->outputSize(), pv->outputDerivativeSize()));
+  pv->flatten(flat);
+  qs.clear();
+  for (std::size_t i = 0; i < flat->numberPaths(); ++i)
+    qs.push_back(flat->pathAtRank(i)->end());
+  BOOST_CHECK(contains(qs, qm));
+}
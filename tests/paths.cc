@@ -38,6 +38,7 @@
 // the unit test framework
 // #include <boost/timer.hh>
 
+#include <hpp/core/interpolated-path.hh>
 #include <hpp/core/problem.hh>
 #include <hpp/core/straight-path.hh>
 #include <hpp/core/subchain-path.hh>
@@ -141,6 +142,36 @@ BOOST_AUTO_TEST_CASE(extracted) {
   checkAt(p1, 1.0, p2, .25);
 }
 
+BOOST_AUTO_TEST_CASE(reversed) {
+  DevicePtr_t dev = createRobot();
+  BOOST_REQUIRE(dev);
+
+  Configuration_t q(dev->configSize());
+  InterpolatedPathPtr_t p1 = InterpolatedPath::create(
+      dev, Configuration_t::Zero(1), Configuration_t::Ones(1), 1.);
+  q << 2;
+  p1->insert(0.5, q);
+
+  PathPtr_t p2 = p1->reverse();
+  BOOST_CHECK(p2->reverse() == p1);
+  BOOST_CHECK(p2->initial().isApprox(p1->end()));
+  BOOST_CHECK(p2->end().isApprox(p1->initial()));
+  checkAt(p1, 0.75, p2, 0.25);
+  checkAt(p1, 0.25, p2, 0.75);
+
+  vector_t v1(dev->numberDof()), v2(dev->numberDof());
+  p1->derivative(v1, 0.25, 1);
+  p2->derivative(v2, 0.75, 1);
+  BOOST_CHECK(v2.isApprox(-v1));
+  p1->velocityBound(v1, 0.1, 0.4);
+  p2->velocityBound(v2, 0.6, 0.9);
+  BOOST_CHECK(v2.isApprox(v1));
+
+  PathPtr_t p3 = p2->extract(Pair_t(0.25, 1.));
+  checkAt(p1, 0.75, p3, p3->timeRange().first);
+  checkAt(p1, 0., p3, p3->timeRange().second);
+}
+
 BOOST_AUTO_TEST_CASE(subchain) {
   DevicePtr_t dev = createRobot2();  // 10 translations
   BOOST_REQUIRE(dev);
@@ -170,4 +201,29 @@ BOOST_AUTO_TEST_CASE(subchain) {
   (*p2)(q, p1->length() * 0.5);
   BOOST_CHECK(q.head<3>().isApprox(Configuration_t::Ones(3) * 0.5));
   BOOST_CHECK(q.tail<3>().isApprox(-Configuration_t::Ones(3) * 0.5));
+
+  // Derivatives are the selected velocity parameters of the original path
+  vector_t v1(p1->outputDerivativeSize()), v2(p2->outputDerivativeSize());
+  p1->derivative(v1, p1->length() * 0.3, 1);
+  p2->derivative(v2, p1->length() * 0.3, 1);
+  BOOST_CHECK(v2.head<3>().isApprox(v1.head<3>()));
+  BOOST_CHECK(v2.tail<3>().isApprox(v1.segment<3>(6)));
+  p1->velocityBound(v1, 0, p1->length());
+  p2->velocityBound(v2, 0, p1->length());
+  BOOST_CHECK(v2.head<3>().isApprox(v1.head<3>()));
+  BOOST_CHECK(v2.tail<3>().isApprox(v1.segment<3>(6)));
+
+  // A copy evaluates as the original subchain path
+  PathPtr_t p3 = p2->copy();
+  BOOST_REQUIRE(HPP_DYNAMIC_PTR_CAST(SubchainPath, p3));
+  BOOST_CHECK_EQUAL(p3->outputSize(), p2->outputSize());
+  BOOST_CHECK_EQUAL(p3->outputDerivativeSize(), p2->outputDerivativeSize());
+  Configuration_t q3(p3->outputSize());
+  (*p3)(q3, p1->length() * 0.75);
+  (*p2)(q, p1->length() * 0.75);
+  BOOST_CHECK(q3.isApprox(q));
+  vector_t v3(p3->outputDerivativeSize());
+  p3->derivative(v3, p1->length() * 0.3, 1);
+  p2->derivative(v2, p1->length() * 0.3, 1);
+  BOOST_CHECK(v3.isApprox(v2));
 }
@@ -0,0 +1,92 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <hpp/core/path-planner/prioritized.hh>
+#include <hpp/core/path-validation.hh>
+#include <hpp/core/path-vector.hh>
+#include <hpp/core/problem.hh>
+#include <hpp/core/steering-method.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/urdf/util.hh>
+#include <sstream>
+
+#define BOOST_TEST_MODULE prioritized - planner
+#include <boost/test/included/unit_test.hpp>
+
+using namespace hpp::core;
+using namespace hpp::pinocchio;
+
+// Two sub-robots, each made of a sphere translating in the plane.
+DevicePtr_t createRobot() {
+  std::ostringstream oss;
+  oss << "<robot name='test'><link name='base'/>";
+  for (const char* name : {"a", "b"}) {
+    oss << "<joint name='" << name << "x' type='prismatic'>"
+        << "<parent link='base'/><child link='" << name << "1'/>"
+        << "<limit effort='30' velocity='1.0' lower='-2' upper='2'/>"
+        << "</joint>"
+        << "<link name='" << name << "1'/>"
+        << "<joint name='" << name << "y' type='prismatic'>"
+        << "<axis xyz='0 1 0'/>"
+        << "<parent link='" << name << "1'/><child link='" << name << "2'/>"
+        << "<limit effort='30' velocity='1.0' lower='-2' upper='2'/>"
+        << "</joint>"
+        << "<link name='" << name << "2'><collision><geometry>"
+        << "<sphere radius='0.2'/></geometry></collision></link>";
+  }
+  oss << "</robot>";
+  DevicePtr_t robot = Device::create("test");
+  urdf::loadModelFromString(robot, 0, "", "anchor", oss.str(), "");
+  return robot;
+}
+
+BOOST_AUTO_TEST_CASE(crossing) {
+  DevicePtr_t robot = createRobot();
+  BOOST_REQUIRE_EQUAL(robot->configSize(), 4);
+  ProblemPtr_t problem = Problem::create(robot);
+
+  // The spheres cross at the origin.
+  Configuration_t q1(4), q2(4);
+  q1 << -1, 0, 0, -1;
+  q2 << 1, 0, 0, 1;
+  PathPtr_t validPart;
+  PathValidationReportPtr_t report;
+  PathPtr_t direct((*problem->steeringMethod())(q1, q2));
+  BOOST_REQUIRE(
+      !problem->pathValidation()->validate(direct, false, validPart, report));
+
+  problem->initConfig(ConfigurationPtr_t(new Configuration_t(q1)));
+  problem->addGoalConfig(ConfigurationPtr_t(new Configuration_t(q2)));
+  pathPlanner::PrioritizedPtr_t planner(
+      pathPlanner::Prioritized::create(problem));
+  PathVectorPtr_t path(planner->solve());
+  BOOST_REQUIRE(path);
+  BOOST_CHECK(path->initial().isApprox(q1));
+  BOOST_CHECK(path->end().isApprox(q2));
+  BOOST_CHECK(
+      problem->pathValidation()->validate(path, false, validPart, report));
+}
@@ -31,14 +31,22 @@
 #include <hpp/fcl/shape/geometric_shapes.h>
 
 #include <boost/test/included/unit_test.hpp>
+#include <hpp/core/edge.hh>
+#include <hpp/core/node.hh>
+#include <hpp/core/path-planner.hh>
+#include <hpp/core/path-validation.hh>
+#include <hpp/core/path-vector.hh>
 #include <hpp/core/problem-solver.hh>
 #include <hpp/core/problem.hh>
 #include <hpp/core/roadmap.hh>
+#include <hpp/core/steering-method.hh>
 #include <hpp/pinocchio/joint.hh>
 #include <hpp/pinocchio/simple-device.hh>
 #include <hpp/pinocchio/urdf/util.hh>
 #include <pinocchio/fwd.hpp>
 
+#include "../src/astar.hh"
+
 using namespace hpp::core;
 using namespace hpp::pinocchio;
 
@@ -184,3 +192,196 @@ BOOST_AUTO_TEST_CASE(carlike) {
   // Not implemented
   // carLikeProblem ("ReedsShepp", "ReedsShepp", "Dichotomy"  , 0   );
 }
+
+// Point mass and a box centered at (-2, 0, 0)
+ProblemSolverPtr_t pointMassBehindBox() {
+  const char* urdfString =
+      "<robot name='foo'><link name='base_link'>"
+      "<collision><geometry><sphere radius='0.01'/></geometry></collision>"
+      "</link></robot>";
+
+  ProblemSolverPtr_t ps = ProblemSolver::create();
+  DevicePtr_t robot = Device::create("point");
+  urdf::loadModelFromString(robot, 0, "", "translation3d", urdfString, "");
+  for (size_type i = 0; i < 3; ++i) {
+    robot->rootJoint()->lowerBound(i, -10);
+    robot->rootJoint()->upperBound(i, 10);
+  }
+  ps->robot(robot);
+  ps->pathValidationType("Discretized", 0.05);
+
+  CollisionGeometryPtr_t boxGeom(new hpp::fcl::Box(0.3, 0.3, 0.3));
+  SE3 boxTf(matrix3_t::Identity(), vector3_t(-2, 0, 0));
+  ps->addObstacle("box", boxGeom, boxTf, true, true);
+  return ps;
+}
+
+// The obstacle lies between the initial configuration and the nearest node
+// of the goal component. Only the second nearest node can be connected.
+BOOST_AUTO_TEST_CASE(connectInitAndGoals) {
+  ProblemSolverPtr_t ps = pointMassBehindBox();
+  DevicePtr_t robot = ps->robot();
+
+  ConfigurationPtr_t qinit(new Configuration_t(robot->neutralConfiguration()));
+  ConfigurationPtr_t qgoal(new Configuration_t(robot->neutralConfiguration()));
+  *qgoal << -4, 0, 0;
+  ps->initConfig(qinit);
+  ps->addGoalConfig(qgoal);
+
+  BOOST_CHECK(!ps->prepareSolveStepByStep());
+  RoadmapPtr_t roadmap(ps->roadmap());
+  PathPlannerPtr_t planner(ps->pathPlanner());
+  SteeringMethodPtr_t sm(ps->problem()->steeringMethod());
+
+  // Further from the initial configuration than the goal, but visible.
+  Configuration_t q(robot->neutralConfiguration());
+  q << -4, 3, 0;
+  NodePtr_t goal(roadmap->goalNodes()[0]);
+  NodePtr_t node(roadmap->addNode(q));
+  roadmap->addEdges(goal, node, (*sm)(*goal->configuration(), q));
+  BOOST_REQUIRE_EQUAL(roadmap->connectedComponents().size(), 2);
+
+  planner->tryConnectInitAndGoals();
+  BOOST_CHECK(!roadmap->pathExists());
+
+  ps->problem()->setParameter(
+      "PathPlanner/ConnectInitAndGoals/NumberCandidates",
+      Parameter((size_type)2));
+  planner->tryConnectInitAndGoals();
+  BOOST_CHECK(roadmap->pathExists());
+}
+
+BOOST_AUTO_TEST_CASE(solveQueries) {
+  ProblemSolverPtr_t ps = pointMassBehindBox();
+  ps->maxIterPathPlanning(1000);
+  DevicePtr_t robot = ps->robot();
+
+  ConfigurationPtr_t qinit(new Configuration_t(robot->neutralConfiguration()));
+  ConfigurationPtr_t qgoal(new Configuration_t(robot->neutralConfiguration()));
+  *qinit << 0, 5, 0;
+  *qgoal << 1, 5, 0;
+  ps->initConfig(qinit);
+  ps->addGoalConfig(qgoal);
+
+  ProblemSolver::Queries_t queries(2);
+  for (ProblemSolver::Query_t& query : queries) {
+    query.first.reset(new Configuration_t(robot->neutralConfiguration()));
+    query.second.reset(new Configuration_t(robot->neutralConfiguration()));
+  }
+  *queries[0].first << 0, 1, 0;
+  *queries[0].second << -4, 1, 0;
+  // Goes through the obstacle if planned directly
+  *queries[1].second << -4, 0, 0;
+
+  ProblemSolver::QueryResults_t results(ps->solveQueries(queries));
+  BOOST_REQUIRE_EQUAL(results.size(), 2);
+  for (std::size_t i = 0; i < 2; ++i) {
+    BOOST_REQUIRE(results[i].success);
+    PathVectorPtr_t path(ps->paths()[results[i].pathId]);
+    BOOST_CHECK(path->initial() == *queries[i].first);
+    BOOST_CHECK(path->end() == *queries[i].second);
+  }
+
+  // The query of the problem is restored
+  BOOST_CHECK(*ps->problem()->initConfig() == *qinit);
+  RoadmapPtr_t roadmap(ps->roadmap());
+  BOOST_REQUIRE(roadmap->initNode());
+  BOOST_CHECK(*roadmap->initNode()->configuration() == *qinit);
+  BOOST_REQUIRE_EQUAL(roadmap->goalNodes().size(), 1);
+  BOOST_CHECK(*roadmap->goalNodes()[0]->configuration() == *qgoal);
+  // The endpoints of the queries are removed from the roadmap
+  bool found = false;
+  for (const NodePtr_t& node : roadmap->nodes())
+    for (const ProblemSolver::Query_t& query : queries)
+      found = found || *node->configuration() == *query.first ||
+              *node->configuration() == *query.second;
+  BOOST_CHECK(!found);
+}
+
+BOOST_AUTO_TEST_CASE(repairSolution) {
+  ProblemSolverPtr_t ps = pointMassBehindBox();
+  DevicePtr_t robot = ps->robot();
+
+  ConfigurationPtr_t qinit(new Configuration_t(robot->neutralConfiguration()));
+  ConfigurationPtr_t qgoal(new Configuration_t(robot->neutralConfiguration()));
+  *qgoal << -4, 0, 0;
+  ps->initConfig(qinit);
+  ps->addGoalConfig(qgoal);
+
+  BOOST_CHECK(!ps->prepareSolveStepByStep());
+  RoadmapPtr_t roadmap(ps->roadmap());
+  NodePtr_t init(roadmap->initNode()), goal(roadmap->goalNodes()[0]);
+  // Invalid edge: the straight path goes through the obstacle.
+  roadmap->addEdge(init, goal,
+                   (*ps->problem()->steeringMethod())(*qinit, *qgoal));
+  BOOST_REQUIRE(roadmap->pathExists());
+
+  ps->problem()->setParameter("PathPlanner/RepairSolution", Parameter(true));
+  PathVectorPtr_t path(ps->pathPlanner()->computePath());
+  BOOST_REQUIRE(path);
+  BOOST_CHECK(path->initial() == *qinit);
+  BOOST_CHECK(path->end() == *qgoal);
+  PathPtr_t validPart;
+  PathValidationReportPtr_t report;
+  BOOST_CHECK(ps->problem()->pathValidation()->validate(path, false, validPart,
+                                                        report));
+
+  // The repaired edge is added in both directions.
+  std::size_t nbEdges = 0;
+  for (const EdgePtr_t& edge : goal->outEdges())
+    if (edge->to() == init) ++nbEdges;
+  BOOST_CHECK_EQUAL(nbEdges, 1);
+}
+
+// After an edge of the solution is removed, the search resumes from the
+// nodes that do not depend on it.
+BOOST_AUTO_TEST_CASE(incrementalSearch) {
+  ProblemSolverPtr_t ps = pointMassBehindBox();
+  DevicePtr_t robot = ps->robot();
+  ProblemPtr_t problem(Problem::create(robot));
+  SteeringMethodPtr_t sm(problem->steeringMethod());
+  RoadmapPtr_t roadmap(Roadmap::create(problem->distance(), robot));
+
+  // Nodes along a line and a detour around the last edge.
+  Configuration_t q(robot->neutralConfiguration());
+  std::vector<NodePtr_t> nodes;
+  for (int i = 0; i <= 10; ++i) {
+    q << i, 5, 0;
+    nodes.push_back(roadmap->addNode(q));
+  }
+  roadmap->initNode(nodes.front()->configuration());
+  roadmap->addGoalNode(nodes.back()->configuration());
+  for (std::size_t i = 0; i + 2 < nodes.size(); ++i)
+    roadmap->addEdges(nodes[i], nodes[i + 1],
+                      (*sm)(*nodes[i]->configuration(),
+                            *nodes[i + 1]->configuration()));
+  NodePtr_t n9(nodes[9]), n10(nodes[10]);
+  EdgePtr_t last(roadmap->addEdge(
+      n9, n10, (*sm)(*n9->configuration(), *n10->configuration())));
+  q << 9.5, 6, 0;
+  NodePtr_t detour(roadmap->addNode(q));
+  roadmap->addEdges(n9, detour, (*sm)(*n9->configuration(), q));
+  roadmap->addEdges(detour, n10, (*sm)(q, *n10->configuration()));
+
+  std::set<EdgePtr_t> invalid;
+  Astar astar(roadmap, problem->distance(), &invalid);
+  Astar::Edges_t edges(astar.solutionEdges());
+  BOOST_REQUIRE_EQUAL(edges.size(), 10);
+  BOOST_CHECK(edges.back() == last);
+  std::size_t first(astar.numberExpanded());
+  BOOST_CHECK_EQUAL(first, 10);
+
+  invalid.insert(last);
+  astar.removeEdges(std::vector<EdgePtr_t>(1, last));
+  edges = astar.solutionEdges();
+  BOOST_REQUIRE_EQUAL(edges.size(), 11);
+  BOOST_CHECK(edges.back()->from() == detour);
+  BOOST_CHECK_LT(astar.numberExpanded(), first);
+
+  // A new search gives the same solution.
+  Astar full(roadmap, problem->distance(), &invalid);
+  Astar::Edges_t fullEdges(full.solutionEdges());
+  BOOST_CHECK(fullEdges == edges);
+  BOOST_CHECK_GT(full.numberExpanded(), astar.numberExpanded());
+  delete ps;
+}
@@ -30,13 +30,24 @@
 #define BOOST_TEST_MODULE ReedsAndShepp
 #include <boost/test/included/unit_test.hpp>
 #include <hpp/core/distance/reeds-shepp.hh>
+#include <hpp/core/dubins-path.hh>
+#include <hpp/core/path-validation.hh>
+#include <hpp/core/path-vector.hh>
 #include <hpp/core/problem.hh>
+#include <hpp/core/steering-method/dubins.hh>
 #include <hpp/core/steering-method/reeds-shepp.hh>
 #include <hpp/pinocchio/joint.hh>
 #include <hpp/pinocchio/simple-device.hh>
+#include <limits>
 
+using hpp::core::DubinsPath;
+using hpp::core::DubinsPathPtr_t;
 using hpp::core::Parameter;
 using hpp::core::PathPtr_t;
+using hpp::core::PathValidation;
+using hpp::core::PathValidationPtr_t;
+using hpp::core::PathValidationReportPtr_t;
+using hpp::core::PathVectorPtr_t;
 using hpp::core::Problem;
 using hpp::core::ProblemPtr_t;
 using hpp::core::size_type;
@@ -80,3 +91,109 @@ BOOST_AUTO_TEST_CASE(ReedsAndShepp) {
   PathPtr_t path((*sm)(q1, q2));
   hppDout(info, "path length = " << path->length());
 }
+
+// Reject the paths shorter than a given length
+class RejectShortPaths : public PathValidation {
+ public:
+  RejectShortPaths(value_type length) : length_(length) {}
+  virtual bool validate(const PathPtr_t& path, bool, PathPtr_t& validPart,
+                        PathValidationReportPtr_t&) {
+    validPart = path;
+    return path->length() >= length_;
+  }
+
+ private:
+  value_type length_;
+};
+
+DevicePtr_t createCar() {
+  DevicePtr_t robot =
+      hpp::pinocchio::unittest::makeDevice(hpp::pinocchio::unittest::CarLike);
+  robot->rootJoint()->lowerBound(0, -10);
+  robot->rootJoint()->lowerBound(1, -10);
+  robot->rootJoint()->upperBound(0, 10);
+  robot->rootJoint()->upperBound(1, 10);
+  return robot;
+}
+
+template <typename PathPtr>
+void checkCandidates(const std::vector<PathPtr>& paths, Configuration_t q1,
+                     Configuration_t q2) {
+  BOOST_REQUIRE_GT(paths.size(), 1);
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    BOOST_CHECK((paths[i]->initial() - q1).norm() < 1e-6);
+    BOOST_CHECK_MESSAGE((paths[i]->end().head(4) - q2.head(4)).norm() < 1e-6,
+                        "word " << i << " ends at "
+                                << paths[i]->end().transpose());
+    if (i > 0) BOOST_CHECK_GE(paths[i]->length(), paths[i - 1]->length());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(candidate_words) {
+  DevicePtr_t robot(createCar());
+  std::vector<hpp::core::JointPtr_t> wheels;
+  Configuration_t q1(robot->neutralConfiguration());
+  Configuration_t q2(robot->neutralConfiguration());
+  q1 << 0, 0, 1, 0, 0, 0;
+  q2 << 1, 1.5, 0, 1, 0, 0;
+
+  value_type distance;
+  PathVectorPtr_t shortest(hpp::core::steeringMethod::reedsSheppPathOrDistance(
+      robot, q1, q2, 0, 1, 0, 2, wheels, hpp::core::ConstraintSetPtr_t(),
+      false, distance));
+  std::vector<PathVectorPtr_t> paths(hpp::core::steeringMethod::reedsSheppPaths(
+      robot, q1, q2, 0, 1, 0, 2, wheels, hpp::core::ConstraintSetPtr_t(), 4,
+      std::numeric_limits<value_type>::infinity()));
+  checkCandidates(paths, q1, q2);
+  BOOST_CHECK_LE(paths.size(), 4);
+  BOOST_CHECK_CLOSE(paths.front()->length(), shortest->length(), 1e-6);
+
+  DubinsPathPtr_t dubins(DubinsPath::create(robot, q1, q2, 0, 1, 0, 2, wheels));
+  std::vector<DubinsPathPtr_t> dubinsPaths(DubinsPath::createCandidates(
+      robot, q1, q2, 0, 1, 0, 2, wheels, hpp::core::ConstraintSetPtr_t(), 6,
+      std::numeric_limits<value_type>::infinity()));
+  checkCandidates(dubinsPaths, q1, q2);
+  BOOST_CHECK_CLOSE(dubinsPaths.front()->length(), dubins->length(), 1e-6);
+
+  // Words longer than the shortest one times the ratio are discarded.
+  paths = hpp::core::steeringMethod::reedsSheppPaths(
+      robot, q1, q2, 0, 1, 0, 2, wheels, hpp::core::ConstraintSetPtr_t(), 4,
+      1);
+  for (const PathVectorPtr_t& p : paths)
+    BOOST_CHECK_CLOSE(p->length(), shortest->length(), 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(word_fallback) {
+  DevicePtr_t robot(createCar());
+  ProblemPtr_t problem(Problem::create(robot));
+  Configuration_t q1(robot->neutralConfiguration());
+  Configuration_t q2(robot->neutralConfiguration());
+  q1 << 0, 0, 1, 0, 0, 0;
+  q2 << 1, 1.5, 0, 1, 0, 0;
+
+  SteeringMethodPtr_t sm(SteeringMethod::createWithGuess(problem));
+  hpp::core::steeringMethod::DubinsPtr_t dubins(
+      hpp::core::steeringMethod::Dubins::createWithGuess(problem));
+  BOOST_CHECK_EQUAL(sm->maxWords(), 1);
+  value_type rsLength((*sm)(q1, q2)->length()),
+      dubinsLength((*dubins)(q1, q2)->length());
+
+  // Only the shortest word is tried by default.
+  problem->pathValidation(
+      PathValidationPtr_t(new RejectShortPaths(rsLength + 1e-3)));
+  BOOST_CHECK_CLOSE((*sm)(q1, q2)->length(), rsLength, 1e-6);
+
+  sm->maxWords(5);
+  sm->maxWordLengthRatio(10);
+  PathPtr_t path((*sm)(q1, q2));
+  BOOST_REQUIRE(path);
+  BOOST_CHECK_GT(path->length(), rsLength);
+
+  problem->pathValidation(
+      PathValidationPtr_t(new RejectShortPaths(dubinsLength + 1e-3)));
+  dubins->maxWords(6);
+  dubins->maxWordLengthRatio(10);
+  path = (*dubins)(q1, q2);
+  BOOST_REQUIRE(path);
+  BOOST_CHECK_GT(path->length(), dubinsLength);
+}
@@ -0,0 +1,127 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#include <atomic>
+#include <hpp/core/task-scheduler.hh>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#define BOOST_TEST_MODULE task - scheduler
+#include <boost/test/included/unit_test.hpp>
+
+using namespace hpp::core;
+
+namespace {
+const std::size_t nbThreads[] = {1, 2, 8};
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(parallel_for) {
+  for (std::size_t n : nbThreads) {
+    TaskSchedulerPtr_t scheduler(TaskScheduler::create(n));
+    BOOST_CHECK_EQUAL(scheduler->numberThreads(), n);
+    std::vector<long> v(1000, 0);
+    TaskGroup group(scheduler);
+    group.parallelFor(0, v.size(), [&](std::size_t i) { v[i] = (long)i; });
+    group.wait();
+    BOOST_CHECK_EQUAL(std::accumulate(v.begin(), v.end(), 0L), 999L * 500);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(nested) {
+  for (std::size_t n : nbThreads) {
+    TaskSchedulerPtr_t scheduler(TaskScheduler::create(n));
+    std::vector<std::vector<int> > m(20, std::vector<int>(50, 0));
+    TaskGroup group(scheduler);
+    group.parallelFor(0, m.size(), [&](std::size_t i) {
+      TaskGroup inner(scheduler);
+      inner.parallelFor(0, m[i].size(), [&](std::size_t j) { m[i][j] = 1; });
+      inner.wait();
+    });
+    group.wait();
+    int sum = 0;
+    for (const std::vector<int>& row : m)
+      sum = std::accumulate(row.begin(), row.end(), sum);
+    BOOST_CHECK_EQUAL(sum, 1000);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(exception) {
+  for (std::size_t n : nbThreads) {
+    TaskSchedulerPtr_t scheduler(TaskScheduler::create(n));
+    std::atomic<std::size_t> count(0);
+    TaskGroup group(scheduler);
+    group.parallelFor(0, 100000, [&](std::size_t i) {
+      ++count;
+      if (i == 10) throw std::runtime_error("failure");
+    });
+    BOOST_CHECK_THROW(group.wait(), std::runtime_error);
+    BOOST_CHECK(group.isCancelled());
+    BOOST_CHECK_LT(count.load(), 100000);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(distribute) {
+  for (std::size_t n : nbThreads) {
+    TaskSchedulerPtr_t scheduler(TaskScheduler::create(n));
+    // Each task owns one counter: no synchronization is needed.
+    std::vector<int> counts(4, 0);
+    TaskGroup group(scheduler);
+    group.distribute(3, 0, 100,
+                     [&](std::size_t task, std::size_t) { ++counts[task]; });
+    group.wait();
+    BOOST_CHECK_EQUAL(counts[0] + counts[1] + counts[2], 100);
+    BOOST_CHECK_EQUAL(counts[3], 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(worker_local) {
+  for (std::size_t n : nbThreads) {
+    TaskSchedulerPtr_t scheduler(TaskScheduler::create(n));
+    WorkerLocal<std::vector<long> > scratch(
+        scheduler, []() { return std::vector<long>(1, 0); });
+    std::vector<long> sums(100, 0);
+    TaskGroup group(scheduler);
+    group.parallelFor(0, 100, [&](std::size_t i) {
+      std::vector<long>& s(scratch.local());
+      s[0] += (long)i;
+      sums[i] = s[0];
+    });
+    group.wait();
+    // The calling thread, which is not a worker, owns a distinct object.
+    scratch.local()[0] = -1;
+    BOOST_CHECK_EQUAL(scratch.local()[0], -1);
+    BOOST_CHECK_EQUAL(scheduler->workerIndex(), scheduler->numberThreads());
+    std::vector<long>* other(nullptr);
+    std::thread thread([&]() { other = &scratch.local(); });
+    thread.join();
+    BOOST_CHECK(other != &scratch.local());
+    for (std::size_t i = 0; i < sums.size(); ++i)
+      BOOST_CHECK_GE(sums[i], (long)i);
+  }
+}
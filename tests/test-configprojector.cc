@@ -191,4 +191,45 @@ BOOST_AUTO_TEST_CASE(copy) {
   BOOST_CHECK(success);
 }
 
+BOOST_AUTO_TEST_CASE(adaptive_line_search) {
+  DevicePtr_t dev = createRobot();
+  JointPtr_t xyz = dev->getJointByName("root_joint");
+  matrix3_t rot;
+  rot.setIdentity();
+  vector3_t zero;
+  zero.setZero();
+  PositionPtr_t position(
+      Position::create("Position", dev, xyz, Transform3f(rot, zero),
+                       Transform3f(rot, vector3_t(1, 1, 1))));
+  ConfigProjectorPtr_t projector =
+      ConfigProjector::create(dev, "test", 1e-4, 20);
+  projector->add(constraints::Implicit::create(
+      position, ComparisonTypes_t(3, constraints::Equality)));
+  projector->lineSearchType(ConfigProjector::Adaptive);
+
+  const std::size_t N = 5 * ConfigProjector::NbLineSearchTypes + 10;
+  for (std::size_t i = 0; i < N; ++i) {
+    Configuration_t cfg(dev->neutralConfiguration());
+    cfg.segment(0, 3) = vector_t::Constant(3, (value_type)i / (value_type)N);
+    BOOST_CHECK(projector->apply(cfg));
+    BOOST_CHECK(projector->isSatisfied(cfg));
+  }
+  size_type nbCalls = 0;
+  for (std::size_t i = 0; i < ConfigProjector::NbLineSearchTypes; ++i) {
+    const ConfigProjector::LineSearchStatistics& s(
+        projector->lineSearchStatistics((ConfigProjector::LineSearchType)i));
+    // Each line search is tried before selecting the best one.
+    BOOST_CHECK(s.nbCalls >= 5);
+    BOOST_CHECK(s.nbSuccesses <= s.nbCalls);
+    nbCalls += s.nbCalls;
+  }
+  BOOST_CHECK_EQUAL(nbCalls, (size_type)N);
+  BOOST_CHECK(projector->selectLineSearch() != ConfigProjector::Adaptive);
+
+  // Forcing a line search overrides the adaptive selection.
+  projector->lineSearchType(ConfigProjector::Backtracking);
+  BOOST_CHECK_EQUAL(projector->selectLineSearch(),
+                    ConfigProjector::Backtracking);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
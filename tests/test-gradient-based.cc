@@ -29,10 +29,16 @@
 
 #define BOOST_TEST_MODULE gradient_based
 
+#include <hpp/fcl/shape/geometric_shapes.h>
+
 #include <boost/test/included/unit_test.hpp>
 #include <cmath>
+#include <hpp/core/path-optimization/gradient-based.hh>
 #include <hpp/core/path-optimization/spline-gradient-based.hh>
+#include <hpp/core/path-optimization/windowed.hh>
+#include <hpp/core/path-validation.hh>
 #include <hpp/core/path-vector.hh>
+#include <hpp/core/problem-solver.hh>
 #include <hpp/core/problem.hh>
 #include <hpp/core/steering-method/straight.hh>
 #include <hpp/pinocchio/device.hh>
@@ -159,4 +165,130 @@ BOOST_AUTO_TEST_CASE(BFGS) {
   hppDout(info, (p3 - r3).norm());
   hppDout(info, (p4 - r4).norm());
 }
+// Same circular path as above, optimized by GradientBased.
+BOOST_AUTO_TEST_CASE(straight_waypoints) {
+  DevicePtr_t robot = createRobot();
+  value_type s = sqrt(2) / 2;
+  std::vector<Configuration_t> q(5, Configuration_t(robot->configSize()));
+  q[0] << -1, 0, 1, 0;
+  q[1] << -s, s, s, s;
+  q[2] << 0, 1, 0, 1;
+  q[3] << s, s, s, s;
+  q[4] << 1, 0, 1, 0;
+
+  ProblemPtr_t problem = Problem::create(robot);
+  SteeringMethodPtr_t sm = problem->steeringMethod();
+  PathVectorPtr_t path =
+      PathVector::create(robot->configSize(), robot->numberDof());
+  for (std::size_t i = 0; i < 4; ++i) path->appendPath((*sm)(q[i], q[i + 1]));
+  problem->setParameter("GradientBased/alphaInit", hpp::core::Parameter(1.));
+  PathOptimizerPtr_t pathOptimizer(
+      pathOptimization::GradientBased::create(problem));
+  PathVectorPtr_t optimizedPath(pathOptimizer->optimize(path));
+
+  BOOST_REQUIRE_EQUAL(optimizedPath->numberPaths(), 4);
+  for (std::size_t i = 0; i < 4; ++i) {
+    Configuration_t expected(robot->configSize());
+    expected << -1 + 0.5 * (value_type)i, 0, 1, 0;
+    const PathPtr_t& p(optimizedPath->pathAtRank(i));
+    BOOST_CHECK_SMALL((p->initial() - expected).norm(), 1e-6);
+  }
+}
+
+// A point moves around a box. The optimized path gets closer to the box
+// and remains collision free.
+BOOST_AUTO_TEST_CASE(collision_constraints) {
+  const char* urdfString =
+      "<robot name='foo'><link name='base_link'>"
+      "<collision><geometry><sphere radius='0.01'/></geometry></collision>"
+      "</link></robot>";
+  ProblemSolverPtr_t ps = ProblemSolver::create();
+  DevicePtr_t robot = Device::create("point");
+  urdf::loadModelFromString(robot, 0, "", "translation3d", urdfString, "");
+  for (size_type i = 0; i < 3; ++i) {
+    robot->rootJoint()->lowerBound(i, -2);
+    robot->rootJoint()->upperBound(i, 2);
+  }
+  ps->robot(robot);
+  CollisionGeometryPtr_t boxGeom(new hpp::fcl::Box(0.4, 0.4, 0.4));
+  ps->addObstacle("box", boxGeom, SE3::Identity(), true, true);
+  ProblemPtr_t problem = ps->problem();
+
+  std::vector<Configuration_t> q(5, Configuration_t(3));
+  q[0] << -1, 0, 0;
+  q[1] << -.5, .6, 0;
+  q[2] << 0, .6, 0;
+  q[3] << .5, .6, 0;
+  q[4] << 1, 0, 0;
+  SteeringMethodPtr_t sm = problem->steeringMethod();
+  PathVectorPtr_t path = PathVector::create(3, 3);
+  for (std::size_t i = 0; i < 4; ++i) path->appendPath((*sm)(q[i], q[i + 1]));
+
+  PathOptimizerPtr_t pathOptimizer(
+      pathOptimization::GradientBased::create(problem));
+  PathVectorPtr_t optimizedPath(pathOptimizer->optimize(path));
+
+  BOOST_REQUIRE_EQUAL(optimizedPath->numberPaths(), 4);
+  BOOST_CHECK_LT(optimizedPath->length(), path->length() - 0.1);
+  PathPtr_t validPart;
+  PathValidationReportPtr_t report;
+  BOOST_CHECK(problem->pathValidation()->validate(optimizedPath, false,
+                                                  validPart, report));
+  delete ps;
+}
+// A path along a half circle, optimized by windows of 4 paths.
+BOOST_AUTO_TEST_CASE(windowed) {
+  DevicePtr_t robot = createRobot();
+  ProblemPtr_t problem = Problem::create(robot);
+  SteeringMethodPtr_t sm = problem->steeringMethod();
+  const std::size_t n = 13;
+  PathVectorPtr_t path =
+      PathVector::create(robot->configSize(), robot->numberDof());
+  Configuration_t q0(robot->configSize()), q1(robot->configSize());
+  for (std::size_t i = 0; i <= n; ++i) {
+    value_type theta = M_PI * (1 - (value_type)i / (value_type)n);
+    q1 << cos(theta), sin(theta), 1, 0;
+    if (i > 0) path->appendPath((*sm)(q0, q1));
+    q0 = q1;
+  }
+  problem->setParameter("GradientBased/alphaInit", hpp::core::Parameter(1.));
+  problem->setParameter("PathOptimization/Windowed/WindowSize",
+                        hpp::core::Parameter((size_type)4));
+  problem->setParameter("PathOptimization/Windowed/NumberThreads",
+                        hpp::core::Parameter((size_type)2));
+  PathOptimizerPtr_t pathOptimizer(pathOptimization::Windowed::create(
+      problem, pathOptimization::GradientBased::create));
+  PathVectorPtr_t optimizedPath(pathOptimizer->optimize(path));
+
+  BOOST_CHECK_SMALL((optimizedPath->initial() - path->initial()).norm(),
+                    1e-10);
+  BOOST_CHECK_SMALL((optimizedPath->end() - path->end()).norm(), 1e-10);
+  BOOST_CHECK_LT(optimizedPath->length(), path->length() - 0.1);
+  // Consecutive paths are connected.
+  for (std::size_t i = 1; i < optimizedPath->numberPaths(); ++i)
+    BOOST_CHECK_SMALL((optimizedPath->pathAtRank(i - 1)->end() -
+                       optimizedPath->pathAtRank(i)->initial())
+                          .norm(),
+                      1e-10);
+
+  // Windowed cannot optimize its own windows.
+  ProblemSolverPtr_t ps = ProblemSolver::create();
+  ps->robot(robot);
+  ps->problem()->setParameter("PathOptimization/Windowed/Optimizer",
+                              hpp::core::Parameter(std::string("Windowed")));
+  BOOST_CHECK_THROW(ps->pathOptimizers.get("Windowed")(ps->problem()),
+                    std::invalid_argument);
+  delete ps;
+}
+
+BOOST_AUTO_TEST_CASE(problem_solver) {
+  ProblemSolverPtr_t ps = ProblemSolver::create();
+  ps->robot(createRobot());
+  BOOST_REQUIRE(ps->pathOptimizers.has("GradientBased"));
+  PathOptimizerPtr_t pathOptimizer(
+      ps->pathOptimizers.get("GradientBased")(ps->problem()));
+  BOOST_CHECK(HPP_DYNAMIC_PTR_CAST(pathOptimization::GradientBased,
+                                   pathOptimizer));
+  delete ps;
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -509,6 +509,24 @@ BOOST_AUTO_TEST_CASE(kinodynamic) {
         }
       }
     }
+
+    // reversed path : same positions traversed backward, negated velocities
+    PathPtr_t reversedPath = path->reverse();
+    BOOST_REQUIRE(reversedPath);
+    BOOST_CHECK(HPP_DYNAMIC_PTR_CAST(KinodynamicPath, reversedPath));
+    BOOST_CHECK_CLOSE(reversedPath->length(), path->length(), 1e-6);
+    vector_t vb(robot->numberDof());
+    reversedPath->velocityBound(vb, 0, reversedPath->length());
+    for (size_t j = 0; j <= 20; j++) {
+      value_type s = reversedPath->length() * (value_type)j / 20.;
+      Configuration_t qr(reversedPath->eval(s, success));
+      Configuration_t q(path->eval(path->length() - s, success));
+      for (size_t k = 0; k < 3; k++) {
+        BOOST_CHECK_SMALL(qr[k] - q[k], 1e-6);
+        BOOST_CHECK_SMALL(qr[indexECS + k] + q[indexECS + k], 1e-6);
+        BOOST_CHECK(fabs(qr[indexECS + k]) <= vb[k] + 1e-6);
+      }
+    }
   }
 }
 
@@ -710,4 +728,49 @@ BOOST_AUTO_TEST_CASE(kinodynamicOriented) {
   }
 }
 
+// The heading crosses the -x axis, where the orientation is not continuous.
+BOOST_AUTO_TEST_CASE(kinodynamicOrientedVelocityBound) {
+  DevicePtr_t robot = unittest::makeDevice(unittest::HumanoidSimple);
+  robot->rootJoint()->lowerBound(0, -10);
+  robot->rootJoint()->lowerBound(1, -10);
+  robot->rootJoint()->lowerBound(2, 0);
+  robot->rootJoint()->upperBound(0, 10);
+  robot->rootJoint()->upperBound(1, 10);
+  robot->rootJoint()->upperBound(2, 0);
+  robot->setDimensionExtraConfigSpace(6);
+  const double vMax = 2;
+  const double aMax = 0.5;
+  for (size_type i = 0; i < 2; ++i) {
+    robot->extraConfigSpace().lower(i) = -vMax;
+    robot->extraConfigSpace().upper(i) = vMax;
+    robot->extraConfigSpace().lower(i + 3) = -aMax;
+    robot->extraConfigSpace().upper(i + 3) = aMax;
+  }
+  ProblemPtr_t p = Problem::create(robot);
+  p->setParameter(std::string("Kinodynamic/velocityBound"), Parameter(vMax));
+  p->setParameter(std::string("Kinodynamic/accelerationBound"),
+                  Parameter(aMax));
+  p->setParameter(std::string("Kinodynamic/forceAllOrientation"),
+                  Parameter(true));
+  steeringMethod::KinodynamicPtr_t sm = steeringMethod::Kinodynamic::create(p);
+
+  // The velocity goes from (-1, 1) to (-1, -1).
+  size_type indexECS = robot->configSize() - 6;
+  Configuration_t q0(robot->neutralConfiguration()), q1(q0);
+  q0.tail(6).setZero();
+  q1.tail(6).setZero();
+  q0[indexECS] = -1;
+  q0[indexECS + 1] = 1;
+  q1[0] = -4;
+  q1[indexECS] = -1;
+  q1[indexECS + 1] = -1;
+  PathPtr_t path((*sm)(q0, q1));
+  BOOST_REQUIRE(path);
+  vector_t vb(robot->numberDof());
+  BOOST_CHECK_NO_THROW(path->velocityBound(vb, path->timeRange().first,
+                                           path->timeRange().second));
+  BOOST_CHECK(vb.allFinite());
+  BOOST_CHECK_GT(vb.segment<3>(3).minCoeff(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
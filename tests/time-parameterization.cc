@@ -28,7 +28,16 @@
 
 #define BOOST_TEST_MODULE time_parameterization
 #include <boost/test/included/unit_test.hpp>
+#include <hpp/core/arc-length-path.hh>
+#include <hpp/core/config-validation.hh>
+#include <hpp/core/configuration-shooter/uniform.hh>
+#include <hpp/core/path-validation-report.hh>
+#include <hpp/core/path-validation/discretized.hh>
+#include <hpp/core/projection-error.hh>
+#include <hpp/core/straight-path.hh>
+#include <hpp/core/time-parameterization/arc-length.hh>
 #include <hpp/core/time-parameterization/polynomial.hh>
+#include <hpp/core/weighed-distance.hh>
 #include <hpp/pinocchio/simple-device.hh>
 #include <pinocchio/fwd.hpp>
 
@@ -128,3 +137,147 @@ BOOST_AUTO_TEST_CASE(degree5integration) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(arc_length)
+
+// Straight path that starts and stops with zero velocity.
+PathPtr_t createSlowPath(const DevicePtr_t& robot, Configuration_t& q0,
+                         Configuration_t& q1) {
+  configurationShooter::UniformPtr_t shooter(
+      configurationShooter::Uniform::create(robot));
+  q0.resize(robot->configSize());
+  q1.resize(robot->configSize());
+  shooter->shoot(q0);
+  shooter->shoot(q1);
+  PathPtr_t path(StraightPath::create(robot, q0, q1, interval_t(0, 1)));
+  vector_t a(4);
+  a << 0, 0, 3, -2;
+  path->timeParameterization(
+      TimeParameterizationPtr_t(new timeParameterization::Polynomial(a)),
+      interval_t(0, 1));
+  return path;
+}
+
+// Configuration validation that counts the configurations it validates.
+// Straight path that fails to project the configurations of its second half.
+class HalfProjectedPath : public StraightPath {
+ public:
+  static PathPtr_t create(const DevicePtr_t& robot, ConfigurationIn_t q0,
+                          ConfigurationIn_t q1) {
+    HalfProjectedPath* ptr =
+        new HalfProjectedPath(robot->configSpace(), q0, q1);
+    StraightPathPtr_t shPtr(ptr);
+    ptr->init(shPtr);
+    return shPtr;
+  }
+
+ protected:
+  HalfProjectedPath(LiegroupSpacePtr_t space, vectorIn_t q0, vectorIn_t q1)
+      : StraightPath(space, q0, q1, interval_t(0, 1)) {}
+
+  bool impl_compute(ConfigurationOut_t result, value_type param) const {
+    StraightPath::impl_compute(result, param);
+    return param <= .5;
+  }
+};
+
+class CountValidations : public ConfigValidation {
+ public:
+  bool validate(const Configuration_t&, ValidationReportPtr_t&) {
+    ++count;
+    return true;
+  }
+  std::size_t count = 0;
+};
+
+BOOST_AUTO_TEST_CASE(table) {
+  DevicePtr_t robot = createRobot();
+  DistancePtr_t distance(WeighedDistance::create(robot));
+  Configuration_t q0, q1, q;
+  PathPtr_t path(createSlowPath(robot, q0, q1));
+  timeParameterization::ArcLengthPtr_t arcLength(
+      timeParameterization::ArcLength::create(path, distance));
+
+  const value_type L = (*distance)(q0, q1);
+  BOOST_CHECK_CLOSE(arcLength->length(), L, 1e-6);
+  BOOST_CHECK_LT(arcLength->size(), 200u);
+  BOOST_CHECK_EQUAL(arcLength->value(0), 0);
+  BOOST_CHECK_EQUAL(arcLength->value(arcLength->length()), 1);
+
+  for (int i = 0; i <= 20; ++i) {
+    const value_type s = L * i / 20;
+    const value_type t = arcLength->value(s);
+    BOOST_CHECK(path->eval(q, t));
+    BOOST_CHECK_SMALL((*distance)(q0, q) - s, 1e-2 * L);
+    BOOST_CHECK_SMALL(arcLength->lengthAtTime(t) - s, 1e-9 * L);
+    BOOST_CHECK_GE(arcLength->derivativeBound(0, L),
+                   arcLength->derivative(s, 1));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(reparameterized_path) {
+  DevicePtr_t robot = createRobot();
+  DistancePtr_t distance(WeighedDistance::create(robot));
+  Configuration_t q0, q1, q, expected;
+  PathPtr_t original(createSlowPath(robot, q0, q1));
+  ArcLengthPathPtr_t path(ArcLengthPath::create(original, distance));
+
+  const value_type L = path->length();
+  BOOST_CHECK_CLOSE(L, (*distance)(q0, q1), 1e-6);
+  BOOST_CHECK(path->initial().isApprox(q0));
+  BOOST_CHECK(path->end().isApprox(q1));
+  for (int i = 0; i <= 10; ++i) {
+    const value_type s = L * i / 10;
+    BOOST_CHECK((*path)(q, s));
+    BOOST_CHECK(original->eval(expected, path->arcLength()->value(s)));
+    BOOST_CHECK(q.isApprox(expected));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(discretized_validation) {
+  DevicePtr_t robot = createRobot();
+  DistancePtr_t distance(WeighedDistance::create(robot));
+  Configuration_t q0, q1;
+  PathPtr_t path(createSlowPath(robot, q0, q1)), validPart;
+  const value_type L = (*distance)(q0, q1);
+  PathValidationReportPtr_t report;
+
+  // Bound the distance between consecutive samples by L / 100.
+  // The speed of the path is at most 1.5 L.
+  shared_ptr<CountValidations> perTime(new CountValidations);
+  pathValidation::DiscretizedPtr_t byTime(
+      pathValidation::Discretized::create(1. / 150, {perTime}));
+  BOOST_CHECK(byTime->validate(path, false, validPart, report));
+
+  shared_ptr<CountValidations> perLength(new CountValidations);
+  pathValidation::DiscretizedPtr_t byLength(
+      pathValidation::Discretized::create(L / 100, {perLength}));
+  byLength->distance(distance);
+  BOOST_CHECK(byLength->validate(path, false, validPart, report));
+  BOOST_CHECK_LT(perLength->count, perTime->count);
+  BOOST_CHECK_LE(perLength->count, 102u);
+  BOOST_CHECK(byLength->validate(path, true, validPart, report));
+}
+
+BOOST_AUTO_TEST_CASE(projection_failure) {
+  DevicePtr_t robot = createRobot();
+  DistancePtr_t distance(WeighedDistance::create(robot));
+  Configuration_t q0, q1;
+  createSlowPath(robot, q0, q1);
+  PathPtr_t path(HalfProjectedPath::create(robot, q0, q1)), validPart;
+  BOOST_CHECK(!timeParameterization::ArcLength::create(path, distance));
+
+  // The validation steps along the time and reports the projection failure.
+  shared_ptr<CountValidations> count(new CountValidations);
+  pathValidation::DiscretizedPtr_t validation(
+      pathValidation::Discretized::create(.01, {count}));
+  validation->distance(distance);
+  PathValidationReportPtr_t report;
+  BOOST_CHECK(!validation->validate(path, false, validPart, report));
+  BOOST_REQUIRE(report);
+  BOOST_CHECK(
+      HPP_DYNAMIC_PTR_CAST(ProjectionError, report->configurationReport));
+  BOOST_CHECK_CLOSE(validPart->length(), .5, 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
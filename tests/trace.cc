@@ -0,0 +1,75 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+
+#define BOOST_TEST_MODULE trace
+#include <boost/test/included/unit_test.hpp>
+#include <hpp/core/trace.hh>
+#include <sstream>
+#include <thread>
+
+namespace trace = hpp::core::trace;
+
+BOOST_AUTO_TEST_CASE(dumpAndLoad) {
+  trace::clear();
+  trace::record(trace::SAMPLE, true, 0);
+  trace::record(trace::STEER, false, 1.5);
+  std::thread other([]() { trace::record(trace::ADD_NODE, true, 0); });
+  other.join();
+
+  std::vector<trace::Record> records(trace::records());
+  BOOST_REQUIRE_EQUAL(records.size(), 3);
+  BOOST_CHECK_EQUAL(records[0].event, trace::SAMPLE);
+  BOOST_CHECK_EQUAL(records[1].event, trace::STEER);
+  BOOST_CHECK(!records[1].success);
+  BOOST_CHECK_EQUAL(records[1].value, 1.5);
+  BOOST_CHECK_EQUAL(records[2].event, trace::ADD_NODE);
+  BOOST_CHECK(records[0].thread != records[2].thread);
+
+  const std::string filename("trace-test.bin");
+  BOOST_REQUIRE(trace::dump(filename));
+  std::vector<trace::Record> loaded;
+  BOOST_REQUIRE(trace::load(filename, loaded));
+  BOOST_REQUIRE_EQUAL(loaded.size(), records.size());
+  for (std::size_t i = 0; i < loaded.size(); ++i) {
+    BOOST_CHECK_EQUAL(loaded[i].time, records[i].time);
+    BOOST_CHECK_EQUAL(loaded[i].event, records[i].event);
+  }
+  std::ostringstream oss;
+  trace::replay(oss, loaded);
+  BOOST_CHECK(oss.str().find("steer") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(ringBuffer) {
+  trace::clear();
+  for (std::size_t i = 0; i < trace::bufferSize + 10; ++i)
+    trace::record(trace::OPTIMIZER_STEP, true, (double)i);
+  std::vector<trace::Record> records(trace::records());
+  BOOST_REQUIRE_EQUAL(records.size(), trace::bufferSize);
+  // Oldest events were overwritten.
+  BOOST_CHECK_EQUAL(records.front().value, 10.);
+  BOOST_CHECK_EQUAL(records.back().value, (double)(trace::bufferSize + 9));
+}
@@ -0,0 +1,138 @@
+// Copyright (c) 2026, LAAS-CNRS
+//
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+#include <cstdio>
+#include <fstream>
+#include <hpp/core/problem.hh>
+#include <hpp/core/weighed-distance.hh>
+#include <hpp/pinocchio/device.hh>
+#include <hpp/pinocchio/urdf/util.hh>
+#include <iterator>
+
+#define BOOST_TEST_MODULE weighed - distance
+#include <boost/test/included/unit_test.hpp>
+
+using namespace hpp::core;
+using namespace hpp::pinocchio;
+
+namespace {
+// Planar arm with two links of length 1 and l2 ended by spheres.
+DevicePtr_t createArm(const std::string& name,
+                      const std::string& l2 = "0.5") {
+  const std::string urdfString =
+      "<robot name='arm'><link name='base_link'/>"
+      "<link name='link1'><collision><origin xyz='1 0 0'/>"
+      "<geometry><sphere radius='0.1'/></geometry></collision></link>"
+      "<link name='link2'><collision><origin xyz='" +
+      l2 +
+      " 0 0'/>"
+      "<geometry><sphere radius='0.1'/></geometry></collision></link>"
+      "<joint name='j1' type='revolute'><parent link='base_link'/>"
+      "<child link='link1'/><axis xyz='0 0 1'/>"
+      "<limit lower='-3.1' upper='3.1' effort='1' velocity='1'/></joint>"
+      "<joint name='j2' type='revolute'><parent link='link1'/>"
+      "<child link='link2'/><origin xyz='1 0 0'/><axis xyz='0 0 1'/>"
+      "<limit lower='-3.1' upper='3.1' effort='1' velocity='1'/></joint>"
+      "</robot>";
+  DevicePtr_t robot = Device::create(name);
+  urdf::loadModelFromString(robot, 0, "", "anchor", urdfString, "");
+  BOOST_REQUIRE_EQUAL(robot->configSize(), 2);
+  return robot;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(calibrate) {
+  DevicePtr_t robot(createArm("arm"));
+  WeighedDistancePtr_t distance(WeighedDistance::create(robot));
+  distance->calibrate(20);
+  BOOST_REQUIRE_EQUAL(distance->size(), 2);
+
+  // Rotating the last joint moves its sphere around the joint center.
+  // Rotating the first joint moves the last sphere the most, by the
+  // rotation of the second joint center at distance 1 and the rotation
+  // of the sphere around it.
+  const std::vector<value_type>& radius(robot->geomData().radius);
+  value_type w2(radius[2]), w1(std::max(radius[1], 1 + radius[2]));
+  BOOST_CHECK_CLOSE(distance->getWeight(1), w2, 0.1);
+  BOOST_CHECK_CLOSE(distance->getWeight(0), w1, 0.1);
+}
+
+BOOST_AUTO_TEST_CASE(save_load) {
+  std::string filename("weighed-distance.bin");
+  DevicePtr_t robot(createArm("arm"));
+  WeighedDistancePtr_t calibrated(WeighedDistance::create(robot));
+  BOOST_CHECK(!calibrated->calibrateOrLoad(filename, 10));
+
+  // Weights are read from the file for the same robot model.
+  WeighedDistancePtr_t loaded(WeighedDistance::create(robot));
+  BOOST_CHECK(loaded->calibrateOrLoad(filename, 10));
+  BOOST_CHECK_EQUAL(loaded->weights(), calibrated->weights());
+
+  // and ignored for another one.
+  WeighedDistancePtr_t other(WeighedDistance::create(createArm("other")));
+  BOOST_CHECK(!other->load(filename));
+  // and for the same joints with another geometry.
+  WeighedDistancePtr_t longer(WeighedDistance::create(createArm("arm", "1")));
+  BOOST_CHECK(!longer->load(filename));
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(truncated_file) {
+  std::string filename("weighed-distance-truncated.bin");
+  DevicePtr_t robot(createArm("arm"));
+  WeighedDistancePtr_t calibrated(WeighedDistance::create(robot));
+  calibrated->calibrate(10);
+  calibrated->save(filename);
+  std::string content;
+  {
+    std::ifstream fs(filename.c_str(), std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(fs),
+                   std::istreambuf_iterator<char>());
+  }
+  BOOST_REQUIRE_GT(content.size(), 2);
+  {
+    std::ofstream fs(filename.c_str(), std::ios::binary);
+    fs.write(content.data(), (std::streamsize)content.size() / 2);
+  }
+  WeighedDistancePtr_t distance(WeighedDistance::create(robot));
+  BOOST_CHECK(!distance->load(filename));
+  // The file is calibrated again and overwritten.
+  BOOST_CHECK(!distance->calibrateOrLoad(filename, 10));
+  BOOST_CHECK(distance->load(filename));
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(problem_parameter) {
+  DevicePtr_t robot(createArm("arm"));
+  ProblemPtr_t problem(Problem::create(robot));
+  WeighedDistancePtr_t reference(WeighedDistance::create(robot));
+  reference->calibrate(10);
+
+  problem->setParameter("WeighedDistance/Calibration/NumberOfSamples",
+                        Parameter((size_type)10));
+  WeighedDistancePtr_t distance(WeighedDistance::createFromProblem(problem));
+  BOOST_CHECK(distance->weights().isApprox(reference->weights(), 1e-3));
+}